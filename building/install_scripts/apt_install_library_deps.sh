@@ -5,6 +5,7 @@ set -eoux pipefail
 apt-get update
 
 apt-get install --no-install-recommends --yes \
+    libbenchmark-dev \
     libgtest-dev \
     libopencv-dev \
     libprotobuf-dev \
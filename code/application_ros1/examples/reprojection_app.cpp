@@ -28,7 +28,10 @@ int main(int argc, char* argv[]) {
     }
     auto const& image_bag_reader{std::get<ros1::SingleTopicBagReader>(image_reader_result)};
 
-    ros1::ImageSource image_source{image_bag_reader};
+    // NOTE(Jack): Image decoding (especially for compressed image topics) is the bottleneck of the image loading step,
+    // therefore we read and decode the images in parallel in the background.
+    int const num_decoders{application::ThreadLimit()};
+    ros1::PrefetchingImageSource image_source{image_bag_reader, num_decoders, 4 * static_cast<size_t>(num_decoders)};
 
     auto const image_data_signature{ros1::SerializeBagTopic(image_bag_reader)};
     if (not image_data_signature) {
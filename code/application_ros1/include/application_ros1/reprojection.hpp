@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -22,6 +24,29 @@ class ImageSource {
     rosbag::View::iterator end_;
 };
 
+/**
+ * \brief Drop in replacement for ImageSource which reads the bag on a background thread and decodes the images in
+ * parallel on num_decoders threads. At most capacity images are buffered ahead of the consumer.
+ *
+ * The images are returned in exactly the same order as ImageSource would return them. Copying the source is cheap and
+ * all copies share the same underlying state, this is required because ImageSampler is a std::function which needs a
+ * copyable target.
+ *
+ * WARN(Jack): For raw (i.e. not compressed) images the returned cv::Mat shares the memory of the bag message and is
+ * only guaranteed to be valid until the next call! ImageLoading encodes each image before requesting the next one so
+ * this is no problem for us, but if you need to hold onto the image longer you need to clone() it.
+ */
+class PrefetchingImageSource {
+   public:
+    PrefetchingImageSource(SingleTopicBagReader const& reader, int const num_decoders, std::size_t const capacity);
+
+    std::optional<std::pair<uint64_t, cv::Mat>> operator()();
+
+   private:
+    struct Impl;
+    std::shared_ptr<Impl> impl_;
+};
+
 class ImuSource {
    public:
     explicit ImuSource(SingleTopicBagReader const& reader);
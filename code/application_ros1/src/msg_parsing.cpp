@@ -30,6 +30,34 @@ std::pair<uint64_t, cv::Mat> ToCvMat(rosbag::MessageInstance const& msg) {
     throw std::runtime_error("You asked to decode a non-image message into an image, what's going on?");
 }
 
+ImageMessage ToImageMessage(rosbag::MessageInstance const& msg) {
+    if (msg.getDataType() == "sensor_msgs/Image") {
+        return msg.instantiate<sensor_msgs::Image>();
+    } else if (msg.getDataType() == "sensor_msgs/CompressedImage") {
+        return msg.instantiate<sensor_msgs::CompressedImage>();
+    } else {
+        throw std::runtime_error("You asked to decode a non-image message into an image, what's going on?");
+    }
+}
+
+std::pair<uint64_t, cv_bridge::CvImageConstPtr> ToSharedCvImage(ImageMessage const& msg) {
+    if (auto const* const img_msg{std::get_if<sensor_msgs::Image::ConstPtr>(&msg)}) {
+        // NOTE(Jack): If no encoding conversion is required toCvShare() simply wraps the message data and does not copy
+        // a single pixel.
+        cv_bridge::CvImageConstPtr const cv_ptr{cv_bridge::toCvShare(*img_msg)};
+        uint64_t const timestamp_ns{(*img_msg)->header.stamp.toNSec()};
+
+        return {timestamp_ns, cv_ptr};
+    }
+
+    // Compressed images always need to be decoded into new memory, there is nothing to share here.
+    auto const& img_msg{std::get<sensor_msgs::CompressedImage::ConstPtr>(msg)};
+    cv_bridge::CvImageConstPtr const cv_ptr{cv_bridge::toCvCopy(img_msg)};
+    uint64_t const timestamp_ns{img_msg->header.stamp.toNSec()};
+
+    return {timestamp_ns, cv_ptr};
+}
+
 std::pair<uint64_t, std::array<double, 6>> ToImuArray(rosbag::MessageInstance const& msg) {
     if (msg.getDataType() == "sensor_msgs/Imu") {
         sensor_msgs::Imu::ConstPtr const imu_msg{msg.instantiate<sensor_msgs::Imu>()};
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cv_bridge/cv_bridge.h>
 #include <rosbag/message_instance.h>
+#include <sensor_msgs/CompressedImage.h>
+#include <sensor_msgs/Image.h>
 
 #include <array>
+#include <variant>
 
 #include <opencv2/core/mat.hpp>
 
@@ -10,6 +14,18 @@ namespace reprojection::ros1 {
 
 std::pair<uint64_t, cv::Mat> ToCvMat(rosbag::MessageInstance const& msg);
 
+// NOTE(Jack): For the prefetching image source we split ToCvMat() into two halves. The first half reads and
+// deserializes the message from the bag, this must happen on a single thread because rosbag::Bag is not thread safe.
+// The second half converts/decodes the message into an image, which is the expensive part for compressed images and can
+// be done in parallel.
+using ImageMessage = std::variant<sensor_msgs::Image::ConstPtr, sensor_msgs::CompressedImage::ConstPtr>;
+
+ImageMessage ToImageMessage(rosbag::MessageInstance const& msg);
+
+// NOTE(Jack): Returns the cv_bridge pointer and not the cv::Mat itself, because for raw images the cv::Mat shares the
+// memory of the message (see cv_bridge::toCvShare()) and the pointer is what keeps that memory alive.
+std::pair<uint64_t, cv_bridge::CvImageConstPtr> ToSharedCvImage(ImageMessage const& msg);
+
 std::pair<uint64_t, std::array<double, 6>> ToImuArray(rosbag::MessageInstance const& msg);
 
 }  // namespace reprojection::ros1
@@ -5,6 +5,8 @@
 
 #include <filesystem>
 
+#include <application/ordered_prefetcher.hpp>
+
 #include "msg_parsing.hpp"
 
 namespace reprojection::ros1 {
@@ -44,6 +46,48 @@ std::optional<std::pair<uint64_t, cv::Mat>> ImageSource::operator()() {
     return std::nullopt;
 }
 
+struct PrefetchingImageSource::Impl {
+    Impl(SingleTopicBagReader const& reader, int const num_decoders, std::size_t const capacity)
+        : itr_{reader.view_->begin()},
+          end_{reader.view_->end()},
+          prefetcher_{[this]() { return Read(); }, ToSharedCvImage, num_decoders, capacity} {}
+
+    // NOTE(Jack): Only ever called from the prefetcher's single reader thread.
+    std::optional<ImageMessage> Read() {
+        if (itr_ != end_) {
+            ImageMessage msg{ToImageMessage(*itr_)};
+            itr_ = std::next(itr_);
+
+            return msg;
+        }
+
+        return std::nullopt;
+    }
+
+    rosbag::View::iterator itr_;
+    rosbag::View::iterator end_;
+    cv_bridge::CvImageConstPtr current_;  // Keeps the memory of the last returned image alive, see WARN in header
+
+    // NOTE(Jack): Must be the last member so that its threads are joined before the iterators are destroyed.
+    application::OrderedPrefetcher<ImageMessage, std::pair<uint64_t, cv_bridge::CvImageConstPtr>> prefetcher_;
+};
+
+PrefetchingImageSource::PrefetchingImageSource(SingleTopicBagReader const& reader, int const num_decoders,
+                                               std::size_t const capacity)
+    : impl_{std::make_shared<Impl>(reader, num_decoders, capacity)} {}
+
+std::optional<std::pair<uint64_t, cv::Mat>> PrefetchingImageSource::operator()() {
+    auto const data_i{impl_->prefetcher_.Next()};
+    if (not data_i) {
+        impl_->current_.reset();
+        return std::nullopt;
+    }
+
+    impl_->current_ = data_i->second;
+
+    return std::pair<uint64_t, cv::Mat>{data_i->first, impl_->current_->image};
+}
+
 ImuSource::ImuSource(SingleTopicBagReader const& reader) : itr_{reader.view_->begin()}, end_{reader.view_->end()} {}
 
 std::optional<std::pair<uint64_t, std::array<double, 6>>> ImuSource::operator()() {
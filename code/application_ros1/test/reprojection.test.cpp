@@ -60,4 +60,34 @@ TEST(Ros1Reprojection, TestImageSource) {
 
     data = image_source();
     EXPECT_FALSE(data.has_value());
-}
\ No newline at end of file
+}
+
+TEST(Ros1Reprojection, TestPrefetchingImageSource) {
+    ros1::ScopedBagPath const temp_bag;
+    {
+        rosbag::Bag bag;
+        bag.open(temp_bag.path, rosbag::bagmode::Write);
+        for (int i{1}; i <= 20; ++i) {
+            bag.write("/raw_image_topic", ros::Time(i), ros1::DummyImage(ros::Time(i)));
+        }
+        bag.close();
+    }
+
+    auto const reader_result{ros1::SingleTopicBagReader::Create(temp_bag.path, "/raw_image_topic")};
+    ASSERT_TRUE(std::holds_alternative<ros1::SingleTopicBagReader>(reader_result));
+    auto const& reader{std::get<ros1::SingleTopicBagReader>(reader_result)};
+
+    ros1::PrefetchingImageSource image_source{reader, 4, 3};
+
+    // Even though the images are decoded in parallel they must come out in the original bag order.
+    for (uint64_t i{1}; i <= 20; ++i) {
+        auto const data{image_source()};
+        ASSERT_TRUE(data.has_value());
+        auto const& [timestamp_ns, img]{*data};
+        EXPECT_EQ(timestamp_ns, i * 1000000000);
+        EXPECT_EQ(img.rows, 1);
+        EXPECT_EQ(img.cols, 1);
+    }
+
+    EXPECT_FALSE(image_source().has_value());
+}
@@ -32,7 +32,10 @@ int main(int argc, char* argv[]) {
     }
     auto& image_bag_reader{std::get<ros2::SingleTopicBagReader>(image_reader_result)};
 
-    ros2::ImageSource image_source{image_bag_reader};
+    // NOTE(Jack): Image deserialization and decoding (especially for compressed image topics) is the bottleneck of the
+    // image loading step, therefore we read and decode the images in parallel in the background.
+    int const num_decoders{application::ThreadLimit()};
+    ros2::PrefetchingImageSource image_source{image_bag_reader, num_decoders, 4 * static_cast<size_t>(num_decoders)};
 
     auto const image_signature{ros2::SerializeBagTopic(image_bag_reader)};
     if (not image_signature) {
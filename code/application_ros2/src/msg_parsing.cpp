@@ -39,6 +39,36 @@ std::pair<uint64_t, cv::Mat> ToCvMat(rosbag2_storage::SerializedBagMessage const
     }
 }
 
+std::pair<uint64_t, cv_bridge::CvImageConstPtr> ToSharedCvImage(rosbag2_storage::SerializedBagMessage const& bag_msg,
+                                                                std::string_view type) {
+    rclcpp::SerializedMessage const serialized_msg(*bag_msg.serialized_data);
+
+    if (type == "sensor_msgs/msg/Image") {
+        rclcpp::Serialization<sensor_msgs::msg::Image> serializer;
+        auto const msg{std::make_shared<sensor_msgs::msg::Image>()};
+        serializer.deserialize_message(&serialized_msg, msg.get());
+
+        // NOTE(Jack): If no encoding conversion is required toCvShare() simply wraps the message data and does not copy
+        // a single pixel.
+        cv_bridge::CvImageConstPtr const cv_ptr{cv_bridge::toCvShare(msg)};
+        uint64_t const timestamp_ns{GetTimestampNs(msg->header)};
+
+        return {timestamp_ns, cv_ptr};
+    } else if (type == "sensor_msgs/msg/CompressedImage") {
+        // Compressed images always need to be decoded into new memory, there is nothing to share here.
+        rclcpp::Serialization<sensor_msgs::msg::CompressedImage> serializer;
+        sensor_msgs::msg::CompressedImage msg;
+        serializer.deserialize_message(&serialized_msg, &msg);
+        cv_bridge::CvImageConstPtr const cv_ptr{cv_bridge::toCvCopy(msg)};
+
+        uint64_t const timestamp_ns{GetTimestampNs(msg.header)};
+
+        return {timestamp_ns, cv_ptr};
+    } else {
+        throw std::runtime_error("Failure during ROS2 image deserialization given type: " + std::string(type));
+    }
+}
+
 std::pair<uint64_t, std::array<double, 6>> ToImuArray(rosbag2_storage::SerializedBagMessage const& bag_msg) {
     rclcpp::SerializedMessage const serialized_msg(*bag_msg.serialized_data);
 
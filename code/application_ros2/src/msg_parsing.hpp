@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cv_bridge/cv_bridge.hpp>
 #include <opencv2/core/mat.hpp>
 #include <rosbag2_storage/serialized_bag_message.hpp>
 
@@ -7,6 +8,12 @@ namespace reprojection::ros2 {
 
 std::pair<uint64_t, cv::Mat> ToCvMat(rosbag2_storage::SerializedBagMessage const& bag_msg, std::string_view type);
 
+// NOTE(Jack): Returns the cv_bridge pointer and not the cv::Mat itself, because for raw images the cv::Mat shares the
+// memory of the deserialized message (see cv_bridge::toCvShare()) and the pointer is what keeps that memory alive. Is
+// thread safe, and is used by the prefetching image source to decode the images in parallel.
+std::pair<uint64_t, cv_bridge::CvImageConstPtr> ToSharedCvImage(rosbag2_storage::SerializedBagMessage const& bag_msg,
+                                                                std::string_view type);
+
 std::pair<uint64_t, std::array<double, 6>> ToImuArray(rosbag2_storage::SerializedBagMessage const& bag_msg);
 
 }  // namespace reprojection::ros2
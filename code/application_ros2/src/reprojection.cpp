@@ -3,6 +3,8 @@
 #include <filesystem>
 #include <iostream>
 
+#include <application/ordered_prefetcher.hpp>
+
 #include "msg_parsing.hpp"
 
 namespace reprojection::ros2 {
@@ -41,6 +43,62 @@ std::optional<std::pair<uint64_t, cv::Mat>> ImageSource::operator()() {
     return std::nullopt;
 }
 
+struct PrefetchingImageSource::Impl {
+    using BagMessagePtr = std::shared_ptr<rosbag2_storage::SerializedBagMessage>;
+    using Prefetcher = application::OrderedPrefetcher<BagMessagePtr, std::pair<uint64_t, cv_bridge::CvImageConstPtr>>;
+
+    Impl(SingleTopicBagReader& bag_reader, int const num_decoders, std::size_t const capacity)
+        : bag_reader_{bag_reader}, num_decoders_{num_decoders}, capacity_{capacity} {}
+
+    // NOTE(Jack): Only ever called from the prefetcher's single reader thread, the decoding happens elsewhere.
+    std::optional<BagMessagePtr> Read() {
+        if (auto msg{bag_reader_.Next()}) {
+            return msg;
+        }
+
+        return std::nullopt;
+    }
+
+    std::unique_ptr<Prefetcher> MakePrefetcher() {
+        return std::make_unique<Prefetcher>(
+            [this]() { return Read(); },
+            [this](BagMessagePtr const& msg) { return ToSharedCvImage(*msg, bag_reader_.topic_type_); }, num_decoders_,
+            capacity_);
+    }
+
+    SingleTopicBagReader& bag_reader_;
+    int num_decoders_;
+    std::size_t capacity_;
+    cv_bridge::CvImageConstPtr current_;  // Keeps the memory of the last returned image alive, see WARN in header
+
+    // NOTE(Jack): Must be the last member so that its threads are joined before anything they use is destroyed.
+    std::unique_ptr<Prefetcher> prefetcher_;
+};
+
+PrefetchingImageSource::PrefetchingImageSource(SingleTopicBagReader& bag_reader, int const num_decoders,
+                                               std::size_t const capacity)
+    : impl_{std::make_shared<Impl>(bag_reader, num_decoders, capacity)} {}
+
+std::optional<std::pair<uint64_t, cv::Mat>> PrefetchingImageSource::operator()() {
+    if (not impl_->prefetcher_) {
+        impl_->prefetcher_ = impl_->MakePrefetcher();
+    }
+
+    auto const data_i{impl_->prefetcher_->Next()};
+    if (not data_i) {
+        // NOTE(Jack): The bag reader seeks back to the start once it runs out (see SingleTopicBagReader::Next()).
+        // Dropping the exhausted prefetcher means that the next call starts a new pass over the bag, just like
+        // ImageSource.
+        impl_->prefetcher_.reset();
+        impl_->current_.reset();
+        return std::nullopt;
+    }
+
+    impl_->current_ = data_i->second;
+
+    return std::pair<uint64_t, cv::Mat>{data_i->first, impl_->current_->image};
+}
+
 ImuSource::ImuSource(SingleTopicBagReader& bag_reader) : bag_reader_{bag_reader} {}
 
 std::optional<std::pair<uint64_t, std::array<double, 6>>> ImuSource::operator()() {
@@ -59,4 +59,43 @@ TEST(Ros2Application, TestImageSource) {
 
     data = image_source();
     EXPECT_FALSE(data.has_value());
-}
\ No newline at end of file
+}
+
+TEST(Ros2Application, TestPrefetchingImageSource) {
+    ros2::ScopedBagPath const temp_bag;
+    {
+        rosbag2_cpp::Writer writer;
+        writer.open(temp_bag.path);
+        for (int i{1}; i <= 20; ++i) {
+            writer.write(ros2::DummyImage(rclcpp::Time(i)), "/raw_image_topic", rclcpp::Time(i));
+        }
+    }
+
+    auto reader_result{ros2::SingleTopicBagReader::Create(temp_bag.path, "/raw_image_topic")};
+    ASSERT_TRUE(std::holds_alternative<ros2::SingleTopicBagReader>(reader_result));
+    auto& reader{std::get<ros2::SingleTopicBagReader>(reader_result)};
+
+    ros2::PrefetchingImageSource image_source{reader, 4, 3};
+
+    // Reading only starts on the first call, therefore using the reader here must not interfere with the image source.
+    ASSERT_TRUE(ros2::SerializeBagTopic(reader).has_value());
+
+    // Even though the images are decoded in parallel they must come out in the original bag order.
+    for (uint64_t i{1}; i <= 20; ++i) {
+        auto const data{image_source()};
+        ASSERT_TRUE(data.has_value());
+        auto const& [timestamp_ns, img]{*data};
+        EXPECT_EQ(timestamp_ns, i);
+        EXPECT_EQ(img.rows, 1);
+        EXPECT_EQ(img.cols, 1);
+    }
+
+    EXPECT_FALSE(image_source().has_value());
+
+    // Once exhausted the source starts over from the beginning of the bag, like ImageSource.
+    int count{0};
+    while (auto const data{image_source()}) {
+        EXPECT_EQ(data->first, static_cast<uint64_t>(++count));
+    }
+    EXPECT_EQ(count, 20);
+}
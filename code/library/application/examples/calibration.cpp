@@ -1,7 +1,9 @@
+#include <algorithm>
 #include <filesystem>
 
 #include "application/reprojection_calibration.hpp"
-#include "video_capture/video_capture.hpp"
+#include "config/config_parse.hpp"
+#include "video_capture/frame_source.hpp"
 
 namespace fs = std::filesystem;
 using namespace reprojection;
@@ -11,24 +13,23 @@ int main(int argc, char* argv[]) {
     if (not app_args) {
         return EXIT_FAILURE;
     }
+    config::Config const cfg{config::Config::Parse(app_args->config)};
 
-    auto const video_capture{std::make_unique<video_capture::VideoCapture>(app_args->data_path)};
+    // NOTE(Jack): Image folders are decoded one file per thread, but for video files each worker needs to seek to its
+    // own segment which does not work with every codec, therefore video segmentation is opt in.
+    int const num_workers{std::min(
+        fs::is_directory(app_args->data_path) ? cfg.application.threads : cfg.application.video_segments,
+        application::ThreadLimit())};
+    auto const frame_source{std::make_unique<video_capture::FrameSource>(
+        app_args->data_path, num_workers, cfg.application.frame_stride, 4 * static_cast<std::size_t>(num_workers))};
 
-    // NOTE(Jack): We use a simple incremented timestamp here because we have no easily accessible time information from
-    // the video file (at least I don't think we can get that). I had first planned to use a system timestamp using
-    // the chrono library but then that meant the integration testing would not work because then the cache key would
-    // change every time.
-    int pseudo_timestamp{0};
-    ImageSampler image_source{[&video_capture, &pseudo_timestamp]() -> std::optional<std::pair<uint64_t, cv::Mat>> {
-        cv::Mat img{video_capture->GetImage()};
-        if (img.empty()) {
-            return std::nullopt;
-        }
+    // NOTE(Jack): We use the frame index as a pseudo timestamp here because we have no easily accessible time
+    // information from the video file (at least I don't think we can get that). I had first planned to use a system
+    // timestamp using the chrono library but then that meant the integration testing would not work because then the
+    // cache key would change every time.
+    ImageSampler image_source{[&frame_source]() { return frame_source->GetImage(); }};
 
-        return std::pair<uint64_t, cv::Mat>{pseudo_timestamp++, img};
-    }};
-
-    application::Calibrate(app_args->config, {image_source, video_capture->GetSignature()}, std::nullopt, app_args->db);
+    application::Calibrate(app_args->config, {image_source, frame_source->GetSignature()}, std::nullopt, app_args->db);
 
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
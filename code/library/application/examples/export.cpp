@@ -0,0 +1,40 @@
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <string>
+
+#include "application/cli_utils.hpp"
+#include "database/calibration_database.hpp"
+#include "database/columnar_export.hpp"
+#include "logging/logging.hpp"
+
+namespace fs = std::filesystem;
+using namespace reprojection;
+
+// NOTE(Jack): Exports the step results of one workflow to columnar files for offline analysis, see
+// database::ColumnarExport() for the file layout. Usage:
+//
+//      application.export --database <path to .db3> --workflow <workflow id> --output <output directory>
+int main(int argc, char* argv[]) {
+    auto const log{logging::Get("application")};
+
+    auto const db_path{application::GetCommandOption(argv, argv + argc, "--database")};
+    auto const workflow_id{application::GetCommandOption(argv, argv + argc, "--workflow")};
+    auto const output_dir{application::GetCommandOption(argv, argv + argc, "--output")};
+    if (not db_path or not workflow_id or not output_dir) {
+        log->error("Missing one of the required flags: --database, --workflow, --output");
+        return EXIT_FAILURE;
+    }
+
+    try {
+        SqlitePtr const db{database::OpenCalibrationDatabase(*db_path, false, true)};
+        database::ColumnarExport(db.get(), WorkflowId{std::stoll(*workflow_id)}, fs::path{*output_dir});
+    } catch (std::exception const& e) {
+        log->error(e.what());
+        return EXIT_FAILURE;
+    }
+
+    log->info("{{'database': '{}', 'workflow_id': {}, 'output_dir': '{}'}}", *db_path, *workflow_id, *output_dir);
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
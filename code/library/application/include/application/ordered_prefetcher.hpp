@@ -0,0 +1,203 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// NOTE(Jack): This header is consumed by the ROS1 application which cannot be compiled with anything newer than c++17
+// (see application_ros1/CMakeLists.txt). Therefore, please do not use any c++20 or newer features here (no jthread,
+// no concepts, no std::format etc.)!
+
+namespace reprojection::application {
+
+/**
+ * \brief Reads raw items one by one on a single background thread, decodes them in parallel on a pool of worker
+ * threads, and hands the decoded items back out in exactly the order they were read.
+ *
+ * This exists because most of our data sources (ROS bags, video files, image folders) are a serial "read" part which is
+ * not thread safe (ex. rosbag::Bag), followed by a "decode" part (ex. png/jpeg decompression, cv_bridge conversion)
+ * which is expensive but completely independent from frame to frame. The reader is only ever called from the reader
+ * thread, the decoder is called concurrently from all decoder threads and therefore must be thread safe.
+ *
+ * The number of items which are read but not yet handed out by Next() is limited to capacity, this prevents us from
+ * loading an entire bag into memory when the consumer is slower than the decoders.
+ *
+ * The background threads are only started on the first call to Next(). This is on purpose, because some readers (ex.
+ * the ROS2 SingleTopicBagReader) are used by someone else (ex. SerializeBagTopic()) between the construction of the
+ * prefetcher and the first time we actually want data.
+ *
+ * If the reader or decoder throws, the exception is rethrown from Next() on the consuming thread.
+ */
+template <typename Raw, typename Decoded>
+class OrderedPrefetcher {
+   public:
+    using Reader = std::function<std::optional<Raw>()>;
+    using Decoder = std::function<Decoded(Raw const&)>;
+
+    OrderedPrefetcher(Reader reader, Decoder decoder, int const num_decoders, std::size_t const capacity)
+        : reader_{std::move(reader)},
+          decoder_{std::move(decoder)},
+          num_decoders_{num_decoders > 0 ? num_decoders : 1},
+          capacity_{capacity > 0 ? capacity : 1} {}
+
+    // NOTE(Jack): The threads hold a pointer to this, so we cannot allow the object to be copied or moved. If you need
+    // to pass it around put it in a shared_ptr.
+    OrderedPrefetcher(OrderedPrefetcher const&) = delete;
+    OrderedPrefetcher& operator=(OrderedPrefetcher const&) = delete;
+    OrderedPrefetcher(OrderedPrefetcher&&) = delete;
+    OrderedPrefetcher& operator=(OrderedPrefetcher&&) = delete;
+
+    ~OrderedPrefetcher() {
+        {
+            std::lock_guard<std::mutex> const lock{mutex_};
+            stop_ = true;
+        }
+        condition_.notify_all();
+
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    std::optional<Decoded> Next() {
+        if (threads_.empty()) {
+            Start();
+        }
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        condition_.wait(lock, [this]() {
+            return error_ or decoded_.count(next_out_) == 1 or (reading_done_ and next_out_ == next_read_);
+        });
+
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+
+        auto const it{decoded_.find(next_out_)};
+        if (it == std::end(decoded_)) {
+            return std::nullopt;
+        }
+
+        Decoded item{std::move(it->second)};
+        decoded_.erase(it);
+        ++next_out_;
+
+        lock.unlock();
+        condition_.notify_all();  // There is now space in the queue for the reader to fill
+
+        return item;
+    }
+
+   private:
+    void Start() {
+        threads_.emplace_back(&OrderedPrefetcher::ReadLoop, this);
+        for (int i{0}; i < num_decoders_; ++i) {
+            threads_.emplace_back(&OrderedPrefetcher::DecodeLoop, this);
+        }
+    }
+
+    void ReadLoop() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                condition_.wait(lock, [this]() { return stop_ or next_read_ - next_out_ < capacity_; });
+                if (stop_) {
+                    return;
+                }
+            }
+
+            // NOTE(Jack): The actual read happens outside the lock so that the consumer and decoders are never blocked
+            // by disk access.
+            std::optional<Raw> raw;
+            try {
+                raw = reader_();
+            } catch (...) {
+                Fail(std::current_exception());
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> const lock{mutex_};
+                if (not raw) {
+                    reading_done_ = true;
+                } else {
+                    pending_.emplace_back(next_read_, std::move(*raw));
+                    ++next_read_;
+                }
+            }
+            condition_.notify_all();
+
+            if (not raw) {
+                return;
+            }
+        }
+    }
+
+    void DecodeLoop() {
+        while (true) {
+            std::optional<std::pair<std::size_t, Raw>> job;
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                condition_.wait(lock, [this]() { return stop_ or not pending_.empty() or reading_done_; });
+                if (stop_ or pending_.empty()) {
+                    return;
+                }
+
+                job.emplace(std::move(pending_.front()));
+                pending_.pop_front();
+            }
+
+            try {
+                Decoded decoded{decoder_(job->second)};
+
+                std::lock_guard<std::mutex> const lock{mutex_};
+                decoded_.emplace(job->first, std::move(decoded));
+            } catch (...) {
+                Fail(std::current_exception());
+                return;
+            }
+            condition_.notify_all();
+        }
+    }
+
+    void Fail(std::exception_ptr const error) {
+        {
+            std::lock_guard<std::mutex> const lock{mutex_};
+            if (not error_) {
+                error_ = error;
+            }
+            stop_ = true;
+        }
+        condition_.notify_all();
+    }
+
+    Reader reader_;
+    Decoder decoder_;
+    int num_decoders_;
+    std::size_t capacity_;
+
+    // NOTE(Jack): We use one mutex and one condition variable for everything. There are more fine-grained designs, but
+    // the work done per item (disk read, image decode) is so much larger than the time spent holding the lock that it
+    // is simply not worth the complexity.
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::pair<std::size_t, Raw>> pending_;  // Read but not yet decoded
+    std::map<std::size_t, Decoded> decoded_;           // Decoded but not yet handed out, keyed by read order
+    std::size_t next_read_{0};
+    std::size_t next_out_{0};
+    bool reading_done_{false};
+    bool stop_{false};
+    std::exception_ptr error_;
+
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace reprojection::application
@@ -33,8 +33,13 @@ struct ImuInput {  // LCOV_EXCL_LINE
     std::string signature;
 };
 
+// NOTE(Jack): Also applies the max_threads config option to the process wide thread limit, so call this before starting
+// any background threads (ex. image decoding) and size them with ThreadLimit().
 std::optional<AppArgs> ParseArgs(int const argc, char const* const argv[]);
 
+// The total number of threads the process should use at the same time.
+int ThreadLimit();
+
 Sensors ParseSensors(toml::table const& cfg_table);
 
 // TODO(Jack): How should we pass the ImageSourceSignature?
@@ -2,7 +2,10 @@
 
 #include <ranges>
 
+#include "concurrency/thread_budget.hpp"
 #include "config/config_parse.hpp"
+#include "database/artifact_cache.hpp"
+#include "optimization/solver_strategy.hpp"
 #include "steps/bundle_adjustment.hpp"
 #include "steps/camera_info.hpp"
 #include "steps/extrinsic_init.hpp"
@@ -31,6 +34,20 @@ std::optional<AppArgs> ParseArgs(int const argc, char const* const argv[]) {
     if (not config) {
         return std::nullopt;  // LCOV_EXCL_LINE
     }
+    auto const parsed_config{config::Config::Parse(*config)};
+    if (auto const max_threads{parsed_config.application.max_threads}) {
+        concurrency::SetThreadLimit(*max_threads);
+    }
+
+    auto const to_override{[](config::Config::Solver::Override const& solver) {
+        return optimization::SolverOverride{solver.linear_solver, solver.preconditioner};
+    }};
+    optimization::SetSolverOverride(optimization::SolverProblem::AngularVelocityAlignment,
+                                    to_override(parsed_config.solver.angular_velocity_alignment));
+    optimization::SetSolverOverride(optimization::SolverProblem::BundleAdjustment,
+                                    to_override(parsed_config.solver.bundle_adjustment));
+    optimization::SetSolverOverride(optimization::SolverProblem::ExtrinsicOptimization,
+                                    to_override(parsed_config.solver.extrinsic_optimization));
 
     auto const db{Open(paths->workspace_dir, paths->data_path)};
     if (not db) {
@@ -40,6 +57,8 @@ std::optional<AppArgs> ParseArgs(int const argc, char const* const argv[]) {
     return AppArgs{paths->data_path, *config, *db};
 }
 
+int ThreadLimit() { return concurrency::ThreadLimit(); }
+
 // TODO(Jack): To be honest I do not like having this function because now we parse the entire config twice. Once on the
 // application side and once on the library side. It is not the end of the world but we should keep our eyes out for any
 // hints that we are missing the point.
@@ -58,6 +77,10 @@ void Calibrate(toml::table const& cfg_table, ImageInput const& image_input, std:
                SqlitePtr const db) {
     steps::CalibrationContext const cfg{steps::InitializeCalibration(cfg_table, db)};
 
+    // NOTE(Jack): Most steps below read the extracted targets, camera info and intrinsics of earlier steps. The scope
+    // makes sure each of these is only loaded and parsed once for the whole run.
+    database::ArtifactCacheScope const artifact_cache{db.get()};
+
     steps::ImageLoading const image_loading_step{cfg.camera_id, image_input.signature, image_input.source};
     StepId const image_loading_id{steps::RunStep<steps::ImageLoading>(cfg.workflow_id, image_loading_step, db)};
 
@@ -75,11 +98,23 @@ void Calibrate(toml::table const& cfg_table, ImageInput const& image_input, std:
                                                              camera_info_id, targets_id, db};
     StepId const intrinsic_init_id{RunStep<steps::IntrinsicInitialization>(cfg.workflow_id, intrinsic_init_step, db)};
 
-    steps::PoseInitialization const pose_init_step{cfg.camera_id, targets_id, camera_info_id, intrinsic_init_id, db};
+    steps::PoseInitialization const pose_init_step{cfg.camera_id,
+                                                   targets_id,
+                                                   cfg.config.application.sequential_pose_initialization,
+                                                   camera_info_id,
+                                                   intrinsic_init_id,
+                                                   db};
     StepId const pose_init_id{RunStep<steps::PoseInitialization>(cfg.workflow_id, pose_init_step, db)};
 
-    steps::BundleAdjustment const bundle_adjustment_step{
-        cfg.camera_id, targets_id, cfg.config.application.threads, camera_info_id, intrinsic_init_id, pose_init_id, db};
+    steps::BundleAdjustment const bundle_adjustment_step{cfg.camera_id,
+                                                         targets_id,
+                                                         cfg.config.application.threads,
+                                                         cfg.config.application.solver_time_budget_s,
+                                                         cfg.config.application.warm_start,
+                                                         camera_info_id,
+                                                         intrinsic_init_id,
+                                                         pose_init_id,
+                                                         db};
     StepId const bundle_adjustment_id{RunStep<steps::BundleAdjustment>(cfg.workflow_id, bundle_adjustment_step, db)};
 
     // TODO(Jack): We need to get this running in the unit testing even just with empty data!
@@ -92,17 +127,40 @@ void Calibrate(toml::table const& cfg_table, ImageInput const& image_input, std:
         // unrefined pose init poses here? For some reason when I do that the extrinsic init does not work like before,
         // we need to look at this in the debug dashboard and figure out what is going on here. The entire "align
         // rotations" thing play an important part here I think. This is a known problem.
-        steps::SplineInitialization const spline_init_step{cfg.camera_id,  pose_init_id,         targets_id,
-                                                           camera_info_id, bundle_adjustment_id, db};
+        steps::SplineInitialization const spline_init_step{cfg.camera_id,
+                                                           pose_init_id,
+                                                           targets_id,
+                                                           camera_info_id,
+                                                           bundle_adjustment_id,
+                                                           cfg.config.application.spline_knot_frequency_hz,
+                                                           cfg.config.application.spline_min_knot_frequency_hz,
+                                                           db};
         StepId const spline_init_id{steps::RunStep<steps::SplineInitialization>(cfg.workflow_id, spline_init_step, db)};
 
-        steps::ExtrinsicInit const extrinsic_init_step{
-            cfg.camera_id, spline_init_id, *cfg.imu_id, imu_data_id, cfg.config.application.threads, db};
+        steps::ExtrinsicInit const extrinsic_init_step{cfg.camera_id,
+                                                       spline_init_id,
+                                                       *cfg.imu_id,
+                                                       imu_data_id,
+                                                       cfg.config.application.threads,
+                                                       cfg.config.application.solver_time_budget_s,
+                                                       cfg.config.application.extrinsic_init_refinement,
+                                                       db};
         StepId const extrinsic_init_id{steps::RunStep<steps::ExtrinsicInit>(cfg.workflow_id, extrinsic_init_step, db)};
 
-        steps::ExtrinsicOptimization const extrinsic_optimization_step{
-            cfg.camera_id,  *cfg.imu_id,          targets_id,     imu_data_id,       cfg.config.application.threads,
-            camera_info_id, bundle_adjustment_id, spline_init_id, extrinsic_init_id, db};
+        steps::ExtrinsicOptimization const extrinsic_optimization_step{cfg.camera_id,
+                                                                       *cfg.imu_id,
+                                                                       targets_id,
+                                                                       imu_data_id,
+                                                                       cfg.config.application.threads,
+                                                                       cfg.config.application.solver_time_budget_s,
+                                                                       cfg.config.application.imu_samples_per_segment,
+                                                                       cfg.config.application.extrinsic_window_s,
+                                                                       cfg.config.application.extrinsic_spline_levels,
+                                                                       camera_info_id,
+                                                                       bundle_adjustment_id,
+                                                                       spline_init_id,
+                                                                       extrinsic_init_id,
+                                                                       db};
         StepId const extrinsic_optimization_id{
             steps::RunStep<steps::ExtrinsicOptimization>(cfg.workflow_id, extrinsic_optimization_step, db)};
 
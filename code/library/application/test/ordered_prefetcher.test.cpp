@@ -0,0 +1,81 @@
+#include "application/ordered_prefetcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+using namespace reprojection;
+
+TEST(ApplicationOrderedPrefetcher, TestOrderedOutput) {
+    int count{0};
+    auto reader{[&count]() -> std::optional<int> {
+        if (count == 100) {
+            return std::nullopt;
+        }
+        return count++;
+    }};
+    // Make the early items slow to decode so that they finish after the later ones, the output must still be in order.
+    auto decoder{[](int const& i) {
+        std::this_thread::sleep_for(std::chrono::microseconds((100 - i) * 10));
+        return 2 * i;
+    }};
+
+    application::OrderedPrefetcher<int, int> prefetcher{reader, decoder, 4, 8};
+
+    for (int i{0}; i < 100; ++i) {
+        auto const item{prefetcher.Next()};
+        ASSERT_TRUE(item.has_value());
+        EXPECT_EQ(*item, 2 * i);
+    }
+
+    EXPECT_FALSE(prefetcher.Next().has_value());
+    EXPECT_FALSE(prefetcher.Next().has_value());  // Stays exhausted
+}
+
+TEST(ApplicationOrderedPrefetcher, TestBoundedCapacity) {
+    std::atomic<int> num_read{0};
+    auto reader{[&num_read]() -> std::optional<int> {
+        if (num_read == 100) {
+            return std::nullopt;
+        }
+        return num_read++;
+    }};
+    auto decoder{[](int const& i) { return i; }};
+
+    application::OrderedPrefetcher<int, int> prefetcher{reader, decoder, 2, 5};
+
+    ASSERT_TRUE(prefetcher.Next().has_value());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // One item handed out plus at most five in flight.
+    EXPECT_LE(num_read, 6);
+}
+
+TEST(ApplicationOrderedPrefetcher, TestEmptyReader) {
+    application::OrderedPrefetcher<int, int> prefetcher{[]() -> std::optional<int> { return std::nullopt; },
+                                                        [](int const& i) { return i; }, 2, 4};
+
+    EXPECT_FALSE(prefetcher.Next().has_value());
+}
+
+TEST(ApplicationOrderedPrefetcher, TestDecoderErrorPropagation) {
+    int count{0};
+    auto reader{[&count]() -> std::optional<int> { return count++; }};
+    auto decoder{[](int const& i) {
+        if (i == 3) {
+            throw std::runtime_error("Bad frame");
+        }
+        return i;
+    }};
+
+    application::OrderedPrefetcher<int, int> prefetcher{reader, decoder, 2, 4};
+
+    EXPECT_THROW(
+        {
+            while (prefetcher.Next()) {
+            }
+        },
+        std::runtime_error);
+}
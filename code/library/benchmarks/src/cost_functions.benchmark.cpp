@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <ceres/cost_function.h>
+
+#include "testing_utilities/constants.hpp"
+#include "types/eigen_types.hpp"
+#include "types/enums.hpp"
+
+#include "cost_functions/reprojection_error.hpp"
+#include "cost_functions/reprojection_error_spline.hpp"
+#include "cost_functions/rigid_body_angular_velocity.hpp"
+#include "cost_functions/rigid_body_linear_acceleration.hpp"
+#include "cost_functions/spline_energy.hpp"
+
+using namespace reprojection;
+using namespace reprojection::optimization::cost_functions;
+
+namespace {
+
+uint64_t constexpr delta_t_ns{100'000'000};  // 10hz knots
+double constexpr u_i{0.5};
+
+// NOTE(Jack): Small non-zero values so that we do not accidentally hit special case branches (ex. the zero rotation
+// case of the angle axis functions) that are not representative of a real optimization.
+std::vector<double> ParameterBlock(int const size) {
+    std::vector<double> block(size);
+    for (int i{0}; i < size; ++i) {
+        block[i] = 0.01 * (i + 1);
+    }
+
+    return block;
+}
+
+// The first parameter block is always filled by the caller (ex. the intrinsics), all other blocks get dummy values.
+void BenchmarkEvaluate(benchmark::State& state, std::unique_ptr<ceres::CostFunction> const& cost_function,
+                       std::vector<double> const& first_block) {
+    std::vector<int32_t> const& block_sizes{cost_function->parameter_block_sizes()};
+    int const num_residuals{cost_function->num_residuals()};
+
+    std::vector<std::vector<double>> blocks{first_block};
+    std::vector<std::vector<double>> jacobian_blocks{std::vector<double>(num_residuals * block_sizes[0])};
+    for (std::size_t i{1}; i < std::size(block_sizes); ++i) {
+        blocks.push_back(ParameterBlock(block_sizes[i]));
+        jacobian_blocks.emplace_back(num_residuals * block_sizes[i]);
+    }
+
+    std::vector<double const*> parameters;
+    std::vector<double*> jacobians;
+    for (std::size_t i{0}; i < std::size(blocks); ++i) {
+        parameters.push_back(blocks[i].data());
+        jacobians.push_back(jacobian_blocks[i].data());
+    }
+    std::vector<double> residuals(num_residuals);
+
+    bool const with_jacobians{state.range(0) == 1};
+    for (auto _ : state) {
+        bool const success{cost_function->Evaluate(parameters.data(), residuals.data(),
+                                                   with_jacobians ? jacobians.data() : nullptr)};
+        benchmark::DoNotOptimize(success);
+        benchmark::DoNotOptimize(residuals.data());
+    }
+
+    // NOTE(Jack): The number of parameters is the width of the jacobian, which the autodiff cost scales with.
+    state.counters["num_parameters"] = std::accumulate(std::cbegin(block_sizes), std::cend(block_sizes), 0);
+}
+
+}  // namespace
+
+// NOTE(Jack): For all the benchmarks here the argument is 0 for the residual only and 1 for residual plus jacobians.
+static void BM_ReprojectionError(benchmark::State& state) {
+    std::unique_ptr<ceres::CostFunction> const cost_function{
+        Create(CameraModel::DoubleSphere, testing_utilities::image_bounds, {360, 240}, {0.1, 0.1, 600})};
+    ArrayXd const& intrinsics{testing_utilities::double_sphere_intrinsics};
+
+    BenchmarkEvaluate(state, cost_function, {intrinsics.data(), intrinsics.data() + intrinsics.size()});
+}
+BENCHMARK(BM_ReprojectionError)->Arg(0)->Arg(1);
+
+static void BM_ReprojectionErrorSpline(benchmark::State& state) {
+    std::unique_ptr<ceres::CostFunction> const cost_function{Create(
+        CameraModel::DoubleSphere, testing_utilities::image_bounds, {360, 240}, {0.1, 0.1, 600}, u_i, delta_t_ns)};
+    ArrayXd const& intrinsics{testing_utilities::double_sphere_intrinsics};
+
+    BenchmarkEvaluate(state, cost_function, {intrinsics.data(), intrinsics.data() + intrinsics.size()});
+}
+BENCHMARK(BM_ReprojectionErrorSpline)->Arg(0)->Arg(1);
+
+static void BM_RigidBodyAngularVelocity(benchmark::State& state) {
+    std::unique_ptr<ceres::CostFunction> const cost_function{
+        RigidBodyAngularVelocity::Create({0.1, 0.2, 0.3}, u_i, delta_t_ns)};
+
+    BenchmarkEvaluate(state, cost_function, ParameterBlock(3));
+}
+BENCHMARK(BM_RigidBodyAngularVelocity)->Arg(0)->Arg(1);
+
+static void BM_RigidBodyLinearAcceleration(benchmark::State& state) {
+    std::unique_ptr<ceres::CostFunction> const cost_function{
+        RigidBodyLinearAcceleration::Create({0.1, 0.2, 9.81}, u_i, delta_t_ns)};
+
+    BenchmarkEvaluate(state, cost_function, ParameterBlock(3));
+}
+BENCHMARK(BM_RigidBodyLinearAcceleration)->Arg(0)->Arg(1);
+
+static void BM_SplineEnergy(benchmark::State& state) {
+    std::unique_ptr<ceres::CostFunction> const cost_function{SplineEnergy::Create(delta_t_ns)};
+
+    BenchmarkEvaluate(state, cost_function, ParameterBlock(3));
+}
+BENCHMARK(BM_SplineEnergy)->Arg(0)->Arg(1);
@@ -0,0 +1,330 @@
+#include <benchmark/benchmark.h>
+
+#include <tuple>
+
+#include "database/calibration_database.hpp"
+#include "spline/time_handler.hpp"
+#include "spline/types.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/calibration_types.hpp"
+#include "types/database_types.hpp"
+#include "types/enums.hpp"
+#include "types/io.hpp"
+#include "types/sensor_data_types.hpp"
+
+using namespace reprojection;
+
+namespace {
+
+// NOTE(Jack): All the per-table insert/select functions are built on top of BatchExecuteStatement() and ExecuteQuery()
+// from sqlite_helpers.hpp. We benchmark them through the public database interface because that is what the steps
+// actually call, and the binders/readers for each table are part of the cost we care about.
+//
+// For all bulk tables the benchmark argument is the duration of the simulated data in seconds, with a 20hz camera and a
+// 200hz imu.
+class BenchmarkDatabase {
+   public:
+    explicit BenchmarkDatabase(double const duration_s)
+        : db_{database::OpenCalibrationDatabase(":memory:", true)},
+          camera_id_{database::GetOrCreateAsset(db_.get(), AssetType::Camera, 0, "/cam0/image_raw")},
+          imu_id_{database::GetOrCreateAsset(db_.get(), AssetType::Imu, 0, "/imu0")},
+          target_id_{database::GetOrCreateAsset(db_.get(), AssetType::Target, 0, "")} {
+        std::tie(targets_, frames_) = testing_mocks::GenerateMvgData(
+            {CameraModel::Pinhole, testing_utilities::image_bounds}, {testing_utilities::pinhole_intrinsics},
+            duration_s, 20);
+        imu_data_ = testing_mocks::GenerateImuData(duration_s, 200).first;
+
+        // NOTE(Jack): The images are not real encoded images, but the database does not care what the bytes are. 50kB
+        // is about the size of a compressed VGA image.
+        for (auto const& [timestamp_ns, target] : targets_) {
+            images_.insert({timestamp_ns, ImageBuffer{std::vector<unsigned char>(50'000, 128)}});
+            reprojection_errors_.insert({timestamp_ns, ArrayX2d::Constant(target.bundle.pixels.rows(), 2, 0.1)});
+        }
+        for (auto const& [timestamp_ns, _] : imu_data_) {
+            imu_errors_.insert({timestamp_ns, ImuErrorState{{0.1, 0.2, 0.3}, {0.4, 0.5, 0.6}}});
+        }
+
+        // Satisfy the foreign key constraints, the steps and data that the benchmarked tables reference.
+        images_step_ = NewStep(StepType::ImageLoading);
+        database::ImagesInsert(db_.get(), images_step_, camera_id_, images_);
+        targets_step_ = NewStep(StepType::FeatureExtraction);
+        database::ExtractedTargetsInsert(db_.get(), targets_step_, images_step_, camera_id_, targets_);
+        imu_data_step_ = NewStep(StepType::ImuDataLoading);
+        database::ImuDataInsert(db_.get(), imu_data_step_, imu_id_, imu_data_);
+    }
+
+    // NOTE(Jack): Until the cache key is set with StepCacheKeyUpdate() every call creates a brand new step. This is
+    // what we want because every insert benchmark iteration needs a fresh step to not violate the primary keys.
+    StepId NewStep(StepType const type) { return database::GetOrCreateStep(db_.get(), type, "").first; }
+
+    sqlite3* Get() const { return db_.get(); }
+
+    SqlitePtr db_;
+    AssetId camera_id_;
+    AssetId imu_id_;
+    AssetId target_id_;
+
+    CameraMeasurements targets_;
+    Frames frames_;
+    ImuMeasurements imu_data_;
+    EncodedImages images_;
+    ReprojectionErrors reprojection_errors_;
+    ImuErrors imu_errors_;
+
+    StepId images_step_{-1};
+    StepId targets_step_{-1};
+    StepId imu_data_step_{-1};
+};
+
+}  // namespace
+
+static void BM_ImagesInsert(benchmark::State& state) {
+    BenchmarkDatabase db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::ImageLoading)};
+        state.ResumeTiming();
+
+        database::ImagesInsert(db.Get(), step_id, db.camera_id_, db.images_);
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.images_));
+}
+BENCHMARK(BM_ImagesInsert)->Arg(1)->Arg(10);
+
+static void BM_ImagesSelect(benchmark::State& state) {
+    BenchmarkDatabase const db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(database::ImagesSelect(db.Get(), db.images_step_, db.camera_id_));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.images_));
+}
+BENCHMARK(BM_ImagesSelect)->Arg(1)->Arg(10);
+
+static void BM_ExtractedTargetsInsert(benchmark::State& state) {
+    BenchmarkDatabase db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::FeatureExtraction)};
+        state.ResumeTiming();
+
+        database::ExtractedTargetsInsert(db.Get(), step_id, db.images_step_, db.camera_id_, db.targets_);
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.targets_));
+}
+BENCHMARK(BM_ExtractedTargetsInsert)->Arg(1)->Arg(10);
+
+static void BM_ExtractedTargetsSelect(benchmark::State& state) {
+    BenchmarkDatabase const db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(database::ExtractedTargetsSelect(db.Get(), db.targets_step_, db.camera_id_));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.targets_));
+}
+BENCHMARK(BM_ExtractedTargetsSelect)->Arg(1)->Arg(10);
+
+static void BM_CameraPosesInsertSelect(benchmark::State& state) {
+    BenchmarkDatabase db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::PoseInit)};
+        state.ResumeTiming();
+
+        database::CameraPosesInsert(db.Get(), step_id, db.targets_step_, db.camera_id_, db.frames_);
+        benchmark::DoNotOptimize(database::CameraPosesSelect(db.Get(), step_id, db.camera_id_));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.frames_));
+}
+BENCHMARK(BM_CameraPosesInsertSelect)->Arg(1)->Arg(10);
+
+static void BM_ReprojectionErrorsInsert(benchmark::State& state) {
+    BenchmarkDatabase db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::PoseInit)};
+        state.ResumeTiming();
+
+        database::ReprojectionErrorsInsert(db.Get(), step_id, db.targets_step_, db.camera_id_,
+                                           db.reprojection_errors_);
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.reprojection_errors_));
+}
+BENCHMARK(BM_ReprojectionErrorsInsert)->Arg(1)->Arg(10);
+
+static void BM_ImuDataInsert(benchmark::State& state) {
+    BenchmarkDatabase db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::ImuDataLoading)};
+        state.ResumeTiming();
+
+        database::ImuDataInsert(db.Get(), step_id, db.imu_id_, db.imu_data_);
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.imu_data_));
+}
+BENCHMARK(BM_ImuDataInsert)->Arg(1)->Arg(10);
+
+static void BM_ImuDataSelect(benchmark::State& state) {
+    BenchmarkDatabase const db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(database::ImuDataSelect(db.Get(), db.imu_data_step_, db.imu_id_));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.imu_data_));
+}
+BENCHMARK(BM_ImuDataSelect)->Arg(1)->Arg(10);
+
+// NOTE(Jack): Selects a one second window from the middle of the data, only the overlapping chunks are read.
+static void BM_ImuDataSelectRange(benchmark::State& state) {
+    BenchmarkDatabase const db{static_cast<double>(state.range(0))};
+    uint64_t const start_ns{(std::cbegin(db.imu_data_)->first + std::crbegin(db.imu_data_)->first) / 2};
+    uint64_t const end_ns{start_ns + 1'000'000'000};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(database::ImuDataSelect(db.Get(), db.imu_data_step_, db.imu_id_, start_ns, end_ns));
+    }
+}
+BENCHMARK(BM_ImuDataSelectRange)->Arg(10)->Arg(100);
+
+static void BM_ImuErrorsInsert(benchmark::State& state) {
+    BenchmarkDatabase db{static_cast<double>(state.range(0))};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::ExtrinsicInit)};
+        state.ResumeTiming();
+
+        database::ImuErrorsInsert(db.Get(), step_id, db.imu_data_step_, db.imu_id_, db.imu_errors_);
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.imu_errors_));
+}
+BENCHMARK(BM_ImuErrorsInsert)->Arg(1)->Arg(10);
+
+static void BM_ImuErrorsSelect(benchmark::State& state) {
+    BenchmarkDatabase db{static_cast<double>(state.range(0))};
+    StepId const step_id{db.NewStep(StepType::ExtrinsicInit)};
+    database::ImuErrorsInsert(db.Get(), step_id, db.imu_data_step_, db.imu_id_, db.imu_errors_);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(database::ImuErrorsSelect(db.Get(), step_id, db.imu_id_));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(db.imu_errors_));
+}
+BENCHMARK(BM_ImuErrorsSelect)->Arg(1)->Arg(10);
+
+// The argument is the number of control points.
+static void BM_ControlPointsInsertSelect(benchmark::State& state) {
+    BenchmarkDatabase db{0.1};
+    spline::Matrix2NXd const control_points{spline::Matrix2NXd::Random(6, state.range(0))};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::SplineInit)};
+        state.ResumeTiming();
+
+        database::ControlPointsInsert(db.Get(), step_id, db.camera_id_, control_points);
+        benchmark::DoNotOptimize(database::ControlPointsSelect(db.Get(), step_id, db.camera_id_));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ControlPointsInsertSelect)->Arg(100)->Arg(1000);
+
+// NOTE(Jack): The following tables only ever hold one row per step (and asset), so the insert and select are measured
+// together and are dominated by the statement preparation and not the data itself.
+
+static void BM_CameraInfoInsertSelect(benchmark::State& state) {
+    BenchmarkDatabase db{0.1};
+    CameraInfo const camera_info{CameraModel::DoubleSphere, testing_utilities::image_bounds};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::CameraInfo)};
+        state.ResumeTiming();
+
+        database::CameraInfoInsert(db.Get(), step_id, db.camera_id_, camera_info);
+        benchmark::DoNotOptimize(database::CameraInfoSelect(db.Get(), step_id, db.camera_id_));
+    }
+}
+BENCHMARK(BM_CameraInfoInsertSelect);
+
+static void BM_ExtrinsicInsertSelect(benchmark::State& state) {
+    BenchmarkDatabase db{0.1};
+    Extrinsic const extrinsic{db.camera_id_, db.imu_id_, Array6d::Random()};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::ExtrinsicInit)};
+        state.ResumeTiming();
+
+        database::ExtrinsicInsert(db.Get(), step_id, extrinsic);
+        benchmark::DoNotOptimize(database::ExtrinsicSelect(db.Get(), step_id, db.camera_id_, db.imu_id_));
+    }
+}
+BENCHMARK(BM_ExtrinsicInsertSelect);
+
+static void BM_GravityInsertSelect(benchmark::State& state) {
+    BenchmarkDatabase db{0.1};
+    Vector3d const gravity{0, 0, -9.81};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::ExtrinsicInit)};
+        state.ResumeTiming();
+
+        database::GravityInsert(db.Get(), step_id, gravity);
+        benchmark::DoNotOptimize(database::GravitySelect(db.Get(), step_id));
+    }
+}
+BENCHMARK(BM_GravityInsertSelect);
+
+static void BM_IntrinsicInsertSelect(benchmark::State& state) {
+    BenchmarkDatabase db{0.1};
+    CameraState const intrinsics{testing_utilities::double_sphere_intrinsics};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::IntrinsicInit)};
+        state.ResumeTiming();
+
+        database::IntrinsicInsert(db.Get(), step_id, db.camera_id_, CameraModel::DoubleSphere, intrinsics);
+        benchmark::DoNotOptimize(database::IntrinsicSelect(db.Get(), step_id, db.camera_id_));
+    }
+}
+BENCHMARK(BM_IntrinsicInsertSelect);
+
+static void BM_SplineInfoInsertSelect(benchmark::State& state) {
+    BenchmarkDatabase db{0.1};
+    spline::TimeHandler const time_handler{0, 100'000'000};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::SplineInit)};
+        state.ResumeTiming();
+
+        database::SplineInfoInsert(db.Get(), step_id, db.camera_id_, time_handler);
+        benchmark::DoNotOptimize(database::SplineInfoSelect(db.Get(), step_id, db.camera_id_));
+    }
+}
+BENCHMARK(BM_SplineInfoInsertSelect);
+
+static void BM_TargetInfoInsertSelect(benchmark::State& state) {
+    BenchmarkDatabase db{0.1};
+    TargetInfo const target_info{TargetType::Aprilgrid3, 6, 6, 0.1, false};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        StepId const step_id{db.NewStep(StepType::TargetInfo)};
+        state.ResumeTiming();
+
+        database::TargetInfoInsert(db.Get(), step_id, db.target_id_, target_info);
+        benchmark::DoNotOptimize(database::TargetInfoSelect(db.Get(), step_id, db.target_id_));
+    }
+}
+BENCHMARK(BM_TargetInfoInsertSelect);
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+
+#include "geometry/lie.hpp"
+#include "optimization/extrinsic_optimization.hpp"
+#include "spline/spline_initialization.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/calibration_types.hpp"
+
+using namespace reprojection;
+
+// NOTE(Jack): The argument is the number of coarse-to-fine levels, where zero is the plain single level solve at the
+// 100Hz knots that the spline initialization step uses by default. Unlike in the extrinsic optimization test the
+// initial extrinsic and gravity are perturbed, so that the solves need a realistic number of iterations.
+static void BM_ExtrinsicOptimizationCoarseToFine(benchmark::State& state) {
+    double const duration_s{10};
+    CameraInfo const camera_info{CameraModel::Pinhole, testing_utilities::image_bounds};
+    auto const [targets, poses_co_w]{testing_mocks::GenerateMvgData(
+        camera_info, CameraState{testing_utilities::pinhole_intrinsics}, duration_s, 10)};
+    ImuMeasurements const imu_data{testing_mocks::GenerateImuData(duration_s, 400).first};
+
+    Frames poses_w_co;
+    for (auto const& [timestamp_ns, pose_co_w] : poses_co_w) {
+        poses_w_co.insert({timestamp_ns, {geometry::Log(geometry::Exp(pose_co_w.pose).inverse())}});
+    }
+    spline::Se3Spline const spline_w_co{spline::InitializeSe3SplineState(poses_w_co, 100)};
+
+    Extrinsic const initial_extrinsic{AssetId{1}, AssetId{2}, Vector6d{-1.15, 1.2, -1.2, -0.05, 0.08, 0.0}};
+    Vector3d const initial_gravity{0, 0, 9.81};
+    int const num_levels{static_cast<int>(state.range(0))};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(optimization::CoarseToFineExtrinsicOptimization(
+            imu_data, spline_w_co, initial_extrinsic, initial_gravity, camera_info, targets,
+            {testing_utilities::pinhole_intrinsics}, std::nullopt, num_levels, 1));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(imu_data));
+}
+BENCHMARK(BM_ExtrinsicOptimizationCoarseToFine)->Arg(0)->Arg(1)->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
\ No newline at end of file
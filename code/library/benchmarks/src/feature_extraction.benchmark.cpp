@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <opencv2/opencv.hpp>
+
+#include "feature_extraction/target_extraction.hpp"
+#include "types/calibration_types.hpp"
+#include "types/enums.hpp"
+
+#include "target_generators.hpp"
+
+extern "C" {
+#include "generated_apriltag_code/tagCustom36h11.h"
+}
+
+using namespace reprojection;
+using namespace reprojection::feature_extraction;
+
+namespace {
+
+// NOTE(Jack): The generated boards are perfect and fronto-parallel, so these numbers are a lower bound on what a real
+// image costs. The "features" counter is there so that you notice if a change to a generator or extractor makes the
+// detection fail, in which case the benchmark would be measuring something completely different.
+void BenchmarkExtract(benchmark::State& state, TargetInfo const& target_info, cv::Mat const& image) {
+    std::unique_ptr<TargetExtractor> const extractor{CreateTargetExtractor(target_info)};
+
+    std::optional<ExtractedTarget> target;
+    for (auto _ : state) {
+        target = extractor->Extract(image);
+        benchmark::DoNotOptimize(target);
+    }
+    state.counters["features"] = target ? target->indices.rows() : 0;
+}
+
+}  // namespace
+
+static void BM_ExtractCheckerboard(benchmark::State& state) {
+    TargetInfo const target_info{TargetType::Checkerboard, 6, 9, 0.1, false};
+    cv::Mat const image{GenerateCheckerboard({target_info.width, target_info.height}, 50)};
+
+    BenchmarkExtract(state, target_info, image);
+}
+BENCHMARK(BM_ExtractCheckerboard)->Unit(benchmark::kMillisecond);
+
+static void BM_ExtractCircleGrid(benchmark::State& state) {
+    TargetInfo const target_info{TargetType::CircleGrid, 6, 9, 0.1, false};
+    cv::Mat const image{GenerateCircleGrid({target_info.width, target_info.height}, 20, 20, target_info.asymmetric)};
+
+    BenchmarkExtract(state, target_info, image);
+}
+BENCHMARK(BM_ExtractCircleGrid)->Unit(benchmark::kMillisecond);
+
+static void BM_ExtractAprilgrid3(benchmark::State& state) {
+    TargetInfo const target_info{TargetType::Aprilgrid3, 6, 6, 0.1, false};
+
+    apriltag_family_t* const tag_family{tagCustom36h11_create()};
+    cv::Mat const image{Aprilgrid3Generation::GenerateBoard(tag_family->nbits, tag_family->codes, 4,
+                                                            {target_info.width, target_info.height})};
+    tagCustom36h11_destroy(tag_family);
+
+    BenchmarkExtract(state, target_info, image);
+}
+BENCHMARK(BM_ExtractAprilgrid3)->Unit(benchmark::kMillisecond);
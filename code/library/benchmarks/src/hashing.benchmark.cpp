@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include "hashing/hashing.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/calibration_types.hpp"
+#include "types/sensor_data_types.hpp"
+
+using namespace reprojection;
+
+namespace {
+
+CameraInfo const camera_info{CameraModel::Pinhole, testing_utilities::image_bounds};
+CameraState const camera_state{testing_utilities::pinhole_intrinsics};
+
+}  // namespace
+
+// For all benchmarks here the argument is the duration of the simulated data in seconds.
+
+static void BM_HashCameraMeasurements(benchmark::State& state) {
+    CameraMeasurements const targets{
+        testing_mocks::GenerateMvgData(camera_info, camera_state, state.range(0), 20).first};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hashing::HashArguments(camera_info, targets));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(targets));
+}
+BENCHMARK(BM_HashCameraMeasurements)->Arg(1)->Arg(10);
+
+static void BM_HashFrames(benchmark::State& state) {
+    Frames const frames{testing_mocks::GenerateMvgData(camera_info, camera_state, state.range(0), 20).second};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hashing::HashArguments(camera_info, camera_state, frames));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(frames));
+}
+BENCHMARK(BM_HashFrames)->Arg(1)->Arg(10);
+
+static void BM_HashImuMeasurements(benchmark::State& state) {
+    ImuMeasurements const imu_data{testing_mocks::GenerateImuData(state.range(0), 200).first};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hashing::HashArguments(imu_data));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(imu_data));
+}
+BENCHMARK(BM_HashImuMeasurements)->Arg(1)->Arg(10);
+
+// NOTE(Jack): At time of writing Serialize(EncodedImages) only uses the timestamp and buffer size, so the content of
+// the buffers does not matter. 50kB is about the size of a compressed VGA image.
+static void BM_HashEncodedImages(benchmark::State& state) {
+    EncodedImages images;
+    for (uint64_t i{0}; i < static_cast<uint64_t>(20 * state.range(0)); ++i) {
+        images.insert({i * 50'000'000, ImageBuffer{std::vector<unsigned char>(50'000)}});
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hashing::HashArguments(images));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(images));
+}
+BENCHMARK(BM_HashEncodedImages)->Arg(1)->Arg(10);
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+
+#include "geometry/lie.hpp"
+#include "optimization/extrinsic_optimization.hpp"
+#include "optimization/imu_aggregation.hpp"
+#include "spline/spline_initialization.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/calibration_types.hpp"
+
+using namespace reprojection;
+
+// NOTE(Jack): 400Hz IMU data on a spline with 50Hz knots, i.e. eight raw samples per segment. The argument is the
+// number of aggregated measurements per segment, where zero means no aggregation. Like in the extrinsic optimization
+// test the initial values are close to the optimum, so this mostly measures the problem construction and the cost of
+// the first iterations.
+static void BM_ExtrinsicOptimizationImuAggregation(benchmark::State& state) {
+    double const duration_s{10};
+    CameraInfo const camera_info{CameraModel::Pinhole, testing_utilities::image_bounds};
+    auto const [targets, poses_co_w]{testing_mocks::GenerateMvgData(
+        camera_info, CameraState{testing_utilities::pinhole_intrinsics}, duration_s, 10)};
+    ImuMeasurements const imu_data{testing_mocks::GenerateImuData(duration_s, 400).first};
+
+    Frames poses_w_co;
+    for (auto const& [timestamp_ns, pose_co_w] : poses_co_w) {
+        poses_w_co.insert({timestamp_ns, {geometry::Log(geometry::Exp(pose_co_w.pose).inverse())}});
+    }
+    spline::Se3Spline const spline_w_co{spline::InitializeSe3SplineState(poses_w_co, 50)};
+
+    Extrinsic const initial_extrinsic{AssetId{1}, AssetId{2},
+                                      Vector6d{-1.19516, 1.17219, -1.23556, -0.0242935, 0.0530558, 0.0251949}};
+    Vector3d const initial_gravity{-0.212548, -0.293729, 9.79995};
+    std::optional<int> const samples_per_segment{state.range(0) > 0 ? std::optional{static_cast<int>(state.range(0))}
+                                                                    : std::nullopt};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(optimization::ExtrinsicOptimization(
+            imu_data, spline_w_co, initial_extrinsic, initial_gravity, camera_info, targets,
+            {testing_utilities::pinhole_intrinsics}, samples_per_segment, 1));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(imu_data));
+}
+BENCHMARK(BM_ExtrinsicOptimizationImuAggregation)->Arg(0)->Arg(4)->Arg(2)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_AggregateImuData(benchmark::State& state) {
+    ImuMeasurements const imu_data{testing_mocks::GenerateImuData(10, 1000).first};
+    spline::TimeHandler const time_handler{std::cbegin(imu_data)->first, 10'000'000};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            optimization::AggregateImuData(imu_data, time_handler, static_cast<int>(state.range(0))));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(imu_data));
+}
+BENCHMARK(BM_AggregateImuData)->Arg(1)->Arg(4);
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+
+#include "pnp/pnp.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/calibration_types.hpp"
+#include "types/enums.hpp"
+
+using namespace reprojection;
+
+namespace {
+
+// NOTE(Jack): The benchmark argument selects the target type. A flat target (1) goes through the Dlt22 and refines in
+// unit image coordinates, a non-flat target (0) goes through the Dlt23 and refines in pixels. The timing includes the
+// DLT, which is the same for both refinements, so the difference between the two benchmarks is the refinement alone.
+// The items processed are poses, which gives you the poses per second directly.
+void BenchmarkPnp(benchmark::State& state, pnp::PnpRefinement const refinement) {
+    bool const flat{state.range(0) == 1};
+    CameraInfo const sensor{CameraModel::Pinhole,
+                            flat ? testing_utilities::unit_image_bounds : testing_utilities::image_bounds};
+    CameraState const intrinsics{flat ? testing_utilities::unit_pinhole_intrinsics
+                                      : testing_utilities::pinhole_intrinsics};
+    CameraMeasurements const targets{testing_mocks::GenerateMvgData(sensor, intrinsics, 10, 10, flat).first};
+
+    for (auto _ : state) {
+        for (auto const& [timestamp_ns, target] : targets) {
+            benchmark::DoNotOptimize(pnp::Pnp(target.bundle, sensor.bounds, refinement));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(targets));
+}
+
+}  // namespace
+
+static void BM_PnpCeres(benchmark::State& state) { BenchmarkPnp(state, pnp::PnpRefinement::Ceres); }
+BENCHMARK(BM_PnpCeres)->Arg(0)->Arg(1);
+
+static void BM_PnpFixedSize(benchmark::State& state) { BenchmarkPnp(state, pnp::PnpRefinement::FixedSize); }
+BENCHMARK(BM_PnpFixedSize)->Arg(0)->Arg(1);
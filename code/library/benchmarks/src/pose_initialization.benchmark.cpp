@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+#include "projection_functions/initialize_camera.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/calibration_types.hpp"
+#include "types/enums.hpp"
+
+#include "pose_initialization.hpp"
+
+using namespace reprojection;
+
+namespace {
+
+// NOTE(Jack): A one minute long 30hz sequence, i.e. the kind of long video sequence where seeding every frame from the
+// frames before it should pay off. Both benchmarks run on one single thread, so that the difference between the two is
+// only the DLT versus the seeded refinement. The "dlt_fallbacks" counter is the number of frames where the seeded
+// refinement was not good enough and the DLT was used after all.
+class PoseInitializationData {
+   public:
+    PoseInitializationData()
+        : camera_info_{CameraModel::DoubleSphere, testing_utilities::image_bounds},
+          targets_{testing_mocks::GenerateMvgData(camera_info_, {testing_utilities::double_sphere_intrinsics}, 60, 30)
+                       .first},
+          camera_{projection_functions::InitializeCamera(camera_info_.camera_model,
+                                                         testing_utilities::double_sphere_intrinsics,
+                                                         camera_info_.bounds)} {
+        for (auto const& [timestamp_ns, target] : targets_) {
+            sequence_.push_back({timestamp_ns, &target.bundle});
+        }
+    }
+
+    CameraInfo camera_info_;
+    CameraMeasurements targets_;
+    std::unique_ptr<projection_functions::Camera> camera_;
+    std::vector<std::pair<uint64_t, Bundle const*>> sequence_;
+};
+
+}  // namespace
+
+static void BM_PoseInitializationIndependent(benchmark::State& state) {
+    PoseInitializationData const data;
+
+    for (auto _ : state) {
+        for (auto const& [timestamp_ns, bundle] : data.sequence_) {
+            benchmark::DoNotOptimize(
+                calibration::EstimatePoseViaPinholePnP(data.camera_, *bundle, data.camera_info_.bounds));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(data.sequence_));
+}
+BENCHMARK(BM_PoseInitializationIndependent)->Unit(benchmark::kMillisecond);
+
+static void BM_PoseInitializationSequential(benchmark::State& state) {
+    PoseInitializationData const data;
+
+    int num_fallbacks{0};
+    for (auto _ : state) {
+        auto const [poses, fallbacks]{
+            calibration::EstimatePosesViaSequentialPnP(data.camera_, data.sequence_, data.camera_info_.bounds)};
+        benchmark::DoNotOptimize(poses);
+        num_fallbacks = fallbacks;
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(data.sequence_));
+    state.counters["dlt_fallbacks"] = num_fallbacks;
+}
+BENCHMARK(BM_PoseInitializationSequential)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include "projection_functions/camera_model.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/eigen_types.hpp"
+
+using namespace reprojection;
+using namespace reprojection::projection_functions;
+
+namespace {
+
+template <typename T_Model>
+Eigen::Array<double, T_Model::Size, 1> Intrinsics();
+
+template <>
+Eigen::Array<double, Pinhole::Size, 1> Intrinsics<Pinhole>() {
+    return testing_utilities::pinhole_intrinsics;
+}
+
+template <>
+Eigen::Array<double, PinholeRadtan4::Size, 1> Intrinsics<PinholeRadtan4>() {
+    return {600, 360, 240, -0.1, 0.1, 0.001, 0.001};
+}
+
+template <>
+Eigen::Array<double, UnifiedCameraModel::Size, 1> Intrinsics<UnifiedCameraModel>() {
+    return {600, 360, 240, 0.1};
+}
+
+template <>
+Eigen::Array<double, DoubleSphere::Size, 1> Intrinsics<DoubleSphere>() {
+    return testing_utilities::double_sphere_intrinsics;
+}
+
+// Points spread over the field of view at a fixed depth, so that every model projects all of them into the image.
+MatrixX3d FieldOfViewPoints(int const num_points) {
+    MatrixX3d points(num_points, 3);
+    for (int i{0}; i < num_points; ++i) {
+        double const alpha{static_cast<double>(i) / num_points};
+        points.row(i) = Vector3d{-300 + 600 * alpha, 200 - 400 * alpha, 600};
+    }
+
+    return points;
+}
+
+}  // namespace
+
+template <typename T_Model>
+static void BM_Project(benchmark::State& state) {
+    Camera_T<T_Model> const camera{Intrinsics<T_Model>(), testing_utilities::image_bounds};
+    MatrixX3d const points{FieldOfViewPoints(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(camera.Project(points));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Project, Pinhole)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_Project, PinholeRadtan4)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_Project, UnifiedCameraModel)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_Project, DoubleSphere)->Arg(1000);
+
+template <typename T_Model>
+static void BM_Unproject(benchmark::State& state) {
+    Camera_T<T_Model> const camera{Intrinsics<T_Model>(), testing_utilities::image_bounds};
+    auto const [pixels, mask]{camera.Project(FieldOfViewPoints(static_cast<int>(state.range(0))))};
+    if (not mask.all()) {
+        state.SkipWithError("Not all benchmark points project into the image!");
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(camera.Unproject(pixels));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// NOTE(Jack): PinholeRadtan4 unprojection is an iterative undistortion, so expect it to be much slower than the others.
+BENCHMARK_TEMPLATE(BM_Unproject, Pinhole)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_Unproject, PinholeRadtan4)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_Unproject, UnifiedCameraModel)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_Unproject, DoubleSphere)->Arg(1000);
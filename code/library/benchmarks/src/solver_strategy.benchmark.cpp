@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <string>
+
+#include "geometry/lie.hpp"
+#include "optimization/bundle_adjustment.hpp"
+#include "optimization/solver_strategy.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/calibration_types.hpp"
+
+using namespace reprojection;
+
+namespace {
+
+// NOTE(Jack): The benchmark argument is the length of the sequence in seconds, sampled at 10Hz, so the number of frames
+// is roughly ten times the argument. The initial poses are noisy so that the solver actually has to iterate. An empty
+// linear solver benchmarks the automatic selection, everything else is forced through the override. The items
+// processed are frames.
+void BenchmarkBundleAdjustment(benchmark::State& state, std::optional<std::string> const& linear_solver) {
+    CameraInfo const sensor{CameraModel::Pinhole, testing_utilities::image_bounds};
+    CameraState const intrinsics{testing_utilities::pinhole_intrinsics};
+    auto const [targets, gt_frames]{
+        testing_mocks::GenerateMvgData(sensor, intrinsics, static_cast<double>(state.range(0)), 10, false)};
+
+    Frames noisy_frames{gt_frames};
+    for (auto& [_, frame_i] : noisy_frames) {
+        frame_i.pose = geometry::Log(testing_mocks::AddGaussianNoise(0.05, 0.05, geometry::Exp(frame_i.pose)));
+    }
+    OptimizationState const initial_state{intrinsics, noisy_frames};
+
+    optimization::SetSolverOverride(optimization::SolverProblem::BundleAdjustment, {linear_solver, std::nullopt});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(optimization::BundleAdjustment(sensor, targets, initial_state, 1));
+    }
+    optimization::SetSolverOverride(optimization::SolverProblem::BundleAdjustment, {});
+
+    state.SetItemsProcessed(state.iterations() * std::size(targets));
+}
+
+}  // namespace
+
+static void BM_BundleAdjustmentAutoSolver(benchmark::State& state) { BenchmarkBundleAdjustment(state, std::nullopt); }
+BENCHMARK(BM_BundleAdjustmentAutoSolver)->Arg(10)->Arg(100)->Arg(300);
+
+static void BM_BundleAdjustmentDenseSchur(benchmark::State& state) { BenchmarkBundleAdjustment(state, "DENSE_SCHUR"); }
+BENCHMARK(BM_BundleAdjustmentDenseSchur)->Arg(10)->Arg(100)->Arg(300);
+
+static void BM_BundleAdjustmentSparseSchur(benchmark::State& state) {
+    BenchmarkBundleAdjustment(state, "SPARSE_SCHUR");
+}
+BENCHMARK(BM_BundleAdjustmentSparseSchur)->Arg(10)->Arg(100)->Arg(300);
+
+static void BM_BundleAdjustmentIterativeSchur(benchmark::State& state) {
+    BenchmarkBundleAdjustment(state, "ITERATIVE_SCHUR");
+}
+BENCHMARK(BM_BundleAdjustmentIterativeSchur)->Arg(10)->Arg(100)->Arg(300);
+
+static void BM_BundleAdjustmentSparseNormalCholesky(benchmark::State& state) {
+    BenchmarkBundleAdjustment(state, "SPARSE_NORMAL_CHOLESKY");
+}
+BENCHMARK(BM_BundleAdjustmentSparseNormalCholesky)->Arg(10)->Arg(100)->Arg(300);
\ No newline at end of file
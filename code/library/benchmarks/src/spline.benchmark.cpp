@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+#include <ceres/jet.h>
+
+#include <cmath>
+#include <optional>
+#include <vector>
+
+#include "spline/r3_spline.hpp"
+#include "spline/se3_spline.hpp"
+#include "spline/so3_spline.hpp"
+#include "spline/types.hpp"
+#include "types/eigen_types.hpp"
+#include "types/spline_types.hpp"
+
+#include "cubic_spline_c3_init.hpp"
+
+using namespace reprojection;
+using namespace reprojection::spline;
+
+namespace {
+
+uint64_t constexpr delta_t_ns{100'000'000};  // 10hz knots
+
+// NOTE(Jack): Small non-zero rotations so that the so3 evaluation does not hit the zero angle special case.
+MatrixNKd const P{{0.01, 0.02, 0.03, 0.04},  //
+                  {0.05, 0.06, 0.07, 0.08},
+                  {0.09, 0.10, 0.11, 0.12}};
+
+// NOTE(Jack): 1kHz evaluation times on a 100hz spline with a smooth non-trivial trajectory, i.e. what the diagnostics
+// see for a long IMU recording. The number of segments is the argument.
+std::pair<Se3Spline, std::vector<uint64_t>> EvaluationData(int const num_segments) {
+    Matrix2NXd control_points{2 * N, num_segments + D};
+    for (int i{0}; i < control_points.cols(); ++i) {
+        double const t{0.1 * i};
+        control_points.col(i) << 0.2 * std::sin(t), 0.1 * std::cos(t), 0.05 * t, t, std::sin(t), std::cos(t);
+    }
+
+    uint64_t constexpr knot_delta_t_ns{10'000'000};
+    std::vector<uint64_t> times;
+    for (uint64_t t_ns{0}; t_ns < num_segments * knot_delta_t_ns; t_ns += knot_delta_t_ns / 10) {
+        times.push_back(t_ns);
+    }
+
+    return {Se3Spline{control_points, {0, knot_delta_t_ns}}, times};
+}
+
+}  // namespace
+
+template <DerivativeOrder Derivative>
+static void BM_So3SplineEvaluate(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(So3Spline::Evaluate<double, Derivative>(P, 0.5, delta_t_ns));
+    }
+}
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluate, DerivativeOrder::Null);
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluate, DerivativeOrder::First);
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluate, DerivativeOrder::Second);
+
+// NOTE(Jack): Inside of the ceres problems the so3 spline is evaluated with Jets, where every operation is paid once
+// per derivative component. The Jet size is the total size of all parameter blocks of the cost function, ex. 24 for
+// the eight control point blocks of ReprojectionErrorSpline_T plus up to 6 for the intrinsics.
+template <DerivativeOrder Derivative, int JetSize>
+static void BM_So3SplineEvaluateJet(benchmark::State& state) {
+    using Jet = ceres::Jet<double, JetSize>;
+
+    MatrixNK<Jet> P_jet{P.cast<Jet>()};
+    for (int i{0}; i < P_jet.size(); ++i) {
+        P_jet(i).v[i] = 1;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(So3Spline::Evaluate<Jet, Derivative>(P_jet, 0.5, delta_t_ns));
+    }
+}
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluateJet, DerivativeOrder::Null, 24);
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluateJet, DerivativeOrder::Null, 30);
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluateJet, DerivativeOrder::First, 24);
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluateJet, DerivativeOrder::First, 30);
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluateJet, DerivativeOrder::Second, 24);
+BENCHMARK_TEMPLATE(BM_So3SplineEvaluateJet, DerivativeOrder::Second, 30);
+
+template <DerivativeOrder Derivative>
+static void BM_R3SplineEvaluate(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(R3Spline::Evaluate<double, Derivative>(P, 0.5, delta_t_ns));
+    }
+}
+BENCHMARK_TEMPLATE(BM_R3SplineEvaluate, DerivativeOrder::Null);
+BENCHMARK_TEMPLATE(BM_R3SplineEvaluate, DerivativeOrder::First);
+BENCHMARK_TEMPLATE(BM_R3SplineEvaluate, DerivativeOrder::Second);
+
+// The argument is the number of spline segments, with two position measurements per segment.
+// WARN(Jack): CubicBSplineC3Init::BuildAb() still builds the dense A matrix, therefore the memory grows quadratically
+// with the number of segments. Do not push the range much further than this or you will run out of memory!
+static void BM_InitializeC3SplineState(benchmark::State& state) {
+    auto const num_segments{static_cast<size_t>(state.range(0))};
+    size_t const num_measurements{2 * num_segments + 1};
+
+    PositionMeasurements measurements;
+    for (size_t i{0}; i < num_measurements; ++i) {
+        double const t{0.05 * i};
+        measurements.insert({i * delta_t_ns / 2, {{std::sin(t), std::cos(t), t}}});
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(InitializeC3SplineState(measurements, num_segments));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_InitializeC3SplineState)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+
+template <DerivativeOrder Derivative>
+static void BM_Se3SplineEvaluateLoop(benchmark::State& state) {
+    auto const [spline, times]{EvaluationData(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        std::vector<std::optional<Vector6d>> result;
+        result.reserve(std::size(times));
+        for (uint64_t const t_ns : times) {
+            result.push_back(spline.Evaluate(t_ns, Derivative));
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(times));
+}
+BENCHMARK_TEMPLATE(BM_Se3SplineEvaluateLoop, DerivativeOrder::Null)->Arg(100)->Arg(10'000);
+BENCHMARK_TEMPLATE(BM_Se3SplineEvaluateLoop, DerivativeOrder::Second)->Arg(100)->Arg(10'000);
+
+template <DerivativeOrder Derivative>
+static void BM_Se3SplineEvaluateMany(benchmark::State& state) {
+    auto const [spline, times]{EvaluationData(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(spline.EvaluateMany(times, Derivative));
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(times));
+}
+BENCHMARK_TEMPLATE(BM_Se3SplineEvaluateMany, DerivativeOrder::Null)->Arg(100)->Arg(10'000);
+BENCHMARK_TEMPLATE(BM_Se3SplineEvaluateMany, DerivativeOrder::Second)->Arg(100)->Arg(10'000);
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+
+#include "optimization/solver_progress.hpp"
 #include "spline/se3_spline.hpp"
 #include "spline/spline_state.hpp"
 #include "types/calibration_types.hpp"
@@ -22,11 +25,17 @@ namespace reprojection::calibration {
 std::optional<ArrayXd> InitializeIntrinsics(CameraModel camera_model, double height, double width,
                                             CameraMeasurements const& targets, int num_threads);
 
-Frames PoseInitialization(CameraInfo const& camera_info, CameraMeasurements const& targets,
-                          CameraState const& intrinsics);
+// NOTE(Jack): With sequential set the targets are treated as a sequence of frames (ex. a video), and every frame is
+// seeded from the poses of the frames before it instead of solved from scratch with the DLT. This is faster, but only
+// makes sense if the camera moves smoothly between the frames. Also returns the number of frames where the seeded
+// refinement was not good enough and the DLT was used after all (always zero if not sequential).
+std::pair<Frames, int> PoseInitialization(CameraInfo const& camera_info, CameraMeasurements const& targets,
+                                          CameraState const& intrinsics, bool sequential = false);
 
-std::pair<std::pair<Array3d, CeresState>, Vector3d> EstimateCameraImuAlignment(spline::Se3Spline const& spline,
-                                                                               ImuMeasurements const& imu_data,
-                                                                               int num_threads);
+// NOTE(Jack): The rotation is solved in closed form (see optimization::KabschAngularVelocityAlignment()). Only with
+// refine_rotation set is it then also refined with the ceres optimization, and only then is its CeresState returned.
+std::pair<std::pair<Array3d, std::optional<CeresState>>, Vector3d> EstimateCameraImuAlignment(
+    spline::Se3Spline const& spline, ImuMeasurements const& imu_data, int num_threads, bool refine_rotation = false,
+    optimization::SolverProgress* progress = nullptr);
 
 }  // namespace reprojection::calibration
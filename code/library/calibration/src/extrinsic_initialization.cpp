@@ -2,6 +2,7 @@
 
 #include <ranges>
 
+#include "geometry/lie.hpp"
 #include "optimization/angular_velocity_alignment.hpp"
 #include "spline/so3_spline.hpp"
 #include "spline/spline_evaluation.hpp"
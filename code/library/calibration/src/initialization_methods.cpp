@@ -2,9 +2,14 @@
 
 #include <algorithm>
 #include <map>
+#include <numeric>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <tuple>
 #include <vector>
 
+#include "concurrency/thread_budget.hpp"
 #include "geometry/lie.hpp"
 #include "logging/logging.hpp"
 #include "optimization/angular_velocity_alignment.hpp"
@@ -22,6 +27,11 @@ namespace {
 
 auto const log{logging::Get("calibration")};
 
+// NOTE(Jack): The sequential pose initialization splits the frames into chunks of this size which run in parallel, and
+// every chunk starts from the DLT. The chunk size is fixed instead of derived from the number of threads, so that the
+// result does not depend on the number of threads.
+std::size_t constexpr sequence_chunk_size{100};
+
 }
 
 // TODO(Jack): Should we parameterize the minimum number of samples (num_samples) and should we parameterize the number
@@ -62,7 +72,7 @@ std::optional<ArrayXd> InitializeIntrinsics(CameraModel const camera_model, doub
         CameraInfo const camera_info{camera_model, {0, width, 0, height}};
         ArrayXd const intrinsics_i{initialization(gamma_i, height, width)};
 
-        Frames const initial_poses{PoseInitialization(camera_info, target_subset, {intrinsics_i})};
+        auto const [initial_poses, _]{PoseInitialization(camera_info, target_subset, {intrinsics_i})};
         // TODO(Jack): Is the required success rate used in this condition enough, too much, or too little?
         if (std::size(initial_poses) < 0.8 * std::size(target_subset)) {
             continue;  // LCOV_EXCL_LINE
@@ -94,28 +104,63 @@ std::optional<ArrayXd> InitializeIntrinsics(CameraModel const camera_model, doub
 // of the function is to unproject the pixels to 3d rays using a roughly initialized camera, then project these back to
 // pixels using an ideal unit pinhole camera, which essentially undistorts them. Now that we have data that comes from
 // an equivalent pinhole camera we can apply dlt/pnp and get an initial pose.
-Frames PoseInitialization(CameraInfo const& camera_info, CameraMeasurements const& targets,
-                          CameraState const& intrinsics) {
+std::pair<Frames, int> PoseInitialization(CameraInfo const& camera_info, CameraMeasurements const& targets,
+                                          CameraState const& intrinsics, bool const sequential) {
     auto const camera{
         projection_functions::InitializeCamera(camera_info.camera_model, intrinsics.intrinsics, camera_info.bounds)};
 
-    Frames frames;
+    // NOTE(Jack): The frames are independent of each other, and the camera models are only read, therefore we can
+    // estimate all poses in parallel. Every frame writes only its own slot in the results, and the frames are collected
+    // into the map afterward in timestamp order, so the result does not depend on the number of threads.
+    std::vector<std::pair<uint64_t, Bundle const*>> bundles;
+    bundles.reserve(std::size(targets));
     for (auto const& [timestamp_ns, target_i] : targets) {
-        auto const pose{EstimatePoseViaPinholePnP(camera, target_i.bundle, camera_info.bounds)};
-        if (pose.has_value()) {
-            frames[timestamp_ns] = *pose;
+        bundles.push_back({timestamp_ns, &target_i.bundle});
+    }
+
+    std::vector<std::optional<FrameState>> poses(std::size(bundles));
+    int num_dlt_fallbacks{0};
+    if (sequential) {
+        int const num_chunks{static_cast<int>((std::size(bundles) + sequence_chunk_size - 1) / sequence_chunk_size)};
+        std::vector<int> num_fallbacks(num_chunks);
+        concurrency::SharedThreadPool().ParallelFor(num_chunks, [&](int const chunk) {
+            std::size_t const begin{chunk * sequence_chunk_size};
+            std::size_t const size{std::min(sequence_chunk_size, std::size(bundles) - begin)};
+
+            auto const [chunk_poses, chunk_fallbacks]{EstimatePosesViaSequentialPnP(
+                camera, std::span{bundles}.subspan(begin, size), camera_info.bounds)};
+            std::ranges::copy(chunk_poses, std::begin(poses) + begin);
+            num_fallbacks[chunk] = chunk_fallbacks;
+        });
+
+        num_dlt_fallbacks = std::accumulate(std::cbegin(num_fallbacks), std::cend(num_fallbacks), 0);
+    } else {
+        concurrency::SharedThreadPool().ParallelFor(static_cast<int>(std::size(bundles)), [&](int const i) {
+            poses[i] = EstimatePoseViaPinholePnP(camera, *bundles[i].second, camera_info.bounds);
+        });
+    }
+
+    Frames frames;
+    for (std::size_t i{0}; i < std::size(bundles); ++i) {
+        if (poses[i].has_value()) {
+            frames.insert(std::cend(frames), {bundles[i].first, *poses[i]});
         }
     }
 
-    return frames;
+    return {frames, num_dlt_fallbacks};
 }  // LCOV_EXCL_LINE
 
-std::pair<std::pair<Array3d, CeresState>, Vector3d> EstimateCameraImuAlignment(spline::Se3Spline const& spline,
-                                                                               ImuMeasurements const& imu_data,
-                                                                               int const num_threads) {
+std::pair<std::pair<Array3d, std::optional<CeresState>>, Vector3d> EstimateCameraImuAlignment(
+    spline::Se3Spline const& spline, ImuMeasurements const& imu_data, int const num_threads,
+    bool const refine_rotation, optimization::SolverProgress* const progress) {
     auto const imu_angular_velocity{ExtractAngularVelocity(imu_data)};
-    auto const [aa_imu_co,
-                diagnostics]{optimization::AngularVelocityAlignment(imu_angular_velocity, spline, num_threads)};
+    Array3d aa_imu_co{optimization::KabschAngularVelocityAlignment(imu_angular_velocity, spline)};
+
+    std::optional<CeresState> diagnostics{std::nullopt};
+    if (refine_rotation) {
+        std::tie(aa_imu_co, diagnostics) =
+            optimization::AngularVelocityAlignment(imu_angular_velocity, spline, aa_imu_co, num_threads, progress);
+    }
 
     Matrix3d const R_imu_co{geometry::Exp<double>(aa_imu_co)};
     auto const imu_linear_acceleration{ExtractLinearAcceleration(imu_data)};
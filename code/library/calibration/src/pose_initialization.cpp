@@ -1,5 +1,7 @@
 #include "pose_initialization.hpp"
 
+#include <algorithm>
+
 #include "eigen_utilities/grid.hpp"
 #include "geometry/lie.hpp"
 #include "pnp/pnp.hpp"
@@ -10,27 +12,123 @@ namespace reprojection::calibration {
 using Camera = projection_functions::Camera;
 using PinholeCamera = projection_functions::PinholeCamera;
 
-std::optional<FrameState> EstimatePoseViaPinholePnP(std::unique_ptr<Camera> const& camera, Bundle const& bundle,
-                                                    ImageBounds const& bounds) {
-    // Unproject to rays (pseudo 3D - no depth information) using the camera model provided by the user.
-    auto const [rays, mask_unproject]{camera->Unproject(bundle.pixels)};
+namespace {
+
+// NOTE(Jack): The camera is only ever read, therefore one instance can be shared by all calls, including the ones that
+// run in parallel.
+PinholeCamera const unit_pinhole_camera{{1, 0, 0}, {-1, 1, -1, 1}};
 
-    // Project the rays using a unit ideal pinhole camera to get undistorted/linearized pixels
-    auto const pinhole_camera{PinholeCamera({1, 0, 0}, {-1, 1, -1, 1})};
-    auto const [pixels, mask_project]{pinhole_camera.Project(rays)};
+// NOTE(Jack): A seeded refinement with a mean cost per point more than this factor above the one of the previous frame
+// most likely converged to the wrong minimum, for example because the camera moved much more than predicted.
+double constexpr max_cost_jump{10};
+// Lower limit for the previous mean cost the jump is measured against. Noise free data has a cost of practically zero,
+// which would make every bit of rounding noise a jump. In unit image coordinates 1e-10 is a residual of about 0.01
+// pixels for a focal length of 600.
+double constexpr min_mean_cost{1e-10};
+
+// Unproject to rays (pseudo 3D - no depth information) using the camera model provided by the user, and project the
+// rays using a unit ideal pinhole camera to get undistorted/linearized pixels. Only the points that survive both are
+// kept.
+Bundle LinearizeBundle(Camera const& camera, Bundle const& bundle) {
+    auto const [rays, mask_unproject]{camera.Unproject(bundle.pixels)};
+    auto const [pixels, mask_project]{unit_pinhole_camera.Project(rays)};
 
-    // Combine the masks and make a new bundle from only the valid reprojected points.
     ArrayXb const mask{mask_unproject * mask_project};
     ArrayXi const valid_indices{eigen_utilities::MaskToRowId(mask)};
-    Bundle const linearized_bundle{pixels(valid_indices, Eigen::all), bundle.points(valid_indices, Eigen::all)};
 
-    auto const result{pnp::Pnp(linearized_bundle, bounds)};
+    return Bundle{pixels(valid_indices, Eigen::all), bundle.points(valid_indices, Eigen::all)};
+}
+
+using TimedPose = std::pair<uint64_t, Isometry3d>;
+
+// Constant velocity prediction of the pose at timestamp_ns. The motion between the two previous frames is scaled to the
+// time between the previous and the current frame, which also handles frames that were skipped because no target was
+// found in them.
+Isometry3d PredictPose(TimedPose const& previous, std::optional<TimedPose> const& before_previous,
+                       uint64_t const timestamp_ns) {
+    if (not before_previous) {
+        return previous.second;
+    }
+
+    auto const& [t1, tf_co1_w]{previous};
+    auto const& [t0, tf_co0_w]{*before_previous};
+
+    Isometry3d const tf_co1_co0{tf_co1_w * tf_co0_w.inverse()};
+    double const scale{static_cast<double>(timestamp_ns - t1) / static_cast<double>(t1 - t0)};
+
+    return geometry::Exp(scale * geometry::Log(tf_co1_co0)) * tf_co1_w;
+}
+
+std::optional<pnp::PoseWithCost> ToOptional(pnp::PnpResult const& result) {
     if (std::holds_alternative<pnp::PoseWithCost>(result)) {
-        auto const [tf_co_w, cost]{std::get<pnp::PoseWithCost>(result)};
-        return FrameState{geometry::Log(tf_co_w)};
+        return std::get<pnp::PoseWithCost>(result);
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace
+
+std::optional<FrameState> EstimatePoseViaPinholePnP(std::unique_ptr<Camera> const& camera, Bundle const& bundle,
+                                                    ImageBounds const& bounds) {
+    auto const result{ToOptional(pnp::Pnp(LinearizeBundle(*camera, bundle), bounds))};
+    if (result) {
+        return FrameState{geometry::Log(result->first)};
     } else {
         return std::nullopt;  // LCOV_EXCL_LINE
     }
 }
 
-}  // namespace reprojection::calibration
+std::pair<std::vector<std::optional<FrameState>>, int> EstimatePosesViaSequentialPnP(
+    std::unique_ptr<Camera> const& camera, std::span<std::pair<uint64_t, Bundle const*> const> sequence,
+    ImageBounds const& bounds) {
+    std::vector<std::optional<FrameState>> poses;
+    poses.reserve(std::size(sequence));
+    int num_fallbacks{0};
+
+    std::optional<TimedPose> previous;
+    std::optional<TimedPose> before_previous;
+    double previous_mean_cost{0};
+
+    for (auto const& [timestamp_ns, bundle] : sequence) {
+        Bundle const linearized_bundle{LinearizeBundle(*camera, *bundle)};
+        double const num_points{static_cast<double>(std::max<Eigen::Index>(linearized_bundle.pixels.rows(), 1))};
+
+        std::optional<pnp::PoseWithCost> result;
+        std::optional<pnp::PoseWithCost> seeded_result;
+        if (previous) {
+            seeded_result = ToOptional(
+                pnp::SeededPnp(linearized_bundle, PredictPose(*previous, before_previous, timestamp_ns)));
+            if (seeded_result and
+                seeded_result->second / num_points <= max_cost_jump * std::max(previous_mean_cost, min_mean_cost)) {
+                result = seeded_result;
+            } else {
+                ++num_fallbacks;
+            }
+        }
+
+        if (not result) {
+            result = ToOptional(pnp::Pnp(linearized_bundle, bounds));
+
+            // NOTE(Jack): If the seeded refinement only failed because of the cost jump, it can still be the better
+            // one of the two.
+            if (seeded_result and (not result or seeded_result->second < result->second)) {
+                result = seeded_result;
+            }
+        }
+
+        if (not result) {
+            poses.push_back(std::nullopt);  // LCOV_EXCL_LINE
+            continue;                       // LCOV_EXCL_LINE
+        }
+
+        before_previous = previous;
+        previous = TimedPose{timestamp_ns, result->first};
+        previous_mean_cost = result->second / num_points;
+        poses.push_back(FrameState{geometry::Log(result->first)});
+    }
+
+    return {poses, num_fallbacks};
+}
+
+}  // namespace reprojection::calibration
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <span>
+#include <utility>
+#include <vector>
+
 #include "projection_functions/camera_model.hpp"
 #include "types/calibration_types.hpp"
 
@@ -9,4 +13,13 @@ namespace reprojection::calibration {
 std::optional<FrameState> EstimatePoseViaPinholePnP(std::unique_ptr<projection_functions::Camera> const& camera,
                                                     Bundle const& target, ImageBounds const& bounds);
 
-}  // namespace reprojection::calibration
+// NOTE(Jack): For a sequence of frames in time order (ex. a video) the pose of a frame is almost the same as the one of
+// the frame before it. Therefore, instead of solving every frame from scratch with the DLT, we refine each frame
+// starting from a constant velocity prediction based on the previous two poses. Only if that refinement fails or its
+// cost jumps compared to the previous frame do we fall back to the DLT. Returns the poses in the order of the sequence
+// (nullopt where no pose was found) and the number of DLT fallbacks.
+std::pair<std::vector<std::optional<FrameState>>, int> EstimatePosesViaSequentialPnP(
+    std::unique_ptr<projection_functions::Camera> const& camera,
+    std::span<std::pair<uint64_t, Bundle const*> const> sequence, ImageBounds const& bounds);
+
+}  // namespace reprojection::calibration
\ No newline at end of file
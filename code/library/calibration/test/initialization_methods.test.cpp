@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include "concurrency/thread_budget.hpp"
+#include "geometry/lie.hpp"
 #include "projection_functions/camera_model.hpp"
 #include "testing_mocks/data_generators.hpp"
 #include "testing_utilities/constants.hpp"
@@ -28,7 +30,7 @@ TEST(CalibrationInitializationMethods, TestPoseInitialization) {
     auto const [targets, gt_frames]{testing_mocks::GenerateMvgData(camera_info, intrinsics, 60, 1)};
 
     // Act
-    Frames const linear_solution{calibration::PoseInitialization(camera_info, targets, intrinsics)};
+    auto const [linear_solution, _]{calibration::PoseInitialization(camera_info, targets, intrinsics)};
 
     // Assert
     EXPECT_EQ(std::size(linear_solution), 56);
@@ -40,17 +42,71 @@ TEST(CalibrationInitializationMethods, TestPoseInitialization) {
     }
 }
 
+TEST(CalibrationInitializationMethods, TestPoseInitializationThreadIndependent) {
+    CameraInfo const camera_info{CameraModel::DoubleSphere, testing_utilities::image_bounds};
+    CameraState const intrinsics{testing_utilities::double_sphere_intrinsics};
+    auto const [targets, _]{testing_mocks::GenerateMvgData(camera_info, intrinsics, 60, 1)};
+
+    int const thread_limit{concurrency::ThreadLimit()};
+    concurrency::SetThreadLimit(1);
+    Frames const serial_solution{calibration::PoseInitialization(camera_info, targets, intrinsics).first};
+    concurrency::SetThreadLimit(4);
+    Frames const parallel_solution{calibration::PoseInitialization(camera_info, targets, intrinsics).first};
+    concurrency::SetThreadLimit(thread_limit);  // Do not leak the limit into the other tests
+
+    // Every frame is solved exactly the same way no matter which thread it runs on, so the results are bit identical.
+    ASSERT_EQ(std::size(parallel_solution), std::size(serial_solution));
+    for (auto const& [timestamp_ns, frame_i] : serial_solution) {
+        EXPECT_TRUE((parallel_solution.at(timestamp_ns).pose == frame_i.pose).all());
+    }
+}
+
+TEST(CalibrationInitializationMethods, TestSequentialPoseInitialization) {
+    CameraInfo const camera_info{CameraModel::DoubleSphere, testing_utilities::image_bounds};
+    CameraState const intrinsics{testing_utilities::double_sphere_intrinsics};
+    auto const [targets, gt_frames]{testing_mocks::GenerateMvgData(camera_info, intrinsics, 10, 30)};
+
+    auto const [independent_solution, independent_fallbacks]{
+        calibration::PoseInitialization(camera_info, targets, intrinsics, false)};
+    EXPECT_EQ(independent_fallbacks, 0);
+    auto const [sequential_solution, sequential_fallbacks]{
+        calibration::PoseInitialization(camera_info, targets, intrinsics, true)};
+    // The mock camera moves smoothly and the data is noise free, so the seeded refinement is always used.
+    EXPECT_EQ(sequential_fallbacks, 0);
+
+    // The seeded refinement stops at the same tolerances as the DLT based one, so the poses are the same up to those.
+    ASSERT_EQ(std::size(sequential_solution), std::size(independent_solution));
+    for (auto const& [timestamp_ns, frame_i] : sequential_solution) {
+        Array6d const gt_aa_co_w{gt_frames.at(timestamp_ns).pose};
+        EXPECT_TRUE(frame_i.pose.isApprox(gt_aa_co_w, 1e-8)) << "Sequential pose initialization result:\n"
+                                                             << frame_i.pose.transpose() << "\nGround truth:\n"
+                                                             << gt_aa_co_w.transpose();
+    }
+}
+
 TEST(CalibrationInitializationMethods, TestEstimateCameraImuAlignment) {
     auto [imu_data, spline_w_b]{testing_mocks::GenerateImuData(10, 50)};
 
-    auto const [rotation_result, gravity_w]{calibration::EstimateCameraImuAlignment(spline_w_b, imu_data, 1)};
+    auto const [rotation_result, gravity_w]{calibration::EstimateCameraImuAlignment(spline_w_b, imu_data, 1, true)};
     auto const [aa_imu_co, diagnostics]{rotation_result};
 
     // Heuristic! I wish it was really exactly the identity matrix, but it's a little off.
     EXPECT_TRUE(geometry::Exp<double>(aa_imu_co).isApprox(Matrix3d::Identity(), 1e-3));
 
-    EXPECT_EQ(diagnostics.solver_summary.termination_type, ceres::CONVERGENCE);
+    ASSERT_TRUE(diagnostics.has_value());
+    EXPECT_EQ(diagnostics->solver_summary.termination_type, ceres::CONVERGENCE);
     EXPECT_FLOAT_EQ(gravity_w.norm(), kGravity);
     Vector3d const heuristic_gravity_w{0.00747, 0.01796, 9.80663};
     EXPECT_TRUE(gravity_w.isApprox(heuristic_gravity_w, 1e-4));
+}
+
+TEST(CalibrationInitializationMethods, TestEstimateCameraImuAlignmentClosedForm) {
+    auto [imu_data, spline_w_b]{testing_mocks::GenerateImuData(10, 50)};
+
+    auto const [rotation_result, gravity_w]{calibration::EstimateCameraImuAlignment(spline_w_b, imu_data, 1)};
+    auto const [aa_imu_co, diagnostics]{rotation_result};
+
+    EXPECT_TRUE(geometry::Exp<double>(aa_imu_co).isApprox(Matrix3d::Identity(), 1e-3));
+    EXPECT_FALSE(diagnostics.has_value());
+    EXPECT_FLOAT_EQ(gravity_w.norm(), kGravity);
 }
\ No newline at end of file
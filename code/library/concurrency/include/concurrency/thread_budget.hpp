@@ -0,0 +1,25 @@
+#pragma once
+
+#include "concurrency/thread_pool.hpp"
+
+namespace reprojection::concurrency {
+
+// NOTE(Jack): The thread limit is the total number of threads the process should keep busy at the same time, across
+// the ceres solves, feature extraction and image decoding. Every subsystem that would otherwise pick its own number of
+// threads asks ThreadBudget() instead, and all of our own parallel work runs on the SharedThreadPool(), so that steps or
+// hypotheses which run at the same time do not each spin up their own threads and oversubscribe the machine. This
+// matters most on shared CI runners, where hardware_concurrency() reports the cores of the host and not our share of
+// them. The default limit is hardware_concurrency().
+
+// WARN(Jack): Replaces the shared thread pool, therefore this must not be called while anything is running on it.
+void SetThreadLimit(int const max_threads);
+
+int ThreadLimit();
+
+// The number of threads a subsystem that requested the given number of threads should use, clamped to [1, limit].
+int ThreadBudget(int const requested);
+
+// The pool has ThreadLimit() - 1 workers, because the thread calling ThreadPool::ParallelFor() also does work.
+ThreadPool& SharedThreadPool();
+
+}  // namespace reprojection::concurrency
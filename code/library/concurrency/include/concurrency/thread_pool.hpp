@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace reprojection::concurrency {
+
+/**
+ * \brief Work stealing thread pool.
+ *
+ * Every worker has its own task queue. Tasks submitted from a worker (i.e. from inside another task) go to the queue of
+ * that worker, all other tasks are distributed round-robin over the queues. A worker takes the newest task from its
+ * own queue and, once that is empty, steals the oldest task from the queue of another worker.
+ *
+ * ParallelFor() is the main interface. The calling thread works on the loop itself instead of only waiting for it,
+ * which means a ParallelFor() can be nested inside of a task without the risk of a deadlock, and that a pool with zero
+ * workers simply runs everything on the calling thread.
+ *
+ * The destructor runs all tasks that are still queued before it joins the workers.
+ */
+class ThreadPool {
+   public:
+    explicit ThreadPool(int const num_workers);
+
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    int NumWorkers() const;
+
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> Submit(F&& task) {
+        std::packaged_task<std::invoke_result_t<std::decay_t<F>>()> packaged_task{std::forward<F>(task)};
+        auto future{packaged_task.get_future()};
+        Push([packaged_task = std::move(packaged_task)]() mutable { packaged_task(); });
+
+        return future;
+    }
+
+    // Calls body(i) for every i in [0, n) and returns once all calls are finished. The first exception thrown by body
+    // is rethrown here, after all other calls have finished.
+    void ParallelFor(int const n, std::function<void(int)> const& body);
+
+   private:
+    using Task = std::move_only_function<void()>;
+
+    void Push(Task task);
+
+    std::optional<Task> Pop(std::size_t const queue_id);
+
+    void WorkerLoop(std::stop_token const& stop_token, std::size_t const queue_id);
+
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::atomic<std::size_t> next_queue_{0};
+    std::atomic<int> num_queued_{0};
+
+    std::mutex wake_mutex_;
+    std::condition_variable_any wake_;
+
+    // NOTE(Jack): Must be the last member so the threads are joined before anything they touch is destroyed.
+    std::vector<std::jthread> workers_;
+};
+
+}  // namespace reprojection::concurrency
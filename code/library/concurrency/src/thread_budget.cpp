@@ -0,0 +1,45 @@
+#include "concurrency/thread_budget.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace reprojection::concurrency {
+
+namespace {
+
+std::mutex budget_mutex;
+int thread_limit{std::max(1, static_cast<int>(std::thread::hardware_concurrency()))};
+std::unique_ptr<ThreadPool> shared_pool;
+
+}  // namespace
+
+void SetThreadLimit(int const max_threads) {
+    std::unique_ptr<ThreadPool> old_pool;
+    {
+        std::lock_guard const lock{budget_mutex};
+        thread_limit = std::max(1, max_threads);
+        std::swap(old_pool, shared_pool);
+    }
+
+    // The old pool is joined here, outside of the lock.
+}
+
+int ThreadLimit() {
+    std::lock_guard const lock{budget_mutex};
+    return thread_limit;
+}
+
+int ThreadBudget(int const requested) { return std::clamp(requested, 1, ThreadLimit()); }
+
+ThreadPool& SharedThreadPool() {
+    std::lock_guard const lock{budget_mutex};
+    if (not shared_pool) {
+        shared_pool = std::make_unique<ThreadPool>(thread_limit - 1);
+    }
+
+    return *shared_pool;
+}
+
+}  // namespace reprojection::concurrency
@@ -0,0 +1,156 @@
+#include "concurrency/thread_pool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace reprojection::concurrency {
+
+namespace {
+
+// The pool and queue of the worker that is running on this thread, if any.
+thread_local ThreadPool const* current_pool{nullptr};
+thread_local std::size_t current_queue{0};
+
+}  // namespace
+
+ThreadPool::ThreadPool(int const num_workers) {
+    for (int i{0}; i < num_workers; ++i) {
+        queues_.push_back(std::make_unique<TaskQueue>());
+    }
+
+    // NOTE(Jack): Start the workers only after all queues exist, because a worker steals from all of them.
+    for (std::size_t i{0}; i < std::size(queues_); ++i) {
+        workers_.emplace_back([this, i](std::stop_token const stop_token) { WorkerLoop(stop_token, i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    for (auto& worker : workers_) {
+        worker.request_stop();
+    }
+
+    // NOTE(Jack): Join explicitly instead of clearing workers_, because a task that is still running might push a
+    // follow-up task, and Push() reads workers_.
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+int ThreadPool::NumWorkers() const { return static_cast<int>(std::size(workers_)); }
+
+void ThreadPool::ParallelFor(int const n, std::function<void(int)> const& body) {
+    if (n <= 0) {
+        return;
+    }
+
+    // NOTE(Jack): The helper tasks might only start running after this function returned (ex. if all workers are busy
+    // and the calling thread did all the work itself). Therefore, the state they share is reference counted, and body
+    // is only touched after successfully claiming an index, which is impossible once we returned.
+    struct LoopState {
+        std::atomic<int> next{0};
+        std::atomic<int> done{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::exception_ptr error;
+    };
+    auto const state{std::make_shared<LoopState>()};
+
+    auto const run{[state, &body, n]() {
+        for (int i{state->next++}; i < n; i = state->next++) {
+            try {
+                body(i);
+            } catch (...) {
+                std::lock_guard const lock{state->mutex};
+                if (not state->error) {
+                    state->error = std::current_exception();
+                }
+            }
+
+            if (++state->done == n) {
+                std::lock_guard const lock{state->mutex};
+                state->finished.notify_all();
+            }
+        }
+    }};
+
+    int const num_helpers{std::min(n - 1, NumWorkers())};
+    for (int i{0}; i < num_helpers; ++i) {
+        Push(run);
+    }
+    run();
+
+    std::unique_lock lock{state->mutex};
+    state->finished.wait(lock, [&state, n]() { return state->done == n; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+void ThreadPool::Push(Task task) {
+    if (workers_.empty()) {
+        task();
+        return;
+    }
+
+    std::size_t const queue_id{current_pool == this ? current_queue : next_queue_++ % std::size(queues_)};
+    {
+        std::lock_guard const lock{queues_[queue_id]->mutex};
+        queues_[queue_id]->tasks.push_back(std::move(task));
+    }
+
+    {
+        // NOTE(Jack): Taking the wake mutex here makes sure a worker cannot miss the notification between checking
+        // num_queued_ and going to sleep.
+        std::lock_guard const lock{wake_mutex_};
+        ++num_queued_;
+    }
+    wake_.notify_one();
+}
+
+std::optional<ThreadPool::Task> ThreadPool::Pop(std::size_t const queue_id) {
+    {
+        TaskQueue& own{*queues_[queue_id]};
+        std::lock_guard const lock{own.mutex};
+        if (not own.tasks.empty()) {
+            Task task{std::move(own.tasks.back())};
+            own.tasks.pop_back();
+            --num_queued_;
+
+            return task;
+        }
+    }
+
+    for (std::size_t i{1}; i < std::size(queues_); ++i) {
+        TaskQueue& victim{*queues_[(queue_id + i) % std::size(queues_)]};
+        std::lock_guard const lock{victim.mutex};
+        if (not victim.tasks.empty()) {
+            Task task{std::move(victim.tasks.front())};
+            victim.tasks.pop_front();
+            --num_queued_;
+
+            return task;
+        }
+    }
+
+    return std::nullopt;
+}
+
+void ThreadPool::WorkerLoop(std::stop_token const& stop_token, std::size_t const queue_id) {
+    current_pool = this;
+    current_queue = queue_id;
+
+    while (true) {
+        if (auto task{Pop(queue_id)}) {
+            (*task)();
+            continue;
+        }
+
+        std::unique_lock lock{wake_mutex_};
+        if (stop_token.stop_requested() and num_queued_ == 0) {
+            break;
+        }
+        wake_.wait(lock, stop_token, [this]() { return num_queued_ > 0; });
+    }
+}
+
+}  // namespace reprojection::concurrency
@@ -0,0 +1,21 @@
+#include "concurrency/thread_budget.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace reprojection;
+
+TEST(ConcurrencyThreadBudget, TestThreadBudget) {
+    concurrency::SetThreadLimit(4);
+    EXPECT_EQ(concurrency::ThreadLimit(), 4);
+    EXPECT_EQ(concurrency::ThreadBudget(2), 2);
+    EXPECT_EQ(concurrency::ThreadBudget(10), 4);
+    EXPECT_EQ(concurrency::ThreadBudget(0), 1);
+
+    // The calling thread is the last of the four threads.
+    EXPECT_EQ(concurrency::SharedThreadPool().NumWorkers(), 3);
+
+    // A limit below one makes no sense, we always have at least the calling thread.
+    concurrency::SetThreadLimit(0);
+    EXPECT_EQ(concurrency::ThreadLimit(), 1);
+    EXPECT_EQ(concurrency::SharedThreadPool().NumWorkers(), 0);
+}
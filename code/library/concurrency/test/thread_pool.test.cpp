@@ -0,0 +1,87 @@
+#include "concurrency/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace reprojection;
+
+TEST(ConcurrencyThreadPool, TestSubmit) {
+    concurrency::ThreadPool pool{2};
+    EXPECT_EQ(pool.NumWorkers(), 2);
+
+    auto result{pool.Submit([]() { return 42; })};
+    EXPECT_EQ(result.get(), 42);
+
+    auto error{pool.Submit([]() -> int { throw std::runtime_error("task failed"); })};
+    EXPECT_THROW(error.get(), std::runtime_error);
+}
+
+TEST(ConcurrencyThreadPool, TestParallelFor) {
+    concurrency::ThreadPool pool{3};
+
+    std::vector<int> data(1000, 0);
+    pool.ParallelFor(std::ssize(data), [&data](int const i) { data[i] = i; });
+
+    std::vector<int> gt_data(1000);
+    std::iota(std::begin(gt_data), std::end(gt_data), 0);
+    EXPECT_EQ(data, gt_data);
+
+    // Nothing to do is no problem.
+    EXPECT_NO_THROW(pool.ParallelFor(0, [](int const) { throw std::runtime_error("never called"); }));
+}
+
+TEST(ConcurrencyThreadPool, TestParallelForNested) {
+    concurrency::ThreadPool pool{2};
+
+    // More outer iterations than workers, so every worker blocks in the inner loop - the calling threads doing the work
+    // themselves is what prevents the deadlock here.
+    std::atomic<int> count{0};
+    pool.ParallelFor(8, [&pool, &count](int const) { pool.ParallelFor(8, [&count](int const) { ++count; }); });
+    EXPECT_EQ(count, 64);
+}
+
+TEST(ConcurrencyThreadPool, TestParallelForException) {
+    concurrency::ThreadPool pool{2};
+
+    std::atomic<int> count{0};
+    EXPECT_THROW(pool.ParallelFor(100,
+                                  [&count](int const i) {
+                                      ++count;
+                                      if (i == 50) {
+                                          throw std::runtime_error("body failed");
+                                      }
+                                  }),
+                 std::runtime_error);
+
+    // The other iterations still all ran.
+    EXPECT_EQ(count, 100);
+}
+
+TEST(ConcurrencyThreadPool, TestNoWorkers) {
+    concurrency::ThreadPool pool{0};
+    EXPECT_EQ(pool.NumWorkers(), 0);
+
+    // Everything runs on the calling thread.
+    std::set<std::thread::id> thread_ids;
+    pool.ParallelFor(10, [&thread_ids](int const) { thread_ids.insert(std::this_thread::get_id()); });
+    EXPECT_EQ(thread_ids, std::set{std::this_thread::get_id()});
+
+    EXPECT_EQ(pool.Submit([]() { return 1; }).get(), 1);
+}
+
+TEST(ConcurrencyThreadPool, TestDestructorRunsQueuedTasks) {
+    std::atomic<int> count{0};
+    {
+        concurrency::ThreadPool pool{1};
+        for (int i{0}; i < 100; ++i) {
+            pool.Submit([&count]() { ++count; });
+        }
+    }
+
+    EXPECT_EQ(count, 100);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <optional>
 #include <string>
 #include <thread>
 
@@ -23,6 +24,42 @@ struct Config {
 
         bool show_extraction{false};
         int threads{std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1)};
+        // NOTE(Jack): At time of writing (19.10.2026) the following two are only used by the video file application.
+        // frame_stride=n means we only load every n-th frame, and video_segments=n means a video file is split into n
+        // segments which are decoded in parallel. See video_capture::FrameSource for the details.
+        int frame_stride{1};
+        int video_segments{1};
+        // NOTE(Jack): The maximum time in seconds each optimization is allowed to run for, after which it returns the
+        // best result found so far. Such an early stopped result is not cached, the next run solves again.
+        std::optional<double> solver_time_budget_s{std::nullopt};
+        // NOTE(Jack): Start the bundle adjustment from the most recent bundle adjustment result of the same camera in
+        // the database instead of from the initialization. See steps::BundleAdjustment for the details.
+        bool warm_start{false};
+        // NOTE(Jack): Upper limit for the total number of threads the process uses at the same time, across all ceres
+        // solves, feature extraction and image decoding. Without it the limit is hardware_concurrency(), which on a
+        // shared CI runner is usually far more than our share of the machine. See concurrency::SetThreadLimit().
+        std::optional<int> max_threads{std::nullopt};
+        // NOTE(Jack): Seed the pose of every frame from the frames before it instead of solving each one from scratch.
+        // Only makes sense if the data is a continuous sequence like a video. See calibration::PoseInitialization().
+        bool sequential_pose_initialization{false};
+        // NOTE(Jack): Average the IMU samples down to this many measurements per spline segment before the extrinsic
+        // optimization, instead of adding residuals for every single sample. See optimization::AggregateImuData().
+        std::optional<int> imu_samples_per_segment{std::nullopt};
+        // NOTE(Jack): Length in seconds of the windows the extrinsic optimization solves the spline in, one after the
+        // other, instead of all at once. See optimization::SlidingWindowExtrinsicOptimization().
+        std::optional<double> extrinsic_window_s{std::nullopt};
+        // NOTE(Jack): Knot frequency of the spline that the extrinsic optimization solves for, 100Hz if not set.
+        std::optional<int> spline_knot_frequency_hz{std::nullopt};
+        // NOTE(Jack): Place the knots non-uniformly, between this frequency where the camera barely moves and
+        // spline_knot_frequency_hz where it moves the most. See spline::AdaptiveKnots().
+        std::optional<int> spline_min_knot_frequency_hz{std::nullopt};
+        // NOTE(Jack): Solve the extrinsic optimization at this many halvings of the knot frequency first and refine it
+        // level by level. Ignored if extrinsic_window_s is set. See optimization::CoarseToFineExtrinsicOptimization().
+        std::optional<int> extrinsic_spline_levels{std::nullopt};
+        // NOTE(Jack): Refine the closed form camera-IMU rotation of the extrinsic initialization with a ceres
+        // optimization. Both minimize the same cost, so this is rarely worth it. See
+        // calibration::EstimateCameraImuAlignment().
+        bool extrinsic_init_refinement{false};
     };
 
     struct Camera {
@@ -49,6 +86,22 @@ struct Config {
         bool asymmetric{false};
     };
 
+    // NOTE(Jack): Per optimization override of the ceres linear solver and preconditioner, which are otherwise selected
+    // automatically from the structure and size of the problem. The names are the ceres enum names (ex. "SPARSE_SCHUR")
+    // and are only validated when they are applied, see optimization::SetSolverOverride().
+    struct Solver {
+        static Solver Parse(toml::table const& table);
+
+        struct Override {
+            std::optional<std::string> linear_solver{std::nullopt};
+            std::optional<std::string> preconditioner{std::nullopt};
+        };
+
+        Override angular_velocity_alignment;
+        Override bundle_adjustment;
+        Override extrinsic_optimization;
+    };
+
     // NOTE(Jack): At a high level there are three kinds of config "requirements"
     //
     //  1) required
@@ -73,6 +126,7 @@ struct Config {
     Camera camera;
     std::optional<Imu> imu;
     Target target;
+    Solver solver;
 };
 
 }  // namespace reprojection::config
\ No newline at end of file
@@ -11,21 +11,43 @@ namespace reprojection::config {
 // at multiple places which is not so nice. Not a deal breaker but consider it!
 
 Config Config::Parse(toml::table const& table) {
-    RejectUnexpectedKeys(table, {"application", "camera", "imu", "target"}, "");
+    RejectUnexpectedKeys(table, {"application", "camera", "imu", "target", "solver"}, "");
 
     return Config{Application::Parse(OptionalTable(table, "application").value_or(toml::table{})),
                   Camera::Parse(RequireTable(table, "camera")),
                   Imu::Parse(OptionalTable(table, "imu").value_or(toml::table{})),
-                  Target::Parse(RequireTable(table, "target"))};
+                  Target::Parse(RequireTable(table, "target")),
+                  Solver::Parse(OptionalTable(table, "solver").value_or(toml::table{}))};
 }
 
 // The table is not required, but we have sensible defaults.
 Config::Application Config::Application::Parse(toml::table const& table) {
-    RejectUnexpectedKeys(table, {"show_extraction", "threads"}, "application");
+    RejectUnexpectedKeys(table,
+                         {"show_extraction", "threads", "frame_stride", "video_segments", "solver_time_budget_s",
+                          "warm_start", "max_threads", "sequential_pose_initialization", "imu_samples_per_segment",
+                          "extrinsic_window_s", "spline_knot_frequency_hz", "spline_min_knot_frequency_hz",
+                          "extrinsic_spline_levels", "extrinsic_init_refinement"},
+                         "application");
 
     Application config{};
     OverrideIfPresent(table, "show_extraction", config.show_extraction);
     OverrideIfPresent(table, "threads", config.threads);
+    OverrideIfPresent(table, "frame_stride", config.frame_stride);
+    OverrideIfPresent(table, "video_segments", config.video_segments);
+    config.solver_time_budget_s = Optional<double>(table, "solver_time_budget_s");
+    OverrideIfPresent(table, "warm_start", config.warm_start);
+    config.max_threads = Optional<int>(table, "max_threads");
+    OverrideIfPresent(table, "sequential_pose_initialization", config.sequential_pose_initialization);
+    config.imu_samples_per_segment = Optional<int>(table, "imu_samples_per_segment");
+    if (config.imu_samples_per_segment and *config.imu_samples_per_segment <= 0) {
+        throw std::runtime_error(std::format("Invalid value for key 'imu_samples_per_segment' - Expected > 0, got {}",
+                                             *config.imu_samples_per_segment));
+    }
+    config.extrinsic_window_s = Optional<double>(table, "extrinsic_window_s");
+    config.spline_knot_frequency_hz = Optional<int>(table, "spline_knot_frequency_hz");
+    config.spline_min_knot_frequency_hz = Optional<int>(table, "spline_min_knot_frequency_hz");
+    config.extrinsic_spline_levels = Optional<int>(table, "extrinsic_spline_levels");
+    OverrideIfPresent(table, "extrinsic_init_refinement", config.extrinsic_init_refinement);
 
     return config;
 }
@@ -73,4 +95,24 @@ Config::Target Config::Target::Parse(toml::table const& table) {
     return config;
 }
 
+// The table is not required, without it the solvers are selected automatically.
+Config::Solver Config::Solver::Parse(toml::table const& table) {
+    RejectUnexpectedKeys(table, {"angular_velocity_alignment", "bundle_adjustment", "extrinsic_optimization"},
+                         "solver");
+
+    auto const parse_override{[&table](std::string const& key) {
+        Override config{};
+        if (auto const override_table{OptionalTable(table, key)}) {
+            RejectUnexpectedKeys(*override_table, {"linear_solver", "preconditioner"}, "solver." + key);
+            config.linear_solver = Optional<std::string>(*override_table, "linear_solver");
+            config.preconditioner = Optional<std::string>(*override_table, "preconditioner");
+        }
+
+        return config;
+    }};
+
+    return Solver{parse_override("angular_velocity_alignment"), parse_override("bundle_adjustment"),
+                  parse_override("extrinsic_optimization")};
+}
+
 }  // namespace reprojection::config
\ No newline at end of file
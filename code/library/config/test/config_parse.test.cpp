@@ -9,6 +9,18 @@ TEST(ConfigParsingHelpers, TestConfigParseFull) {
         [application]
         show_extraction = true
         threads = 10
+        frame_stride = 2
+        video_segments = 4
+        solver_time_budget_s = 60.0
+        warm_start = true
+        max_threads = 4
+        sequential_pose_initialization = true
+        imu_samples_per_segment = 4
+        extrinsic_window_s = 120.0
+        spline_knot_frequency_hz = 200
+        spline_min_knot_frequency_hz = 20
+        extrinsic_spline_levels = 2
+        extrinsic_init_refinement = true
 
         [camera]
         sensor_name = "/cam0/image_raw"
@@ -24,12 +36,31 @@ TEST(ConfigParsingHelpers, TestConfigParseFull) {
 
         [target.circle_grid]
         asymmetric = true
+
+        [solver.bundle_adjustment]
+        linear_solver = "SPARSE_SCHUR"
+        preconditioner = "SCHUR_JACOBI"
+
+        [solver.extrinsic_optimization]
+        linear_solver = "SPARSE_NORMAL_CHOLESKY"
     )"};
     toml::table const full_config{toml::parse(full_table)};
     auto const result = config::Config::Parse(full_config);
 
     EXPECT_EQ(result.application.show_extraction, true);
     EXPECT_EQ(result.application.threads, 10);
+    EXPECT_EQ(result.application.frame_stride, 2);
+    EXPECT_EQ(result.application.video_segments, 4);
+    EXPECT_EQ(result.application.solver_time_budget_s, 60.0);
+    EXPECT_EQ(result.application.warm_start, true);
+    EXPECT_EQ(result.application.max_threads, 4);
+    EXPECT_EQ(result.application.sequential_pose_initialization, true);
+    EXPECT_EQ(result.application.imu_samples_per_segment, 4);
+    EXPECT_EQ(result.application.extrinsic_window_s, 120.0);
+    EXPECT_EQ(result.application.spline_knot_frequency_hz, 200);
+    EXPECT_EQ(result.application.spline_min_knot_frequency_hz, 20);
+    EXPECT_EQ(result.application.extrinsic_spline_levels, 2);
+    EXPECT_EQ(result.application.extrinsic_init_refinement, true);
 
     EXPECT_EQ(result.camera.sensor_name, "/cam0/image_raw");
     EXPECT_EQ(result.camera.camera_model, CameraModel::DoubleSphere);
@@ -42,6 +73,12 @@ TEST(ConfigParsingHelpers, TestConfigParseFull) {
     EXPECT_EQ(result.target.size[1], 4);
     EXPECT_EQ(result.target.unit_dimension, 0.5);
     EXPECT_EQ(result.target.asymmetric, true);
+
+    EXPECT_FALSE(result.solver.angular_velocity_alignment.linear_solver.has_value());
+    EXPECT_EQ(result.solver.bundle_adjustment.linear_solver, "SPARSE_SCHUR");
+    EXPECT_EQ(result.solver.bundle_adjustment.preconditioner, "SCHUR_JACOBI");
+    EXPECT_EQ(result.solver.extrinsic_optimization.linear_solver, "SPARSE_NORMAL_CHOLESKY");
+    EXPECT_FALSE(result.solver.extrinsic_optimization.preconditioner.has_value());
 }
 
 TEST(ConfigParsingHelpers, TestConfigParseMinimum) {
@@ -59,6 +96,18 @@ TEST(ConfigParsingHelpers, TestConfigParseMinimum) {
 
     EXPECT_EQ(result.application.show_extraction, false);
     EXPECT_GE(result.application.threads, 2);
+    EXPECT_EQ(result.application.frame_stride, 1);
+    EXPECT_EQ(result.application.video_segments, 1);
+    EXPECT_FALSE(result.application.solver_time_budget_s.has_value());
+    EXPECT_EQ(result.application.warm_start, false);
+    EXPECT_FALSE(result.application.max_threads.has_value());
+    EXPECT_EQ(result.application.sequential_pose_initialization, false);
+    EXPECT_FALSE(result.application.imu_samples_per_segment.has_value());
+    EXPECT_FALSE(result.application.extrinsic_window_s.has_value());
+    EXPECT_FALSE(result.application.spline_knot_frequency_hz.has_value());
+    EXPECT_FALSE(result.application.spline_min_knot_frequency_hz.has_value());
+    EXPECT_FALSE(result.application.extrinsic_spline_levels.has_value());
+    EXPECT_EQ(result.application.extrinsic_init_refinement, false);
 
     EXPECT_EQ(result.camera.sensor_name, "/cam0/image_raw");
     EXPECT_EQ(result.camera.camera_model, CameraModel::DoubleSphere);
@@ -70,6 +119,9 @@ TEST(ConfigParsingHelpers, TestConfigParseMinimum) {
     EXPECT_EQ(result.target.size[1], 4);
     EXPECT_EQ(result.target.unit_dimension, 1.0);
     EXPECT_EQ(result.target.asymmetric, false);
+
+    EXPECT_FALSE(result.solver.bundle_adjustment.linear_solver.has_value());
+    EXPECT_FALSE(result.solver.bundle_adjustment.preconditioner.has_value());
 }
 
 TEST(ConfigParsingHelpers, TestConfigApplicationParse) {
@@ -85,6 +137,40 @@ TEST(ConfigParsingHelpers, TestConfigApplicationParse) {
         R"(
             threads = 10
         )",
+        R"(
+            frame_stride = 3
+            video_segments = 2
+        )",
+        R"(
+            solver_time_budget_s = 30
+        )",
+        R"(
+            warm_start = true
+        )",
+        R"(
+            max_threads = 2
+        )",
+        R"(
+            sequential_pose_initialization = true
+        )",
+        R"(
+            imu_samples_per_segment = 2
+        )",
+        R"(
+            extrinsic_window_s = 30.0
+        )",
+        R"(
+            spline_knot_frequency_hz = 50
+        )",
+        R"(
+            spline_min_knot_frequency_hz = 10
+        )",
+        R"(
+            extrinsic_spline_levels = 3
+        )",
+        R"(
+            extrinsic_init_refinement = true
+        )",
     };
 
     for (auto const& valid_table : valid_tables) {
@@ -103,6 +189,45 @@ TEST(ConfigParsingHelpers, TestConfigApplicationParse) {
         R"(
             threads = "wrong_type"
         )",
+        R"(
+            frame_stride = "wrong_type"
+        )",
+        R"(
+            solver_time_budget_s = "wrong_type"
+        )",
+        R"(
+            warm_start = "wrong_type"
+        )",
+        R"(
+            max_threads = "wrong_type"
+        )",
+        R"(
+            sequential_pose_initialization = "wrong_type"
+        )",
+        R"(
+            imu_samples_per_segment = "wrong_type"
+        )",
+        R"(
+            imu_samples_per_segment = 0
+        )",
+        R"(
+            imu_samples_per_segment = -1
+        )",
+        R"(
+            extrinsic_window_s = "wrong_type"
+        )",
+        R"(
+            spline_knot_frequency_hz = "wrong_type"
+        )",
+        R"(
+            spline_min_knot_frequency_hz = "wrong_type"
+        )",
+        R"(
+            extrinsic_spline_levels = "wrong_type"
+        )",
+        R"(
+            extrinsic_init_refinement = "wrong_type"
+        )",
         R"(
             unexpected_key = "value1"
         )",
@@ -238,4 +363,59 @@ TEST(ConfigParsingHelpers, TestConfigTargetParse) {
 
         EXPECT_THROW(config::Config::Target::Parse(config), std::runtime_error);
     }
+}
+
+TEST(ConfigParsingHelpers, TestConfigSolverParse) {
+    std::vector<std::string_view> const valid_tables{
+        R"()",
+        R"(
+            [bundle_adjustment]
+            linear_solver = "DENSE_SCHUR"
+        )",
+        R"(
+            [angular_velocity_alignment]
+            preconditioner = "JACOBI"
+
+            [extrinsic_optimization]
+            linear_solver = "SPARSE_NORMAL_CHOLESKY"
+            preconditioner = "JACOBI"
+        )",
+    };
+
+    for (auto const& valid_table : valid_tables) {
+        toml::table const config{toml::parse(valid_table)};
+
+        EXPECT_NO_THROW(config::Config::Solver::Parse(config));
+    }
+
+    std::vector<std::string_view> const invalid_tables{
+        R"(
+            linear_solver = "DENSE_SCHUR"
+        )",
+        R"(
+            bundle_adjustment = "wrong_type"
+        )",
+        R"(
+            [bundle_adjustment]
+            linear_solver = 1
+        )",
+        R"(
+            [bundle_adjustment]
+            preconditioner = true
+        )",
+        R"(
+            [bundle_adjustment]
+            unexpected_key = "value1"
+        )",
+        R"(
+            [unexpected_problem]
+            linear_solver = "DENSE_SCHUR"
+        )",
+    };
+
+    for (auto const& invalid_table : invalid_tables) {
+        toml::table const config{toml::parse(invalid_table)};
+
+        EXPECT_THROW(config::Config::Solver::Parse(config), std::runtime_error);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <string>
+
+#include "types/calibration_types.hpp"
+#include "types/database_types.hpp"
+#include "types/io.hpp"
+#include "types/sensor_data_types.hpp"
+
+namespace reprojection::database {
+
+// NOTE(Jack): In one calibration run several steps read the same step results, for example the extracted targets are
+// read by the intrinsic initialization, pose initialization, bundle adjustment, spline initialization and extrinsic
+// optimization. While an ArtifactCacheScope is alive for a database the Cached*Select() functions below load every
+// artifact, keyed by its table, step id and asset id, only once and then share the same read only copy. Outside of a
+// scope they are plain selects.
+//
+// The scope is meant to cover one run and no more. The results of a step never change during a run, but a step can be
+// deleted by a later run and its id reused (see steps_delete_trigger.sql).
+//
+// When the cached artifacts add up to more than max_bytes the least recently used ones are dropped from the cache.
+// This never invalidates an artifact a step still holds, it only means that the next request loads it again.
+class ArtifactCacheScope {
+   public:
+    struct Stats {
+        int hits;
+        int misses;
+        std::size_t bytes;  // Estimated size of the currently cached artifacts
+    };
+
+    static constexpr std::size_t default_max_bytes{1UZ << 30};
+
+    explicit ArtifactCacheScope(sqlite3* db, std::size_t max_bytes = default_max_bytes);
+
+    ~ArtifactCacheScope();
+
+    ArtifactCacheScope(ArtifactCacheScope const&) = delete;
+
+    ArtifactCacheScope& operator=(ArtifactCacheScope const&) = delete;
+
+    Stats GetStats() const;
+
+   private:
+    sqlite3* db_;
+};
+
+std::expected<CameraInfo, std::string> CachedCameraInfoSelect(sqlite3* db, StepId step_id, AssetId asset_id);
+
+std::shared_ptr<CameraMeasurements const> CachedExtractedTargetsSelect(sqlite3* db, StepId step_id, AssetId asset_id);
+
+std::expected<CameraState, std::string> CachedIntrinsicSelect(sqlite3* db, StepId step_id, AssetId asset_id);
+
+}  // namespace reprojection::database
\ No newline at end of file
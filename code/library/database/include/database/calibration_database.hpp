@@ -1,7 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <expected>
 #include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "spline/time_handler.hpp"
 #include "spline/types.hpp"
@@ -46,11 +53,37 @@ void ControlPointsInsert(sqlite3* db, StepId step_id, AssetId asset_id, spline::
 
 spline::Matrix2NXd ControlPointsSelect(sqlite3* db, StepId step_id, AssetId asset_id);
 
+// NOTE(Jack): The extraction cache does not belong to any step. It maps the content hash of an image (see
+// hashing::HashContent()) and the hash of the target info to the extraction result, where std::nullopt means that no
+// target was found in the image. This lets the feature extraction step skip all images it has seen before, even when
+// the rest of the dataset changed. The selects return the entries for one target, keyed by the image hash.
+void ExtractionCacheInsert(sqlite3* db, Hash const& target_key,
+                           std::vector<std::pair<Hash, std::optional<ExtractedTarget>>> const& data);
+
+// Returns all entries of the target. These are all images ever extracted with the target, across all datasets.
+std::map<std::string, std::optional<ExtractedTarget>> ExtractionCacheSelect(sqlite3* db, Hash const& target_key);
+
+// Returns only the entries of the given images, use this when the images are processed in batches.
+std::map<std::string, std::optional<ExtractedTarget>> ExtractionCacheSelect(sqlite3* db, Hash const& target_key,
+                                                                            std::vector<Hash> const& image_keys);
+
+// Records which entries a step used (read or inserted). The uses are deleted together with the step, which happens once
+// no workflow references the step anymore.
+void ExtractionCacheUsesInsert(sqlite3* db, StepId step_id, Hash const& target_key, std::vector<Hash> const& image_keys);
+
+// NOTE(Jack): Without this the cache grows forever, every edited image and every extractor version adds entries that
+// are never read again. Deletes all entries that no step uses anymore, so only the images of the datasets that are
+// still part of a workflow are kept.
+void DeleteUnusedExtractionCache(sqlite3* db);
+
 void ExtractedTargetsInsert(sqlite3* db, StepId step_id, StepId source_step_id, AssetId asset_id,
                             CameraMeasurements const& data);
 
 CameraMeasurements ExtractedTargetsSelect(sqlite3* db, StepId step_id, AssetId asset_id);
 
+CameraMeasurements ExtractedTargetsSelect(sqlite3* db, StepId step_id, AssetId asset_id, uint64_t start_ns,
+                                          std::size_t max_rows);
+
 void ExtrinsicInsert(sqlite3* db, StepId step_id, Extrinsic const& extrinsic);
 
 std::expected<Extrinsic, std::string> ExtrinsicSelect(sqlite3* db, StepId step_id, AssetId asset_a_id,
@@ -64,15 +97,32 @@ void ImagesInsert(sqlite3* db, StepId step_id, AssetId asset_id, EncodedImages c
 
 EncodedImages ImagesSelect(sqlite3* db, StepId step_id, AssetId asset_id);
 
+// NOTE(Jack): Like the extracted targets select above, this overload returns only the first max_rows rows with a
+// timestamp at or after start_ns, in timestamp order. Use it through SelectCursor to read all rows batch by batch.
+EncodedImages ImagesSelect(sqlite3* db, StepId step_id, AssetId asset_id, uint64_t start_ns, std::size_t max_rows);
+
+// NOTE(Jack): Returns the size of each image without reading the image data, see hashing::Serialize(ImageSizes).
+ImageSizes ImageSizesSelect(sqlite3* db, StepId step_id, AssetId asset_id);
+
+// NOTE(Jack): The imu data and imu errors are not stored one row per sample, but in chunks that each cover a fixed
+// length of time, one blob of contiguous timestamps and values per chunk. For a high rate imu this is orders of
+// magnitude fewer rows. The selects can be limited to the inclusive time range [start_ns, end_ns], then only the chunks
+// which overlap the range are read.
 void ImuDataInsert(sqlite3* db, StepId step_id, AssetId asset_id, ImuMeasurements const& data);
 
 ImuMeasurements ImuDataSelect(sqlite3* db, StepId step_id, AssetId asset_id);
 
+ImuMeasurements ImuDataSelect(sqlite3* db, StepId step_id, AssetId asset_id, uint64_t start_ns, uint64_t end_ns);
+
 // TODO(Jack): "source_step_id" used here and elsewhere is a misleading name. In reality this step id is used only to
 // establish a foreign key constraint, there is nothing to do with the source of anything (at least that is not a
 // requirement). We need to think of a better name/concept I think.
 void ImuErrorsInsert(sqlite3* db, StepId step_id, StepId source_step_id, AssetId asset_id, ImuErrors const& data);
 
+ImuErrors ImuErrorsSelect(sqlite3* db, StepId step_id, AssetId asset_id);
+
+ImuErrors ImuErrorsSelect(sqlite3* db, StepId step_id, AssetId asset_id, uint64_t start_ns, uint64_t end_ns);
+
 void IntrinsicInsert(sqlite3* db, StepId step_id, AssetId asset_id, CameraModel camera_model, CameraState const& data);
 
 // TODO(Jack): Should this also return the camera_model? We have that information.
@@ -81,12 +131,89 @@ std::expected<CameraState, std::string> IntrinsicSelect(sqlite3* db, StepId step
 void ReprojectionErrorsInsert(sqlite3* db, StepId step_id, StepId source_step_id, AssetId asset_id,
                               ReprojectionErrors const& data);
 
+ReprojectionErrors ReprojectionErrorsSelect(sqlite3* db, StepId step_id, AssetId asset_id);
+
+// NOTE(Jack): The solver iterations and snapshots are written while the optimization is still running, so that
+// long-running optimizations can be followed from the dashboard. Both are returned in iteration order.
+void SolverIterationsInsert(sqlite3* db, StepId step_id, std::vector<SolverIteration> const& data);
+
+std::vector<SolverIteration> SolverIterationsSelect(sqlite3* db, StepId step_id);
+
+void SolverMetricsInsert(sqlite3* db, StepId step_id, SolverMetrics const& data);
+
+std::expected<SolverMetrics, std::string> SolverMetricsSelect(sqlite3* db, StepId step_id);
+
+void SolverSnapshotInsert(sqlite3* db, StepId step_id, SolverSnapshot const& data);
+
+std::vector<SolverSnapshot> SolverSnapshotsSelect(sqlite3* db, StepId step_id);
+
 void SplineInfoInsert(sqlite3* db, StepId step_id, AssetId asset_id, spline::TimeHandler const& time_handler);
 
 std::expected<spline::TimeHandler, std::string> SplineInfoSelect(sqlite3* db, StepId step_id, AssetId asset_id);
 
+// NOTE(Jack): Unlike most other tables a step can have many step metrics rows, one for every time it was run or found
+// in the cache. They are returned in the order they were inserted.
+void StepMetricsInsert(sqlite3* db, StepId step_id, StepMetrics const& data);
+
+std::vector<StepMetrics> StepMetricsSelect(sqlite3* db, StepId step_id);
+
 void TargetInfoInsert(sqlite3* db, StepId step_id, AssetId asset_id, TargetInfo const& target_info);
 
 std::expected<TargetInfo, std::string> TargetInfoSelect(sqlite3* db, StepId step_id, AssetId asset_id);
 
+// NOTE(Jack): The warm start tables let a bundle adjustment start from the result of a previous bundle adjustment.
+// WarmStartSourceSelect() returns the id and cache key of the most recent completed bundle adjustment with intrinsics
+// for the given camera and camera model. WarmStartSelect() returns the source key a step was warm started from, if
+// that step was warm started for the same inputs (input_key). The source is often replaced (and deleted) by exactly
+// the result that was warm started from it, this is why the source_step_id has no foreign key.
+std::expected<std::pair<StepId, Hash>, std::string> WarmStartSourceSelect(sqlite3* db, AssetId asset_id,
+                                                                          CameraModel camera_model);
+
+void WarmStartInsert(sqlite3* db, StepId step_id, AssetId asset_id, Hash const& input_key, StepId source_step_id,
+                     Hash const& source_key, int matched_frames);
+
+std::expected<Hash, std::string> WarmStartSelect(sqlite3* db, StepId step_id, Hash const& input_key);
+
+// NOTE(Jack): Reads all rows of one step and asset in timestamp order, but at most batch_size rows at a time, so that
+// the memory use does not grow with the size of the dataset. Every batch is its own query which continues after the
+// last timestamp of the previous batch (keyset pagination). Therefore no read statement is left open between batches
+// and the caller is free to write to the database while it iterates. Usage:
+//
+//      SelectCursor<EncodedImages> cursor{db, &ImagesSelect, step_id, asset_id, 100};
+//      for (EncodedImages batch{cursor.Next()}; not batch.empty(); batch = cursor.Next()) { ... }
+template <typename T_Map>
+class SelectCursor {
+   public:
+    using BatchSelect = T_Map (*)(sqlite3*, StepId, AssetId, uint64_t, std::size_t);
+
+    SelectCursor(sqlite3* const db, BatchSelect const select, StepId const step_id, AssetId const asset_id,
+                 std::size_t const batch_size)
+        : db_{db}, select_{select}, step_id_{step_id}, asset_id_{asset_id}, batch_size_{std::max(batch_size, 1UZ)} {}
+
+    // Returns an empty batch once all rows have been read.
+    T_Map Next() {
+        if (done_) {
+            return {};
+        }
+
+        T_Map batch{select_(db_, step_id_, asset_id_, start_ns_, batch_size_)};
+        if (std::size(batch) < batch_size_) {
+            done_ = true;
+        } else {
+            start_ns_ = std::crbegin(batch)->first + 1;
+        }
+
+        return batch;
+    }
+
+   private:
+    sqlite3* db_;
+    BatchSelect select_;
+    StepId step_id_;
+    AssetId asset_id_;
+    std::size_t batch_size_;
+    uint64_t start_ns_{0};
+    bool done_{false};
+};
+
 }  // namespace reprojection::database
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <filesystem>
+
+#include "types/database_types.hpp"
+#include "types/io.hpp"
+
+namespace reprojection::database {
+
+// NOTE(Jack): Writes the step results of one workflow as columnar files, so that analysis tools can scan them across
+// many databases without going through sqlite row queries and protobuf parsing. Every table gets its own directory
+// under output_dir (camera_poses, imu_errors, intrinsics and reprojection_errors) which contains one file per column
+// and a schema.toml that lists the columns, their dtype and the row count. A column file is nothing but the raw little
+// endian values back to back, therefore it can be memory mapped directly (ex. numpy.memmap(path, dtype="<f8")).
+//
+// The reprojection errors are flattened to one row per residual and the intrinsics to one row per parameter, so that
+// all columns are fixed width. The rows are ordered by step_id, asset_id and timestamp_ns. The tables are streamed
+// from the database with a fixed size buffer per column, meaning memory use does not grow with the database size.
+void ColumnarExport(sqlite3* db, WorkflowId workflow_id, std::filesystem::path const& output_dir);
+
+}  // namespace reprojection::database
\ No newline at end of file
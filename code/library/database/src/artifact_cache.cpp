@@ -0,0 +1,176 @@
+#include "database/artifact_cache.hpp"
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "database/calibration_database.hpp"
+
+namespace reprojection::database {
+
+namespace {
+
+using ArtifactKey = std::tuple<std::string_view, int64_t, int64_t>;
+
+struct ArtifactCache {
+    struct Entry {
+        std::shared_ptr<void const> artifact;
+        std::size_t bytes;
+        std::list<ArtifactKey>::iterator lru_position;
+    };
+
+    // NOTE(Jack): Drops the least recently used artifacts until the cache fits in max_bytes again.
+    void Evict() {
+        while (bytes > max_bytes and not lru.empty()) {
+            auto const entry{entries.find(lru.back())};
+            bytes -= entry->second.bytes;
+            entries.erase(entry);
+            lru.pop_back();
+        }
+    }
+
+    std::size_t max_bytes{ArtifactCacheScope::default_max_bytes};
+    std::size_t bytes{0};
+    int hits{0};
+    int misses{0};
+    std::list<ArtifactKey> lru;  // Most recently used at the front
+    std::map<ArtifactKey, Entry> entries;
+};
+
+std::mutex caches_mutex;
+std::map<sqlite3*, ArtifactCache> caches;
+
+// NOTE(Jack): The sizes are an estimate of the heap memory the artifact uses, which is all we need to decide when to
+// evict. They do not have to be exact.
+std::size_t ArtifactBytes(CameraInfo const&) { return sizeof(CameraInfo); }
+
+std::size_t ArtifactBytes(CameraState const& data) {
+    return sizeof(CameraState) + static_cast<std::size_t>(data.intrinsics.size()) * sizeof(double);
+}
+
+std::size_t ArtifactBytes(CameraMeasurements const& data) {
+    std::size_t bytes{sizeof(CameraMeasurements)};
+    for (auto const& [_, target] : data) {
+        bytes += sizeof(CameraMeasurement);
+        bytes += static_cast<std::size_t>(target.bundle.pixels.size() + target.bundle.points.size()) * sizeof(double);
+        bytes += static_cast<std::size_t>(target.indices.size()) * sizeof(int);
+    }
+
+    return bytes;
+}
+
+// NOTE(Jack): The load function returns nullptr if the artifact does not exist, which is never cached so that a later
+// request can still find it once it was written. The database is not locked while loading, if two threads load the
+// same artifact at once the first one to finish is the one that gets cached.
+template <typename T, typename T_Load>
+std::shared_ptr<T const> GetOrLoad(sqlite3* const db, std::string_view const table, StepId const step_id,
+                                   AssetId const asset_id, T_Load const& load) {
+    ArtifactKey const key{table, step_id.value, asset_id.value};
+    {
+        std::lock_guard const lock{caches_mutex};
+        auto const cache{caches.find(db)};
+        if (cache == std::end(caches)) {
+            return load();
+        }
+
+        if (auto const entry{cache->second.entries.find(key)}; entry != std::end(cache->second.entries)) {
+            cache->second.hits += 1;
+            cache->second.lru.splice(std::begin(cache->second.lru), cache->second.lru, entry->second.lru_position);
+
+            return std::static_pointer_cast<T const>(entry->second.artifact);
+        }
+    }
+
+    std::shared_ptr<T const> const artifact{load()};
+    if (not artifact) {
+        return artifact;
+    }
+
+    std::lock_guard const lock{caches_mutex};
+    auto const cache{caches.find(db)};
+    if (cache == std::end(caches)) {
+        return artifact;  // LCOV_EXCL_LINE
+    }
+
+    cache->second.misses += 1;
+    if (auto const entry{cache->second.entries.find(key)}; entry != std::end(cache->second.entries)) {
+        return std::static_pointer_cast<T const>(entry->second.artifact);  // LCOV_EXCL_LINE
+    }
+
+    std::size_t const bytes{ArtifactBytes(*artifact)};
+    cache->second.lru.push_front(key);
+    cache->second.entries.insert({key, {artifact, bytes, std::begin(cache->second.lru)}});
+    cache->second.bytes += bytes;
+    cache->second.Evict();
+
+    return artifact;
+}
+
+// Caches the value of a select which returns std::expected, only the successful results are cached.
+template <typename T, typename T_Select>
+std::expected<T, std::string> GetOrLoadExpected(sqlite3* const db, std::string_view const table, StepId const step_id,
+                                                AssetId const asset_id, T_Select const& select) {
+    std::string error;
+    auto const artifact{GetOrLoad<T>(db, table, step_id, asset_id, [&]() -> std::shared_ptr<T const> {
+        auto result{select(db, step_id, asset_id)};
+        if (not result) {
+            error = std::move(result.error());
+            return nullptr;
+        }
+
+        return std::make_shared<T const>(std::move(*result));
+    })};
+
+    if (not artifact) {
+        return std::unexpected(error);
+    }
+
+    return *artifact;
+}
+
+}  // namespace
+
+ArtifactCacheScope::ArtifactCacheScope(sqlite3* const db, std::size_t const max_bytes) : db_{db} {
+    std::lock_guard const lock{caches_mutex};
+    auto const [cache, inserted]{caches.try_emplace(db)};
+    if (not inserted) {
+        throw std::runtime_error("ArtifactCacheScope: there is already an active artifact cache for this database");
+    }
+    cache->second.max_bytes = max_bytes;
+}
+
+ArtifactCacheScope::~ArtifactCacheScope() {
+    std::lock_guard const lock{caches_mutex};
+    caches.erase(db_);
+}
+
+ArtifactCacheScope::Stats ArtifactCacheScope::GetStats() const {
+    std::lock_guard const lock{caches_mutex};
+    ArtifactCache const& cache{caches.at(db_)};
+
+    return {cache.hits, cache.misses, cache.bytes};
+}
+
+std::expected<CameraInfo, std::string> CachedCameraInfoSelect(sqlite3* const db, StepId const step_id,
+                                                              AssetId const asset_id) {
+    return GetOrLoadExpected<CameraInfo>(db, "camera_info", step_id, asset_id, &CameraInfoSelect);
+}
+
+std::shared_ptr<CameraMeasurements const> CachedExtractedTargetsSelect(sqlite3* const db, StepId const step_id,
+                                                                       AssetId const asset_id) {
+    return GetOrLoad<CameraMeasurements>(db, "extracted_targets", step_id, asset_id, [&]() {
+        return std::make_shared<CameraMeasurements const>(ExtractedTargetsSelect(db, step_id, asset_id));
+    });
+}
+
+std::expected<CameraState, std::string> CachedIntrinsicSelect(sqlite3* const db, StepId const step_id,
+                                                              AssetId const asset_id) {
+    return GetOrLoadExpected<CameraState>(db, "intrinsics", step_id, asset_id, &IntrinsicSelect);
+}
+
+}  // namespace reprojection::database
\ No newline at end of file
@@ -1,7 +1,11 @@
 #include "database/calibration_database.hpp"
 
 #include <format>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <ranges>
+#include <tuple>
 
 #include "database/sqlite_exception.hpp"
 // cppcheck-suppress missingInclude
@@ -15,6 +19,12 @@
 
 namespace reprojection::database {
 
+namespace {
+
+void MigrateImuRowTables(sqlite3* const db);
+
+}  // namespace
+
 SqlitePtr OpenCalibrationDatabase(std::filesystem::path const& db_path, bool const create, bool const read_only) {
     if (create and read_only) {
         throw std::runtime_error(
@@ -44,16 +54,24 @@ SqlitePtr OpenCalibrationDatabase(std::filesystem::path const& db_path, bool con
         ExecuteStatement(sql_statements::camera_poses_table, db);
         ExecuteStatement(sql_statements::control_points_table, db);
         ExecuteStatement(sql_statements::extracted_targets_table, db);
+        ExecuteStatement(sql_statements::extraction_cache_table, db);
+        ExecuteStatement(sql_statements::extraction_cache_uses_table, db);
         ExecuteStatement(sql_statements::extrinsics_table, db);
         ExecuteStatement(sql_statements::gravity_table, db);
         ExecuteStatement(sql_statements::images_table, db);
-        ExecuteStatement(sql_statements::imu_data_table, db);
-        ExecuteStatement(sql_statements::imu_errors_table, db);
+        ExecuteStatement(sql_statements::imu_data_chunks_table, db);
+        ExecuteStatement(sql_statements::imu_errors_chunks_table, db);
         ExecuteStatement(sql_statements::intrinsics_table, db);
         ExecuteStatement(sql_statements::reprojection_errors_table, db);
+        ExecuteStatement(sql_statements::solver_iterations_table, db);
+        ExecuteStatement(sql_statements::solver_metrics_table, db);
+        ExecuteStatement(sql_statements::solver_snapshots_table, db);
         ExecuteStatement(sql_statements::spline_info_table, db);
+        ExecuteStatement(sql_statements::spline_knots_table, db);
+        ExecuteStatement(sql_statements::step_metrics_table, db);
         ExecuteStatement(sql_statements::steps_table, db);
         ExecuteStatement(sql_statements::target_info_table, db);
+        ExecuteStatement(sql_statements::warm_starts_table, db);
         ExecuteStatement(sql_statements::workflow_assets_table, db);
         ExecuteStatement(sql_statements::workflow_steps_table, db);
         ExecuteStatement(sql_statements::workflows_table, db);
@@ -61,6 +79,8 @@ SqlitePtr OpenCalibrationDatabase(std::filesystem::path const& db_path, bool con
         // This trigger enforces that when a step becomes unreferenced (i.e. it does not belong to any workflow) it gets
         // deleted. This should keep the database clean.
         ExecuteStatement(sql_statements::steps_delete_trigger, db);
+
+        MigrateImuRowTables(db);
     }
 
     // NOTE(Jack): We use the foreign key constraint between some tables to enforce data consistency. For
@@ -284,6 +304,107 @@ spline::Matrix2NXd ControlPointsSelect(sqlite3* const db, StepId const step_id,
     return control_points;
 }
 
+void ExtractionCacheInsert(sqlite3* const db, Hash const& target_key,
+                           std::vector<std::pair<Hash, std::optional<ExtractedTarget>>> const& data) {
+    auto const binder{[&target_key](sqlite3_stmt* const stmt, auto const& data_i) {
+        auto const& [image_key, target]{data_i};
+
+        Bind(stmt, 1, target_key.value);
+        Bind(stmt, 2, image_key.value);
+        if (not target) {
+            // NOTE(Jack): It is just as valuable to remember that there is no target in an image, because the failed
+            // extraction attempts are usually the most expensive ones.
+            BindNull(stmt, 3);
+            return;
+        }
+
+        protobuf_serialization::ExtractedTargetProto const serialized{Serialize(*target)};
+        std::string buffer;
+        if (not serialized.SerializeToString(&buffer)) {
+            throw std::runtime_error(  // LCOV_EXCL_LINE
+                std::format("ExtractedTargetProto.SerializeToString() failed: target_key '{}', image_key '{}'",
+                            target_key.value, image_key.value));  // LCOV_EXCL_LINE
+        }
+        BindBlob(stmt, 3, std::as_bytes(std::span{buffer}));
+    }};
+
+    BatchExecuteStatement(sql_statements::extraction_cache_insert, data, binder, db);
+}
+
+namespace {
+
+// Reads one (image_hash, data) row of the extraction cache into data.
+void ReadExtractionCacheRow(sqlite3_stmt* const stmt, std::map<std::string, std::optional<ExtractedTarget>>& data) {
+    std::string const image_key{reinterpret_cast<char const*>(sqlite3_column_text(stmt, 0))};
+    if (sqlite3_column_type(stmt, 1) == SQLITE_NULL) {
+        data.insert({image_key, std::nullopt});
+        return;
+    }
+
+    auto const blob{SqliteBlob(stmt, 1)};
+    protobuf_serialization::ExtractedTargetProto serialized;
+    serialized.ParseFromArray(std::data(blob), static_cast<int>(std::size(blob)));
+
+    auto const deserialized{Deserialize(serialized)};
+    if (not deserialized) {
+        throw std::runtime_error(std::format(                                                 // LCOV_EXCL_LINE
+            "ExtractedTargetProto.ParseFromArray()/Deserialize() failed: image_key '{}'",  // LCOV_EXCL_LINE
+            image_key));                                                                    // LCOV_EXCL_LINE
+    }
+
+    data.insert({image_key, deserialized});
+}
+
+}  // namespace
+
+std::map<std::string, std::optional<ExtractedTarget>> ExtractionCacheSelect(sqlite3* const db,
+                                                                            Hash const& target_key) {
+    std::map<std::string, std::optional<ExtractedTarget>> data;
+
+    ExecuteQuery(
+        db, sql_statements::extraction_cache_select,
+        [&target_key](sqlite3_stmt* const stmt) { Bind(stmt, 1, target_key.value); },
+        [&data](sqlite3_stmt* const stmt) { ReadExtractionCacheRow(stmt, data); });
+
+    return data;
+}
+
+std::map<std::string, std::optional<ExtractedTarget>> ExtractionCacheSelect(sqlite3* const db, Hash const& target_key,
+                                                                            std::vector<Hash> const& image_keys) {
+    // NOTE(Jack): Sqlite cannot bind a list of values, so we bind the image keys as one json array and expand it again
+    // with json_each() in the query. The keys are hex strings and need no escaping.
+    std::string image_keys_json{"["};
+    for (auto const& image_key : image_keys) {
+        image_keys_json += std::format("{}\"{}\"", std::size(image_keys_json) == 1 ? "" : ",", image_key.value);
+    }
+    image_keys_json += "]";
+
+    std::map<std::string, std::optional<ExtractedTarget>> data;
+
+    ExecuteQuery(
+        db, sql_statements::extraction_cache_select_batch,
+        [&target_key, &image_keys_json](sqlite3_stmt* const stmt) {
+            Bind(stmt, 1, target_key.value);
+            Bind(stmt, 2, image_keys_json);
+        },
+        [&data](sqlite3_stmt* const stmt) { ReadExtractionCacheRow(stmt, data); });
+
+    return data;
+}
+
+void ExtractionCacheUsesInsert(sqlite3* const db, StepId const step_id, Hash const& target_key,
+                               std::vector<Hash> const& image_keys) {
+    auto const binder{[step_id, &target_key](sqlite3_stmt* const stmt, Hash const& image_key) {
+        Bind(stmt, 1, step_id.value);
+        Bind(stmt, 2, target_key.value);
+        Bind(stmt, 3, image_key.value);
+    }};
+
+    BatchExecuteStatement(sql_statements::extraction_cache_uses_insert, image_keys, binder, db);
+}
+
+void DeleteUnusedExtractionCache(sqlite3* const db) { ExecuteStatement(sql_statements::extraction_cache_delete, db); }
+
 // NOTE(Jack): This "source_step_id" idea here is an important part of establishing a foreign key relationship
 // between two data tables.
 void ExtractedTargetsInsert(sqlite3* const db, StepId const step_id, StepId const source_step_id,
@@ -310,6 +431,29 @@ void ExtractedTargetsInsert(sqlite3* const db, StepId const step_id, StepId cons
     BatchExecuteStatement(sql_statements::extracted_targets_insert, data, binder, db);
 }
 
+namespace {
+
+// Reads one (timestamp_ns, data) row of the extracted targets table.
+CameraMeasurement ReadExtractedTargetRow(sqlite3_stmt* const stmt) {
+    uint64_t const timestamp_ns{static_cast<uint64_t>(sqlite3_column_int64(stmt, 0))};
+
+    auto const blob{SqliteBlob(stmt, 1)};
+    protobuf_serialization::ExtractedTargetProto serialized;
+    serialized.ParseFromArray(std::data(blob), static_cast<int>(std::size(blob)));
+
+    auto const deserialized{Deserialize(serialized)};
+    if (not deserialized) {
+        throw std::runtime_error(std::format(  // LCOV_EXCL_LINE
+            "ExtractedTargetProto.ParseFromArray()/Deserialize() failed: "
+            "timestamp_ns '{}'",  // LCOV_EXCL_LINE
+            timestamp_ns));       // LCOV_EXCL_LINE
+    }
+
+    return {timestamp_ns, deserialized.value()};
+}
+
+}  // namespace
+
 CameraMeasurements ExtractedTargetsSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id) {
     CameraMeasurements data;
 
@@ -319,23 +463,24 @@ CameraMeasurements ExtractedTargetsSelect(sqlite3* const db, StepId const step_i
             Bind(stmt, 1, step_id.value);
             Bind(stmt, 2, asset_id.value);
         },
-        [&data](sqlite3_stmt* const stmt) {
-            uint64_t const timestamp_ns{static_cast<uint64_t>(sqlite3_column_int64(stmt, 0))};
+        [&data](sqlite3_stmt* const stmt) { data.insert(ReadExtractedTargetRow(stmt)); });
 
-            auto const blob{SqliteBlob(stmt, 1)};
-            protobuf_serialization::ExtractedTargetProto serialized;
-            serialized.ParseFromArray(std::data(blob), static_cast<int>(std::size(blob)));
+    return data;
+}  // LCOV_EXCL_LINE
 
-            auto const deserialized{Deserialize(serialized)};
-            if (not deserialized) {
-                throw std::runtime_error(std::format(  // LCOV_EXCL_LINE
-                    "ExtractedTargetProto.ParseFromArray()/Deserialize() failed: "
-                    "timestamp_ns '{}'",  // LCOV_EXCL_LINE
-                    timestamp_ns));       // LCOV_EXCL_LINE
-            }
+CameraMeasurements ExtractedTargetsSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id,
+                                          uint64_t const start_ns, std::size_t const max_rows) {
+    CameraMeasurements data;
 
-            data.insert({timestamp_ns, deserialized.value()});
-        });
+    ExecuteQuery(
+        db, sql_statements::extracted_targets_select_batch,
+        [step_id, asset_id, start_ns, max_rows](sqlite3_stmt* const stmt) {
+            Bind(stmt, 1, step_id.value);
+            Bind(stmt, 2, asset_id.value);
+            Bind(stmt, 3, start_ns);
+            Bind(stmt, 4, max_rows);
+        },
+        [&data](sqlite3_stmt* const stmt) { data.insert(ReadExtractedTargetRow(stmt)); });
 
     return data;
 }  // LCOV_EXCL_LINE
@@ -415,6 +560,23 @@ void ImagesInsert(sqlite3* const db, StepId const step_id, AssetId const asset_i
     BatchExecuteStatement(sql_statements::images_insert, data, binder, db);
 }
 
+namespace {
+
+// Reads one (timestamp_ns, data) row of the images table.
+EncodedImage ReadImageRow(sqlite3_stmt* const stmt) {
+    uint64_t const timestamp_ns{static_cast<uint64_t>(sqlite3_column_int64(stmt, 0))};
+
+    auto const blob{SqliteBlob(stmt, 1)};
+    std::span<uchar const> blob_span{reinterpret_cast<uchar const*>(blob.data()), blob.size()};
+    std::vector<uchar> buffer(std::cbegin(blob_span), std::cend(blob_span));
+
+    // TODO(Jack): Should we represent empty images with std::optional? Currently this will load all images, and if the
+    // image is a null value it will just be a buffer with length zero.
+    return {timestamp_ns, ImageBuffer{std::move(buffer)}};
+}
+
+}  // namespace
+
 EncodedImages ImagesSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id) {
     EncodedImages data;
 
@@ -424,71 +586,243 @@ EncodedImages ImagesSelect(sqlite3* const db, StepId const step_id, AssetId cons
             Bind(stmt, 1, step_id.value);
             Bind(stmt, 2, asset_id.value);
         },
-        [&data](sqlite3_stmt* const stmt) {
-            uint64_t const timestamp_ns{static_cast<uint64_t>(sqlite3_column_int64(stmt, 0))};
+        [&data](sqlite3_stmt* const stmt) { data.insert(ReadImageRow(stmt)); });
 
-            auto const blob{SqliteBlob(stmt, 1)};
-            std::span<uchar const> blob_span{reinterpret_cast<uchar const*>(blob.data()), blob.size()};
-            std::vector<uchar> buffer(std::cbegin(blob_span), std::cend(blob_span));
+    return data;
+}  // LCOV_EXCL_LINE
+
+EncodedImages ImagesSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id, uint64_t const start_ns,
+                           std::size_t const max_rows) {
+    EncodedImages data;
+
+    ExecuteQuery(
+        db, sql_statements::images_select_batch,
+        [step_id, asset_id, start_ns, max_rows](sqlite3_stmt* const stmt) {
+            Bind(stmt, 1, step_id.value);
+            Bind(stmt, 2, asset_id.value);
+            Bind(stmt, 3, start_ns);
+            Bind(stmt, 4, max_rows);
+        },
+        [&data](sqlite3_stmt* const stmt) { data.insert(ReadImageRow(stmt)); });
+
+    return data;
+}  // LCOV_EXCL_LINE
 
-            // TODO(Jack): Should we represent empty images with std::optional? Currently this will load all images,
-            // and if the image is a null value it will just be a buffer with length zero.
-            data.insert({timestamp_ns, ImageBuffer{buffer}});
+ImageSizes ImageSizesSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id) {
+    ImageSizes data;
+
+    ExecuteQuery(
+        db, sql_statements::images_sizes_select,
+        [step_id, asset_id](sqlite3_stmt* const stmt) {
+            Bind(stmt, 1, step_id.value);
+            Bind(stmt, 2, asset_id.value);
+        },
+        [&data](sqlite3_stmt* const stmt) {
+            // NOTE(Jack): A null image has a null length, which sqlite3_column_int64() reads as zero. That is the same
+            // size as the empty buffer ImagesSelect() returns for it.
+            data.insert({static_cast<uint64_t>(sqlite3_column_int64(stmt, 0)),
+                         static_cast<std::size_t>(sqlite3_column_int64(stmt, 1))});
         });
 
     return data;
 }  // LCOV_EXCL_LINE
 
-void ImuDataInsert(sqlite3* const db, StepId step_id, AssetId asset_id, ImuMeasurements const& data) {
-    auto const binder{[step_id, asset_id](sqlite3_stmt* const stmt, auto const& data_i) {
-        auto const& [timestamp_ns, imu_data_i]{data_i};
+namespace {
+
+// NOTE(Jack): One second of data per chunk, for a 1kHz imu that is a ~56kB blob. Any chunk length works for reading,
+// the selects only rely on the start_ns and end_ns columns, so this can be changed without invalidating databases.
+constexpr uint64_t imu_chunk_duration_ns{1'000'000'000};
+
+// NOTE(Jack): The sqlite integers are signed, so this is the largest timestamp we can bind.
+constexpr uint64_t max_timestamp_ns{static_cast<uint64_t>(std::numeric_limits<int64_t>::max())};
+
+// Splits the imu samples into ranges which each cover one fixed length interval of time.
+template <typename T_Map>
+auto ImuChunks(T_Map const& data) {
+    using Iterator = typename T_Map::const_iterator;
+
+    std::vector<std::pair<Iterator, Iterator>> chunks;
+    for (Iterator begin{std::cbegin(data)}; begin != std::cend(data);) {
+        uint64_t const interval_end_ns{(begin->first / imu_chunk_duration_ns + 1) * imu_chunk_duration_ns};
+        Iterator const end{data.lower_bound(interval_end_ns)};
+
+        chunks.push_back({begin, end});
+        begin = end;
+    }
+
+    return chunks;
+}
+
+template <typename T_Iterator>
+std::string SerializeImuChunkToString(T_Iterator const begin, T_Iterator const end) {
+    protobuf_serialization::ImuChunkProto const serialized{SerializeImuChunk(begin, end)};
+    std::string buffer;
+    if (not serialized.SerializeToString(&buffer)) {
+        throw std::runtime_error(  // LCOV_EXCL_LINE
+            std::format("ImuChunkProto.SerializeToString() failed: start_ns '{}'", begin->first));  // LCOV_EXCL_LINE
+    }
+
+    return buffer;
+}
+
+auto ImuDataChunkBinder(StepId const step_id, AssetId const asset_id) {
+    return [step_id, asset_id](sqlite3_stmt* const stmt, auto const& chunk) {
+        auto const& [begin, end]{chunk};
 
         Bind(stmt, 1, step_id.value);
         Bind(stmt, 2, asset_id.value);
-        Bind(stmt, 3, timestamp_ns);
+        Bind(stmt, 3, begin->first);
+        Bind(stmt, 4, std::prev(end)->first);
+        std::string const buffer{SerializeImuChunkToString(begin, end)};
+        BindBlob(stmt, 5, std::as_bytes(std::span{buffer}));
+    };
+}
 
-        BindEigenColumn<Vector3d>(stmt, 4, imu_data_i.angular_velocity);
-        BindEigenColumn<Vector3d>(stmt, 7, imu_data_i.linear_acceleration);
-    }};
+auto ImuErrorsChunkBinder(StepId const step_id, StepId const source_step_id, AssetId const asset_id) {
+    return [step_id, source_step_id, asset_id](sqlite3_stmt* const stmt, auto const& chunk) {
+        auto const& [begin, end]{chunk};
 
-    BatchExecuteStatement(sql_statements::imu_data_insert, data, binder, db);
+        Bind(stmt, 1, step_id.value);
+        Bind(stmt, 2, source_step_id.value);
+        Bind(stmt, 3, asset_id.value);
+        Bind(stmt, 4, begin->first);
+        Bind(stmt, 5, std::prev(end)->first);
+        std::string const buffer{SerializeImuChunkToString(begin, end)};
+        BindBlob(stmt, 6, std::as_bytes(std::span{buffer}));
+    };
 }
 
-ImuMeasurements ImuDataSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id) {
-    ImuMeasurements data;
+template <typename T_Map>
+T_Map ImuChunksSelect(sqlite3* const db, std::string_view const sql, StepId const step_id, AssetId const asset_id,
+                      uint64_t const start_ns, uint64_t const end_ns) {
+    T_Map data;
 
     ExecuteQuery(
-        db, sql_statements::imu_data_select,
-        [step_id, asset_id](sqlite3_stmt* const stmt) {
+        db, sql,
+        [step_id, asset_id, start_ns, end_ns](sqlite3_stmt* const stmt) {
             Bind(stmt, 1, step_id.value);
             Bind(stmt, 2, asset_id.value);
+            Bind(stmt, 3, end_ns);
+            Bind(stmt, 4, start_ns);
         },
-        [&data](sqlite3_stmt* const stmt) {
-            uint64_t const timestamp_ns{static_cast<uint64_t>(sqlite3_column_int64(stmt, 0))};
-            Array6d const imu_data_i{ReadEigenColumn<6>(stmt, 1)};
+        [&data, step_id, asset_id, start_ns, end_ns](sqlite3_stmt* const stmt) {
+            auto const blob{SqliteBlob(stmt, 0)};
+            protobuf_serialization::ImuChunkProto serialized;
+            serialized.ParseFromArray(std::data(blob), static_cast<int>(std::size(blob)));
+
+            auto deserialized{DeserializeImuChunk<T_Map>(serialized, start_ns, end_ns)};
+            if (not deserialized) {
+                throw std::runtime_error(std::format(  // LCOV_EXCL_LINE
+                    "ImuChunkProto.ParseFromArray()/DeserializeImuChunk() failed: "
+                    "step_id '{}', asset_id '{}'",        // LCOV_EXCL_LINE
+                    step_id.value, asset_id.value));  // LCOV_EXCL_LINE
+            }
 
-            data.insert(ImuMeasurement{timestamp_ns, {imu_data_i.topRows<3>(), imu_data_i.bottomRows<3>()}});
+            // NOTE(Jack): Moves the nodes of the chunk map into the result, nothing is copied or reallocated.
+            data.merge(*deserialized);
         });
 
     return data;
 }  // LCOV_EXCL_LINE
 
+}  // namespace
+
+void ImuDataInsert(sqlite3* const db, StepId step_id, AssetId asset_id, ImuMeasurements const& data) {
+    BatchExecuteStatement(sql_statements::imu_data_chunks_insert, ImuChunks(data),
+                          ImuDataChunkBinder(step_id, asset_id), db);
+}
+
+ImuMeasurements ImuDataSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id) {
+    return ImuDataSelect(db, step_id, asset_id, 0, max_timestamp_ns);
+}
+
+ImuMeasurements ImuDataSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id, uint64_t const start_ns,
+                              uint64_t const end_ns) {
+    return ImuChunksSelect<ImuMeasurements>(db, sql_statements::imu_data_chunks_select, step_id, asset_id, start_ns,
+                                            end_ns);
+}
+
 void ImuErrorsInsert(sqlite3* db, StepId step_id, StepId source_step_id, AssetId asset_id, ImuErrors const& data) {
-    auto const binder{[step_id, source_step_id, asset_id](sqlite3_stmt* const stmt, auto const& data_i) {
-        auto const& [timestamp_ns, imu_error_i]{data_i};
+    BatchExecuteStatement(sql_statements::imu_errors_chunks_insert, ImuChunks(data),
+                          ImuErrorsChunkBinder(step_id, source_step_id, asset_id), db);
+}
 
-        Bind(stmt, 1, step_id.value);
-        Bind(stmt, 2, source_step_id.value);
-        Bind(stmt, 3, asset_id.value);
-        Bind(stmt, 4, timestamp_ns);
+ImuErrors ImuErrorsSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id) {
+    return ImuErrorsSelect(db, step_id, asset_id, 0, max_timestamp_ns);
+}
 
-        BindEigenColumn<Vector3d>(stmt, 5, imu_error_i.delta_angular_velocity);
-        BindEigenColumn<Vector3d>(stmt, 8, imu_error_i.delta_linear_acceleration);
-    }};
+ImuErrors ImuErrorsSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id, uint64_t const start_ns,
+                          uint64_t const end_ns) {
+    return ImuChunksSelect<ImuErrors>(db, sql_statements::imu_errors_chunks_select, step_id, asset_id, start_ns,
+                                      end_ns);
+}
+
+namespace {
+
+// NOTE(Jack): Databases written before the chunk tables existed store the imu data and imu errors in the imu_data and
+// imu_errors tables, one row per sample. Without this migration a cache hit on such a database would load no imu data
+// at all. Everything is migrated and the row tables dropped in one transaction, so the database is either migrated
+// completely or not touched. Read only opens cannot migrate and see no imu data until the database is opened writable.
+void MigrateImuRowTables(sqlite3* const db) {
+    bool exists{false};
+    ExecuteQuery(db, sql_statements::imu_data_rows_exists, nullptr,
+                 [&exists](sqlite3_stmt* const stmt) { exists = sqlite3_column_int(stmt, 0) != 0; });
+    if (not exists) {
+        return;
+    }
+
+    std::map<std::pair<int64_t, int64_t>, ImuMeasurements> imu_data;
+    ExecuteQuery(db, sql_statements::imu_data_rows_select_all, nullptr, [&imu_data](sqlite3_stmt* const stmt) {
+        uint64_t const timestamp_ns{static_cast<uint64_t>(sqlite3_column_int64(stmt, 2))};
+        Array6d const imu_data_i{ReadEigenColumn<6>(stmt, 3)};
+        imu_data[{sqlite3_column_int64(stmt, 0), sqlite3_column_int64(stmt, 1)}].insert(
+            ImuMeasurement{timestamp_ns, {imu_data_i.topRows<3>(), imu_data_i.bottomRows<3>()}});
+    });
+
+    std::map<std::tuple<int64_t, int64_t, int64_t>, ImuErrors> imu_errors;
+    ExecuteQuery(db, sql_statements::imu_errors_rows_select_all, nullptr, [&imu_errors](sqlite3_stmt* const stmt) {
+        uint64_t const timestamp_ns{static_cast<uint64_t>(sqlite3_column_int64(stmt, 3))};
+        Array6d const imu_error_i{ReadEigenColumn<6>(stmt, 4)};
+        imu_errors[{sqlite3_column_int64(stmt, 0), sqlite3_column_int64(stmt, 1), sqlite3_column_int64(stmt, 2)}]
+            .insert(ImuError{timestamp_ns, {imu_error_i.topRows<3>(), imu_error_i.bottomRows<3>()}});
+    });
+
+    // NOTE(Jack): Not a SqlTransaction, because that commits when it is destroyed during a throw. A migration which
+    // failed halfway has to be rolled back completely, otherwise it would fail again on every following open.
+    ExecuteStatement("BEGIN TRANSACTION", db);
+    try {
+        for (auto const& [key, data] : imu_data) {
+            auto const binder{ImuDataChunkBinder(StepId{key.first}, AssetId{key.second})};
+            for (auto const& chunk : ImuChunks(data)) {
+                ExecuteStatement(
+                    sql_statements::imu_data_chunks_insert, [&](sqlite3_stmt* const stmt) { binder(stmt, chunk); },
+                    db);
+            }
+        }
+        for (auto const& [key, data] : imu_errors) {
+            auto const& [step_id, source_step_id, asset_id]{key};
+            auto const binder{ImuErrorsChunkBinder(StepId{step_id}, StepId{source_step_id}, AssetId{asset_id})};
+            for (auto const& chunk : ImuChunks(data)) {
+                ExecuteStatement(
+                    sql_statements::imu_errors_chunks_insert, [&](sqlite3_stmt* const stmt) { binder(stmt, chunk); },
+                    db);
+            }
+        }
 
-    BatchExecuteStatement(sql_statements::imu_errors_insert, data, binder, db);
+        // NOTE(Jack): The imu_errors rows reference the imu_data rows, so they have to be dropped first.
+        ExecuteStatement(sql_statements::imu_errors_rows_drop, db);
+        ExecuteStatement(sql_statements::imu_data_rows_drop, db);
+    } catch (...) {                             // LCOV_EXCL_LINE
+        if (sqlite3_get_autocommit(db) == 0) {  // LCOV_EXCL_LINE
+            ExecuteStatement("ROLLBACK", db);   // LCOV_EXCL_LINE
+        }
+        throw;  // LCOV_EXCL_LINE
+    }
+    ExecuteStatement("END TRANSACTION", db);
 }
 
+}  // namespace
+
 void IntrinsicInsert(sqlite3* const db, StepId const step_id, AssetId const asset_id, CameraModel const camera_model,
                      CameraState const& data) {
     auto const binder{[step_id, asset_id, camera_model, data](sqlite3_stmt* const stmt) {
@@ -551,6 +885,158 @@ void ReprojectionErrorsInsert(sqlite3* const db, StepId const step_id, StepId co
     BatchExecuteStatement(sql_statements::reprojection_errors_insert, data, binder, db);
 }
 
+ReprojectionErrors ReprojectionErrorsSelect(sqlite3* const db, StepId const step_id, AssetId const asset_id) {
+    ReprojectionErrors data;
+
+    ExecuteQuery(
+        db, sql_statements::reprojection_errors_select,
+        [step_id, asset_id](sqlite3_stmt* const stmt) {
+            Bind(stmt, 1, step_id.value);
+            Bind(stmt, 2, asset_id.value);
+        },
+        [&data](sqlite3_stmt* const stmt) {
+            uint64_t const timestamp_ns{static_cast<uint64_t>(sqlite3_column_int64(stmt, 0))};
+
+            auto const blob{SqliteBlob(stmt, 1)};
+            protobuf_serialization::ArrayX2dProto serialized;
+            serialized.ParseFromArray(std::data(blob), static_cast<int>(std::size(blob)));
+
+            auto const deserialized{Deserialize(serialized)};
+            if (not deserialized) {
+                throw std::runtime_error(std::format(  // LCOV_EXCL_LINE
+                    "ArrayX2dProto.ParseFromArray()/Deserialize() failed: "
+                    "timestamp_ns '{}'",  // LCOV_EXCL_LINE
+                    timestamp_ns));       // LCOV_EXCL_LINE
+            }
+
+            data.insert({timestamp_ns, deserialized.value()});
+        });
+
+    return data;
+}  // LCOV_EXCL_LINE
+
+void SolverIterationsInsert(sqlite3* const db, StepId const step_id, std::vector<SolverIteration> const& data) {
+    auto const binder{[step_id](sqlite3_stmt* const stmt, SolverIteration const& data_i) {
+        Bind(stmt, 1, step_id.value);
+        Bind(stmt, 2, static_cast<int64_t>(data_i.iteration));
+        Bind(stmt, 3, data_i.cost);
+        Bind(stmt, 4, data_i.gradient_norm);
+        Bind(stmt, 5, data_i.step_norm);
+        Bind(stmt, 6, data_i.iteration_time_s);
+        Bind(stmt, 7, data_i.cumulative_time_s);
+        Bind(stmt, 8, static_cast<int64_t>(data_i.step_is_successful));
+    }};
+
+    BatchExecuteStatement(sql_statements::solver_iterations_insert, data, binder, db);
+}
+
+std::vector<SolverIteration> SolverIterationsSelect(sqlite3* const db, StepId const step_id) {
+    std::vector<SolverIteration> data;
+
+    ExecuteQuery(
+        db, sql_statements::solver_iterations_select,
+        [step_id](sqlite3_stmt* const stmt) { Bind(stmt, 1, step_id.value); },
+        [&data](sqlite3_stmt* const stmt) {
+            data.push_back(SolverIteration{sqlite3_column_int(stmt, 0), sqlite3_column_double(stmt, 1),
+                                           sqlite3_column_double(stmt, 2), sqlite3_column_double(stmt, 3),
+                                           sqlite3_column_double(stmt, 4), sqlite3_column_double(stmt, 5),
+                                           sqlite3_column_int(stmt, 6) != 0});
+        });
+
+    return data;
+}
+
+void SolverMetricsInsert(sqlite3* const db, StepId const step_id, SolverMetrics const& data) {
+    auto const binder{[step_id, data](sqlite3_stmt* const stmt) {
+        Bind(stmt, 1, step_id.value);
+        Bind(stmt, 2, data.initial_cost);
+        Bind(stmt, 3, data.final_cost);
+        Bind(stmt, 4, static_cast<int64_t>(data.num_successful_steps));
+        Bind(stmt, 5, static_cast<int64_t>(data.num_unsuccessful_steps));
+        Bind(stmt, 6, data.preprocessor_time_s);
+        Bind(stmt, 7, data.minimizer_time_s);
+        Bind(stmt, 8, data.linear_solver_time_s);
+        Bind(stmt, 9, data.jacobian_evaluation_time_s);
+        Bind(stmt, 10, data.residual_evaluation_time_s);
+        Bind(stmt, 11, data.postprocessor_time_s);
+        Bind(stmt, 12, data.total_time_s);
+    }};
+
+    ExecuteStatement(sql_statements::solver_metrics_insert, binder, db);
+}
+
+std::expected<SolverMetrics, std::string> SolverMetricsSelect(sqlite3* const db, StepId const step_id) {
+    std::optional<SolverMetrics> data;
+
+    ExecuteQuery(
+        db, sql_statements::solver_metrics_select,
+        [step_id](sqlite3_stmt* const stmt) { Bind(stmt, 1, step_id.value); },
+        [&data](sqlite3_stmt* const stmt) {
+            data = SolverMetrics{sqlite3_column_double(stmt, 0), sqlite3_column_double(stmt, 1),
+                                 sqlite3_column_int(stmt, 2),    sqlite3_column_int(stmt, 3),
+                                 sqlite3_column_double(stmt, 4), sqlite3_column_double(stmt, 5),
+                                 sqlite3_column_double(stmt, 6), sqlite3_column_double(stmt, 7),
+                                 sqlite3_column_double(stmt, 8), sqlite3_column_double(stmt, 9),
+                                 sqlite3_column_double(stmt, 10)};
+        });
+
+    if (data) {
+        return *data;
+    } else {
+        return std::unexpected(
+            std::format("{{'database::': '{}', 'step_id': {}}}", "SolverMetricsSelect", step_id.value));
+    }
+}
+
+void SolverSnapshotInsert(sqlite3* const db, StepId const step_id, SolverSnapshot const& data) {
+    auto const binder{[step_id, data](sqlite3_stmt* const stmt) {
+        Bind(stmt, 1, step_id.value);
+        Bind(stmt, 2, static_cast<int64_t>(data.iteration));
+        if (data.intrinsics) {
+            auto const& [camera_model, intrinsics]{*data.intrinsics};
+            Bind(stmt, 3, ToString(camera_model));
+            Bind(stmt, 4, ToToml(camera_model, intrinsics));
+        } else {
+            BindNull(stmt, 3);
+            BindNull(stmt, 4);
+        }
+        if (data.se3_a_b) {
+            BindEigenColumn<Array6d>(stmt, 5, *data.se3_a_b);
+        } else {
+            for (int i{5}; i < 11; ++i) {
+                BindNull(stmt, i);
+            }
+        }
+    }};
+
+    ExecuteStatement(sql_statements::solver_snapshots_insert, binder, db);
+}
+
+std::vector<SolverSnapshot> SolverSnapshotsSelect(sqlite3* const db, StepId const step_id) {
+    std::vector<SolverSnapshot> data;
+
+    ExecuteQuery(
+        db, sql_statements::solver_snapshots_select,
+        [step_id](sqlite3_stmt* const stmt) { Bind(stmt, 1, step_id.value); },
+        [&data](sqlite3_stmt* const stmt) {
+            SolverSnapshot snapshot{sqlite3_column_int(stmt, 0), std::nullopt, std::nullopt};
+            if (sqlite3_column_type(stmt, 1) != SQLITE_NULL) {
+                CameraModel const camera_model{
+                    ToCameraModel(std::string(reinterpret_cast<char const*>(sqlite3_column_text(stmt, 1))))};
+                snapshot.intrinsics = std::pair{
+                    camera_model,
+                    FromToml(camera_model, std::string(reinterpret_cast<char const*>(sqlite3_column_text(stmt, 2))))};
+            }
+            if (sqlite3_column_type(stmt, 3) != SQLITE_NULL) {
+                snapshot.se3_a_b = ReadEigenColumn<6>(stmt, 3);
+            }
+
+            data.push_back(snapshot);
+        });
+
+    return data;
+}
+
 void SplineInfoInsert(sqlite3* const db, StepId step_id, AssetId asset_id, spline::TimeHandler const& time_handler) {
     auto const binder{[step_id, asset_id, time_handler](sqlite3_stmt* const stmt) {
         Bind(stmt, 1, step_id.value);
@@ -563,6 +1049,28 @@ void SplineInfoInsert(sqlite3* const db, StepId step_id, AssetId asset_id, splin
     }};
 
     ExecuteStatement(sql_statements::spline_info_insert, binder, db);
+
+    // NOTE(Jack): Uniform splines are fully described by t0_ns and delta_t_ns, only non-uniform splines store their
+    // knots.
+    if (time_handler.IsUniform()) {
+        return;
+    }
+
+    auto const indexed_knots{std::views::iota(0, static_cast<int>(std::size(time_handler.knots_ns_))) |
+                             std::views::transform([&time_handler](int const i) {
+                                 return std::pair{i, time_handler.knots_ns_[i]};
+                             })};
+
+    auto const knot_binder{[step_id, asset_id](sqlite3_stmt* const stmt, auto const& data_i) {
+        auto const& [i, knot_ns]{data_i};
+
+        Bind(stmt, 1, step_id.value);
+        Bind(stmt, 2, asset_id.value);
+        Bind(stmt, 3, static_cast<int64_t>(i));
+        Bind(stmt, 4, knot_ns);
+    }};
+
+    BatchExecuteStatement(sql_statements::spline_knots_insert, indexed_knots, knot_binder, db);
 }
 
 // TODO(Jack): Does adding a real SplineInfo struct make sense? Would that simplify some of the complexity we had
@@ -589,12 +1097,55 @@ std::expected<spline::TimeHandler, std::string> SplineInfoSelect(sqlite3* const
             time_handler = spline::TimeHandler{t0_ns, delta_t_ns};
         });
 
-    if (time_handler) {
-        return *time_handler;
-    } else {
+    if (not time_handler) {
         return std::unexpected(std::format("{{'database::': '{}', 'step_id': {}, 'asset_id': {}}}", "SplineInfoSelect",
                                            step_id.value, asset_id.value));
     }
+
+    std::vector<std::uint64_t> knots_ns;
+    ExecuteQuery(
+        db, sql_statements::spline_knots_select,
+        [step_id, asset_id](sqlite3_stmt* const stmt) {
+            Bind(stmt, 1, step_id.value);
+            Bind(stmt, 2, asset_id.value);
+        },
+        [&knots_ns](sqlite3_stmt* const stmt) {
+            knots_ns.push_back(static_cast<uint64_t>(sqlite3_column_int64(stmt, 0)));
+        });
+
+    // NOTE(Jack): Like for the control points this only works because the knots are loaded ordered by their idx.
+    if (not std::empty(knots_ns)) {
+        return spline::TimeHandler{std::move(knots_ns)};
+    }
+
+    return *time_handler;
+}
+
+void StepMetricsInsert(sqlite3* const db, StepId const step_id, StepMetrics const& data) {
+    auto const binder{[step_id, data](sqlite3_stmt* const stmt) {
+        Bind(stmt, 1, step_id.value);
+        Bind(stmt, 2, ToString(data.cache_status));
+        Bind(stmt, 3, data.wall_time_s);
+        Bind(stmt, 4, data.cpu_time_s);
+        Bind(stmt, 5, data.peak_rss_delta_kb);
+        Bind(stmt, 6, static_cast<int64_t>(data.peak_num_threads));
+    }};
+
+    ExecuteStatement(sql_statements::step_metrics_insert, binder, db);
+}
+
+std::vector<StepMetrics> StepMetricsSelect(sqlite3* const db, StepId const step_id) {
+    std::vector<StepMetrics> data;
+
+    ExecuteQuery(
+        db, sql_statements::step_metrics_select, [step_id](sqlite3_stmt* const stmt) { Bind(stmt, 1, step_id.value); },
+        [&data](sqlite3_stmt* const stmt) {
+            data.push_back(StepMetrics{ToCacheStatus(reinterpret_cast<char const*>(sqlite3_column_text(stmt, 0))),
+                                       sqlite3_column_double(stmt, 1), sqlite3_column_double(stmt, 2),
+                                       sqlite3_column_int64(stmt, 3), sqlite3_column_int(stmt, 4)});
+        });
+
+    return data;
 }
 
 void TargetInfoInsert(sqlite3* const db, StepId const step_id, AssetId const asset_id, TargetInfo const& target_info) {
@@ -640,4 +1191,64 @@ std::expected<TargetInfo, std::string> TargetInfoSelect(sqlite3* const db, StepI
     }
 }
 
+std::expected<std::pair<StepId, Hash>, std::string> WarmStartSourceSelect(sqlite3* const db, AssetId const asset_id,
+                                                                          CameraModel const camera_model) {
+    std::optional<std::pair<StepId, Hash>> source{std::nullopt};
+
+    ExecuteQuery(
+        db, sql_statements::warm_start_source_select,
+        [asset_id, camera_model](sqlite3_stmt* const stmt) {
+            Bind(stmt, 1, ToString(StepType::BundleAdjustment));
+            Bind(stmt, 2, asset_id.value);
+            Bind(stmt, 3, ToString(camera_model));
+        },
+        [&source](sqlite3_stmt* const stmt) {
+            source = std::make_pair(StepId{sqlite3_column_int64(stmt, 0)},
+                                    Hash{reinterpret_cast<char const*>(sqlite3_column_text(stmt, 1))});
+        });
+
+    if (source) {
+        return *source;
+    } else {
+        return std::unexpected(std::format("{{'database::': '{}', 'asset_id': {}, 'camera_model': '{}'}}",
+                                           "WarmStartSourceSelect", asset_id.value, ToString(camera_model)));
+    }
+}  // LCOV_EXCL_LINE
+
+void WarmStartInsert(sqlite3* const db, StepId const step_id, AssetId const asset_id, Hash const& input_key,
+                     StepId const source_step_id, Hash const& source_key, int const matched_frames) {
+    auto const binder{[step_id, asset_id, &input_key, source_step_id, &source_key,
+                       matched_frames](sqlite3_stmt* const stmt) {
+        Bind(stmt, 1, step_id.value);
+        Bind(stmt, 2, asset_id.value);
+        Bind(stmt, 3, input_key.value);
+        Bind(stmt, 4, source_step_id.value);
+        Bind(stmt, 5, source_key.value);
+        Bind(stmt, 6, static_cast<int64_t>(matched_frames));
+    }};
+
+    ExecuteStatement(sql_statements::warm_starts_insert, binder, db);
+}
+
+std::expected<Hash, std::string> WarmStartSelect(sqlite3* const db, StepId const step_id, Hash const& input_key) {
+    std::optional<Hash> source_key{std::nullopt};
+
+    ExecuteQuery(
+        db, sql_statements::warm_starts_select,
+        [step_id, &input_key](sqlite3_stmt* const stmt) {
+            Bind(stmt, 1, step_id.value);
+            Bind(stmt, 2, input_key.value);
+        },
+        [&source_key](sqlite3_stmt* const stmt) {
+            source_key = Hash{reinterpret_cast<char const*>(sqlite3_column_text(stmt, 0))};
+        });
+
+    if (source_key) {
+        return *source_key;
+    } else {
+        return std::unexpected(std::format("{{'database::': '{}', 'step_id': {}, 'input_key': '{}'}}",
+                                           "WarmStartSelect", step_id.value, input_key.value));
+    }
+}  // LCOV_EXCL_LINE
+
 }  // namespace reprojection::database
\ No newline at end of file
@@ -0,0 +1,322 @@
+#include "database/columnar_export.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <toml++/toml.hpp>
+
+// cppcheck-suppress missingInclude
+#include "generated/sql.hpp"
+#include "types/calibration_types.hpp"
+#include "types/enums.hpp"
+
+#include "serialization.hpp"
+#include "sqlite_helpers.hpp"
+#include "toml_converters.hpp"
+
+namespace reprojection::database {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// NOTE(Jack): We write the values exactly as they are in memory. Every platform we support is little endian, and if
+// that ever changes this is the place where the byte swapping has to happen.
+static_assert(std::endian::native == std::endian::little, "The columnar export only supports little endian");
+
+// NOTE(Jack): Per column, so with the ten columns of the camera poses table we hold at most ~640KB in memory.
+constexpr std::size_t buffer_rows{8192};
+
+template <typename T>
+constexpr std::string_view DType() {
+    if constexpr (std::is_same_v<T, int64_t>) {
+        return "int64";
+    } else if constexpr (std::is_same_v<T, uint64_t>) {
+        return "uint64";
+    } else {
+        static_assert(std::is_same_v<T, double>, "Unsupported column type");
+        return "float64";
+    }
+}
+
+std::string ColumnFile(std::string_view const name) { return std::format("{}.bin", name); }
+
+template <typename T>
+class Column {
+   public:
+    Column(fs::path const& table_dir, std::string_view const name)
+        : name_{name}, file_{table_dir / ColumnFile(name), std::ios::binary | std::ios::trunc} {
+        if (not file_) {
+            throw std::runtime_error(std::format("Failed to open column file: '{}'",          // LCOV_EXCL_LINE
+                                                 (table_dir / ColumnFile(name_)).string()));  // LCOV_EXCL_LINE
+        }
+        buffer_.reserve(buffer_rows);
+    }
+
+    void Push(T const value) {
+        buffer_.push_back(value);
+        if (std::size(buffer_) == buffer_rows) {
+            Flush();
+        }
+    }
+
+    // Flushes the remaining buffered values and returns the schema entry of the column.
+    toml::table Finish() {
+        Flush();
+        file_.close();
+
+        return toml::table{{"name", name_},
+                           {"dtype", DType<T>()},
+                           {"file", ColumnFile(name_)},
+                           {"rows", static_cast<int64_t>(rows_)}};
+    }
+
+   private:
+    void Flush() {
+        file_.write(reinterpret_cast<char const*>(std::data(buffer_)),
+                    static_cast<std::streamsize>(std::size(buffer_) * sizeof(T)));
+        if (not file_) {
+            throw std::runtime_error(std::format("Failed to write column: '{}'", name_));  // LCOV_EXCL_LINE
+        }
+
+        rows_ += std::size(buffer_);
+        buffer_.clear();
+    }
+
+    std::string name_;
+    std::ofstream file_;
+    std::vector<T> buffer_;
+    std::size_t rows_{0};
+};
+
+// NOTE(Jack): All the tables are keyed the same way, only the intrinsics have no timestamp.
+struct KeyColumns {
+    explicit KeyColumns(fs::path const& table_dir)
+        : step_id{table_dir, "step_id"}, asset_id{table_dir, "asset_id"}, timestamp_ns{table_dir, "timestamp_ns"} {}
+
+    void Push(int64_t const step_id_i, int64_t const asset_id_i, uint64_t const timestamp_ns_i) {
+        step_id.Push(step_id_i);
+        asset_id.Push(asset_id_i);
+        timestamp_ns.Push(timestamp_ns_i);
+    }
+
+    // Reads the keys from the first three columns of the query.
+    void Push(sqlite3_stmt* const stmt) {
+        Push(sqlite3_column_int64(stmt, 0), sqlite3_column_int64(stmt, 1),
+             static_cast<uint64_t>(sqlite3_column_int64(stmt, 2)));
+    }
+
+    void Finish(toml::array& columns) {
+        columns.push_back(step_id.Finish());
+        columns.push_back(asset_id.Finish());
+        columns.push_back(timestamp_ns.Finish());
+    }
+
+    Column<int64_t> step_id;
+    Column<int64_t> asset_id;
+    Column<uint64_t> timestamp_ns;
+};
+
+void WriteSchema(fs::path const& table_dir, toml::array columns, toml::table schema = {}) {
+    int64_t const rows{columns.empty() ? 0 : columns[0].as_table()->at("rows").value_or<int64_t>(0)};
+    for (auto const& column : columns) {
+        if (column.as_table()->at("rows").value_or<int64_t>(0) != rows) {
+            throw std::runtime_error(std::format(  // LCOV_EXCL_LINE
+                "LIBRARY IMPLEMENTATION ERROR - Columns of different length in table: '{}'",  // LCOV_EXCL_LINE
+                table_dir.string()));                                                         // LCOV_EXCL_LINE
+        }
+    }
+
+    schema.insert("rows", rows);
+    schema.insert("byte_order", "little");
+    schema.insert("columns", std::move(columns));
+
+    std::ofstream file{table_dir / "schema.toml", std::ios::trunc};
+    file << schema;
+    if (not file) {
+        throw std::runtime_error(std::format("Failed to write schema: '{}'", table_dir.string()));  // LCOV_EXCL_LINE
+    }
+}
+
+fs::path CreateTableDir(fs::path const& output_dir, std::string_view const table) {
+    fs::path const table_dir{output_dir / table};
+    fs::create_directories(table_dir);
+
+    return table_dir;
+}
+
+// NOTE(Jack): The camera poses and imu errors are both a key and six doubles per row.
+struct SixValueColumns {
+    SixValueColumns(fs::path const& table_dir, std::array<std::string_view, 6> const& value_names) : keys{table_dir} {
+        values.reserve(std::size(value_names));
+        for (auto const name : value_names) {
+            values.emplace_back(table_dir, name);
+        }
+    }
+
+    void Push(int64_t const step_id, int64_t const asset_id, uint64_t const timestamp_ns, Array6d const& row) {
+        keys.Push(step_id, asset_id, timestamp_ns);
+        for (int i{0}; i < std::ssize(values); ++i) {
+            values[i].Push(row(i));
+        }
+    }
+
+    void Finish(fs::path const& table_dir) {
+        toml::array columns;
+        keys.Finish(columns);
+        for (auto& value : values) {
+            columns.push_back(value.Finish());
+        }
+        WriteSchema(table_dir, std::move(columns));
+    }
+
+    KeyColumns keys;
+    std::vector<Column<double>> values;
+};
+
+void ExportCameraPoses(sqlite3* const db, WorkflowId const workflow_id, fs::path const& table_dir) {
+    SixValueColumns columns{table_dir, {"rx", "ry", "rz", "x", "y", "z"}};
+
+    ExecuteQuery(
+        db, sql_statements::camera_poses_export,
+        [workflow_id](sqlite3_stmt* const stmt) { Bind(stmt, 1, workflow_id.value); },
+        [&columns](sqlite3_stmt* const stmt) {
+            columns.Push(sqlite3_column_int64(stmt, 0), sqlite3_column_int64(stmt, 1),
+                         static_cast<uint64_t>(sqlite3_column_int64(stmt, 2)), ReadEigenColumn<6>(stmt, 3));
+        });
+
+    columns.Finish(table_dir);
+}
+
+// NOTE(Jack): The imu errors are stored in chunks (see ImuErrorsInsert()), which we unpack here one at a time.
+void ExportImuErrors(sqlite3* const db, WorkflowId const workflow_id, fs::path const& table_dir) {
+    SixValueColumns columns{table_dir, {"omega_x", "omega_y", "omega_z", "ax", "ay", "az"}};
+
+    ExecuteQuery(
+        db, sql_statements::imu_errors_chunks_export,
+        [workflow_id](sqlite3_stmt* const stmt) { Bind(stmt, 1, workflow_id.value); },
+        [&columns](sqlite3_stmt* const stmt) {
+            int64_t const step_id{sqlite3_column_int64(stmt, 0)};
+            int64_t const asset_id{sqlite3_column_int64(stmt, 1)};
+
+            auto const blob{SqliteBlob(stmt, 2)};
+            protobuf_serialization::ImuChunkProto serialized;
+            serialized.ParseFromArray(std::data(blob), static_cast<int>(std::size(blob)));
+
+            auto const deserialized{
+                DeserializeImuChunk<ImuErrors>(serialized, 0, std::numeric_limits<uint64_t>::max())};
+            if (not deserialized) {
+                throw std::runtime_error(std::format(  // LCOV_EXCL_LINE
+                    "ImuChunkProto.ParseFromArray()/DeserializeImuChunk() failed: "
+                    "step_id '{}', asset_id '{}'",  // LCOV_EXCL_LINE
+                    step_id, asset_id));            // LCOV_EXCL_LINE
+            }
+
+            for (auto const& [timestamp_ns, error] : *deserialized) {
+                columns.Push(step_id, asset_id, timestamp_ns,
+                             (Array6d() << error.delta_angular_velocity, error.delta_linear_acceleration).finished());
+            }
+        });
+
+    columns.Finish(table_dir);
+}
+
+void ExportReprojectionErrors(sqlite3* const db, WorkflowId const workflow_id, fs::path const& table_dir) {
+    KeyColumns keys{table_dir};
+    Column<double> residual_u{table_dir, "residual_u"};
+    Column<double> residual_v{table_dir, "residual_v"};
+
+    ExecuteQuery(
+        db, sql_statements::reprojection_errors_export,
+        [workflow_id](sqlite3_stmt* const stmt) { Bind(stmt, 1, workflow_id.value); },
+        [&keys, &residual_u, &residual_v](sqlite3_stmt* const stmt) {
+            auto const blob{SqliteBlob(stmt, 3)};
+            protobuf_serialization::ArrayX2dProto serialized;
+            serialized.ParseFromArray(std::data(blob), static_cast<int>(std::size(blob)));
+
+            auto const deserialized{Deserialize(serialized)};
+            if (not deserialized) {
+                throw std::runtime_error(std::format(  // LCOV_EXCL_LINE
+                    "ArrayX2dProto.ParseFromArray()/Deserialize() failed: "
+                    "timestamp_ns '{}'",                // LCOV_EXCL_LINE
+                    sqlite3_column_int64(stmt, 2)));  // LCOV_EXCL_LINE
+            }
+
+            // One row per residual, the keys are repeated for every residual of the frame.
+            for (Eigen::Index i{0}; i < deserialized->rows(); ++i) {
+                keys.Push(stmt);
+                residual_u.Push((*deserialized)(i, 0));
+                residual_v.Push((*deserialized)(i, 1));
+            }
+        });
+
+    toml::array columns;
+    keys.Finish(columns);
+    columns.push_back(residual_u.Finish());
+    columns.push_back(residual_v.Finish());
+    WriteSchema(table_dir, std::move(columns));
+}
+
+void ExportIntrinsics(sqlite3* const db, WorkflowId const workflow_id, fs::path const& table_dir) {
+    Column<int64_t> step_id{table_dir, "step_id"};
+    Column<int64_t> asset_id{table_dir, "asset_id"};
+    Column<int64_t> camera_model{table_dir, "camera_model"};
+    Column<int64_t> parameter{table_dir, "parameter"};
+    Column<double> value{table_dir, "value"};
+
+    ExecuteQuery(
+        db, sql_statements::intrinsics_export,
+        [workflow_id](sqlite3_stmt* const stmt) { Bind(stmt, 1, workflow_id.value); },
+        [&step_id, &asset_id, &camera_model, &parameter, &value](sqlite3_stmt* const stmt) {
+            CameraModel const model{
+                ToCameraModel(std::string(reinterpret_cast<char const*>(sqlite3_column_text(stmt, 2))))};
+            ArrayXd const intrinsics{
+                FromToml(model, std::string(reinterpret_cast<char const*>(sqlite3_column_text(stmt, 3))))};
+
+            // One row per parameter, in the same order as the intrinsics vector of the camera model.
+            for (Eigen::Index i{0}; i < intrinsics.size(); ++i) {
+                step_id.Push(sqlite3_column_int64(stmt, 0));
+                asset_id.Push(sqlite3_column_int64(stmt, 1));
+                camera_model.Push(static_cast<int64_t>(model));
+                parameter.Push(i);
+                value.Push(intrinsics(i));
+            }
+        });
+
+    // NOTE(Jack): The camera model is stored as its enum value, so that the column stays fixed width. The schema
+    // carries the mapping back to the name used everywhere else (config, database).
+    toml::table camera_models;
+    for (auto const model : {CameraModel::DoubleSphere, CameraModel::Pinhole, CameraModel::PinholeRadtan4,
+                             CameraModel::UnifiedCameraModel}) {
+        camera_models.insert(ToString(model), static_cast<int64_t>(model));
+    }
+
+    toml::array columns;
+    columns.push_back(step_id.Finish());
+    columns.push_back(asset_id.Finish());
+    columns.push_back(camera_model.Finish());
+    columns.push_back(parameter.Finish());
+    columns.push_back(value.Finish());
+    WriteSchema(table_dir, std::move(columns),
+                toml::table{{"categories", toml::table{{"camera_model", std::move(camera_models)}}}});
+}
+
+}  // namespace
+
+void ColumnarExport(sqlite3* const db, WorkflowId const workflow_id, fs::path const& output_dir) {
+    ExportCameraPoses(db, workflow_id, CreateTableDir(output_dir, "camera_poses"));
+    ExportImuErrors(db, workflow_id, CreateTableDir(output_dir, "imu_errors"));
+    ExportIntrinsics(db, workflow_id, CreateTableDir(output_dir, "intrinsics"));
+    ExportReprojectionErrors(db, workflow_id, CreateTableDir(output_dir, "reprojection_errors"));
+}
+
+}  // namespace reprojection::database
\ No newline at end of file
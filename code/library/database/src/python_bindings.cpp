@@ -0,0 +1,104 @@
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "database/calibration_database.hpp"
+#include "types/calibration_types.hpp"
+#include "types/sensor_data_types.hpp"
+
+namespace py = pybind11;
+
+namespace reprojection::database {
+
+namespace {
+
+// NOTE(Jack): The returned numpy array takes ownership of the already decoded data (via the capsule) and views it
+// directly, so nothing is copied. Eigen stores the data column wise, which we express with the strides and not by
+// transposing like the python protobuf parsing has to.
+template <typename T_Matrix>
+py::array ToNumpy(T_Matrix matrix) {
+    static_assert(not T_Matrix::IsRowMajor, "ToNumpy() expects column major storage");
+    using Scalar = typename T_Matrix::Scalar;
+
+    auto* const owned{new T_Matrix(std::move(matrix))};
+    py::capsule const owner{owned, [](void* const ptr) { delete static_cast<T_Matrix*>(ptr); }};
+
+    py::ssize_t const rows{owned->rows()};
+    py::ssize_t const cols{owned->cols()};
+    py::ssize_t constexpr scalar_size{sizeof(Scalar)};
+
+    return py::array_t<Scalar>({rows, cols}, {scalar_size, rows * scalar_size}, owned->data(), owner);
+}
+
+py::array ToNumpy(std::vector<uint64_t> vector) {
+    auto* const owned{new std::vector<uint64_t>(std::move(vector))};
+    py::capsule const owner{owned, [](void* const ptr) { delete static_cast<std::vector<uint64_t>*>(ptr); }};
+
+    return py::array_t<uint64_t>(std::ssize(*owned), owned->data(), owner);
+}
+
+// NOTE(Jack): Opening the database, reading and decoding the blobs is the expensive part and touches no python
+// objects, therefore we release the GIL so that the other python threads (ex. the dashboard server) keep running.
+template <typename T_Select>
+auto SelectWithoutGil(std::string const& db_path, int64_t const step_id, int64_t const asset_id,
+                      T_Select const& select) {
+    py::gil_scoped_release const release;
+
+    SqlitePtr const db{OpenCalibrationDatabase(db_path, false, true)};
+
+    return select(db.get(), StepId{step_id}, AssetId{asset_id});
+}
+
+py::tuple PyExtractedTargetsSelect(std::string const& db_path, int64_t const step_id, int64_t const asset_id) {
+    // NOTE(Jack): ExtractedTargetsSelect() also has a batch overload, the cast picks the one reading the whole step.
+    auto const select{static_cast<CameraMeasurements (*)(sqlite3*, StepId, AssetId)>(&ExtractedTargetsSelect)};
+    CameraMeasurements targets{SelectWithoutGil(db_path, step_id, asset_id, select)};
+
+    std::vector<uint64_t> timestamps_ns;
+    timestamps_ns.reserve(std::size(targets));
+    py::list data;
+    for (auto& [timestamp_ns, target] : targets) {
+        timestamps_ns.push_back(timestamp_ns);
+
+        py::dict target_i;
+        target_i["pixels"] = ToNumpy(std::move(target.bundle.pixels));
+        target_i["points"] = ToNumpy(std::move(target.bundle.points));
+        target_i["indices"] = ToNumpy(std::move(target.indices));
+        data.append(target_i);
+    }
+
+    return py::make_tuple(ToNumpy(std::move(timestamps_ns)), data);
+}
+
+py::tuple PyReprojectionErrorsSelect(std::string const& db_path, int64_t const step_id, int64_t const asset_id) {
+    ReprojectionErrors errors{SelectWithoutGil(db_path, step_id, asset_id, &ReprojectionErrorsSelect)};
+
+    std::vector<uint64_t> timestamps_ns;
+    timestamps_ns.reserve(std::size(errors));
+    py::list data;
+    for (auto& [timestamp_ns, error] : errors) {
+        timestamps_ns.push_back(timestamp_ns);
+        data.append(ToNumpy(std::move(error)));
+    }
+
+    return py::make_tuple(ToNumpy(std::move(timestamps_ns)), data);
+}
+
+}  // namespace
+
+// NOTE(Jack): Both selects return a tuple of the timestamps and the row data, in the same format as the python protobuf
+// parsing in python_tooling/database/proto_parsing.py, but as numpy arrays instead of lists.
+void BindSelects(py::module_& module) {
+    module.def("ExtractedTargetsSelect", &PyExtractedTargetsSelect, py::arg("db_path"), py::arg("step_id"),
+               py::arg("asset_id"));
+    module.def("ReprojectionErrorsSelect", &PyReprojectionErrorsSelect, py::arg("db_path"), py::arg("step_id"),
+               py::arg("asset_id"));
+}
+
+}  // namespace reprojection::database
+
+PYBIND11_MODULE(database_python_binding, module) { reprojection::database::BindSelects(module); }
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <iterator>
 #include <optional>
 
 #include "types/algorithm_types.hpp"
+#include "types/eigen_types.hpp"
 
 // TODO(Jack): How can we point cppcheck to the generated protobuf cpp files?
 // cppcheck-suppress missingInclude
@@ -23,4 +26,52 @@ inline bool ValidateDimensions(int const rows, int const cols, size_t const data
     return (static_cast<size_t>(rows) * static_cast<size_t>(cols)) == data_size;
 }
 
+// NOTE(Jack): The imu data (ImuMeasurements) and imu errors (ImuErrors) are both maps from a timestamp to a pair of
+// Vector3d, therefore they share one chunk serialization. The iterators are a range of one of those maps.
+template <typename T_Iterator>
+protobuf_serialization::ImuChunkProto SerializeImuChunk(T_Iterator const begin, T_Iterator const end) {
+    int const size{static_cast<int>(std::distance(begin, end))};
+
+    protobuf_serialization::ImuChunkProto imu_chunk_proto;
+    auto* const timestamps_ns{imu_chunk_proto.mutable_timestamps_ns()};
+    timestamps_ns->Reserve(size);
+    auto* const data{imu_chunk_proto.mutable_data()};
+    data->Resize(6 * size, 0.0);
+
+    int i{0};
+    for (auto it{begin}; it != end; ++it, ++i) {
+        auto const& [timestamp_ns, sample]{*it};
+        auto const& [angular_velocity, linear_acceleration]{sample};
+
+        timestamps_ns->Add(timestamp_ns);
+        Eigen::Map<Array6d>(data->mutable_data() + 6 * i) << angular_velocity, linear_acceleration;
+    }
+
+    return imu_chunk_proto;
+}  // LCOV_EXCL_LINE
+
+// Returns only the samples with a timestamp in the inclusive range [start_ns, end_ns].
+template <typename T_Map>
+std::optional<T_Map> DeserializeImuChunk(protobuf_serialization::ImuChunkProto const& imu_chunk_proto,
+                                         uint64_t const start_ns, uint64_t const end_ns) {
+    if (not ValidateDimensions(imu_chunk_proto.timestamps_ns_size(), 6, imu_chunk_proto.data_size())) {
+        return std::nullopt;
+    }
+
+    T_Map data;
+    for (int i{0}; i < imu_chunk_proto.timestamps_ns_size(); ++i) {
+        uint64_t const timestamp_ns{imu_chunk_proto.timestamps_ns(i)};
+        if (timestamp_ns < start_ns or timestamp_ns > end_ns) {
+            continue;
+        }
+
+        Eigen::Map<Array6d const> const sample{imu_chunk_proto.data().data() + 6 * i};
+        // NOTE(Jack): The samples are sorted, so the hint makes every insert constant time.
+        data.emplace_hint(std::cend(data), timestamp_ns,
+                          typename T_Map::mapped_type{sample.topRows<3>(), sample.bottomRows<3>()});
+    }
+
+    return data;
+}
+
 }  // namespace reprojection::database
\ No newline at end of file
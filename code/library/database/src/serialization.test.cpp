@@ -6,6 +6,8 @@
 #include <string>
 
 #include "types/algorithm_types.hpp"
+#include "types/calibration_types.hpp"
+#include "types/sensor_data_types.hpp"
 
 using namespace reprojection;
 
@@ -71,3 +73,34 @@ TEST(DatabaseSerialization, TestExtractedTargetDeserializationEmpty) {
     EXPECT_EQ(deserialized_opt->bundle.points.size(), 0);
     EXPECT_EQ(deserialized_opt->indices.size(), 0);
 }
+
+TEST(DatabaseSerialization, TestImuChunkSerialization) {
+    ImuMeasurements const original{{10, {{1, 2, 3}, {4, 5, 6}}}, {20, {{7, 8, 9}, {10, 11, 12}}}};
+
+    protobuf_serialization::ImuChunkProto const serialized{
+        database::SerializeImuChunk(std::cbegin(original), std::cend(original))};
+    EXPECT_EQ(serialized.timestamps_ns_size(), 2);
+    EXPECT_EQ(serialized.data_size(), 12);
+
+    auto const deserialized_opt{database::DeserializeImuChunk<ImuMeasurements>(serialized, 0, 20)};
+    ASSERT_TRUE(deserialized_opt.has_value());
+    ASSERT_EQ(std::size(*deserialized_opt), 2);
+    EXPECT_TRUE(deserialized_opt->at(20).angular_velocity.isApprox(original.at(20).angular_velocity));
+    EXPECT_TRUE(deserialized_opt->at(20).linear_acceleration.isApprox(original.at(20).linear_acceleration));
+
+    // The imu errors share the serialization, and only the samples inside the requested time range are returned.
+    ImuErrors const errors{{10, {{1, 2, 3}, {4, 5, 6}}}, {20, {{7, 8, 9}, {10, 11, 12}}}};
+    auto const errors_opt{database::DeserializeImuChunk<ImuErrors>(
+        database::SerializeImuChunk(std::cbegin(errors), std::cend(errors)), 15, 25)};
+    ASSERT_TRUE(errors_opt.has_value());
+    ASSERT_EQ(std::size(*errors_opt), 1);
+    EXPECT_TRUE(errors_opt->at(20).delta_linear_acceleration.isApprox(errors.at(20).delta_linear_acceleration));
+}
+
+TEST(DatabaseSerialization, TestImuChunkDeserializationInvalid) {
+    protobuf_serialization::ImuChunkProto original;
+    original.add_timestamps_ns(0);
+    original.add_data(1.0);
+
+    EXPECT_FALSE(database::DeserializeImuChunk<ImuMeasurements>(original, 0, 10).has_value());
+}
\ No newline at end of file
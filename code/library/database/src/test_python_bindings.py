@@ -0,0 +1,53 @@
+import sqlite3
+import unittest
+from pathlib import Path
+from tempfile import NamedTemporaryFile
+
+import numpy as np
+from database_python_binding import ExtractedTargetsSelect, ReprojectionErrorsSelect
+
+SQL_DIR = Path(__file__).resolve().parents[3] / "resources" / "sql"
+
+
+def create_table(db_path, table_name):
+    with sqlite3.connect(db_path) as conn:
+        conn.execute((SQL_DIR / f"{table_name}_table.sql").read_text())
+
+
+class TestPythonBinding(unittest.TestCase):
+    # NOTE(Jack): An empty blob is a valid serialized message with zero rows. Like for the projection function bindings
+    # the purpose here is to test the binding infrastructure, the deserialization itself is tested on the c++ side.
+    def test_extracted_targets_select(self):
+        with NamedTemporaryFile(suffix=".db3") as tmp:
+            create_table(tmp.name, "extracted_targets")
+            with sqlite3.connect(tmp.name) as conn:
+                conn.execute("INSERT INTO extracted_targets VALUES (1, 1, 2, 100, x'')")
+
+            timestamps_ns, data = ExtractedTargetsSelect(tmp.name, 1, 2)
+            np.testing.assert_array_equal(timestamps_ns, [100])
+            self.assertEqual(data[0]["pixels"].shape, (0, 2))
+            self.assertEqual(data[0]["points"].shape, (0, 3))
+            self.assertEqual(data[0]["indices"].shape, (0, 2))
+
+            timestamps_ns, data = ExtractedTargetsSelect(tmp.name, 1, 3)
+            self.assertEqual(timestamps_ns.size, 0)
+            self.assertEqual(data, [])
+
+    def test_reprojection_errors_select(self):
+        with NamedTemporaryFile(suffix=".db3") as tmp:
+            create_table(tmp.name, "reprojection_errors")
+            with sqlite3.connect(tmp.name) as conn:
+                conn.execute(
+                    "INSERT INTO reprojection_errors VALUES (1, 1, 2, 100, x'')"
+                )
+
+            timestamps_ns, data = ReprojectionErrorsSelect(tmp.name, 1, 2)
+            np.testing.assert_array_equal(timestamps_ns, [100])
+            self.assertEqual(data[0].shape, (0, 2))
+
+    def test_missing_database(self):
+        self.assertRaises(RuntimeError, ExtractedTargetsSelect, "nonexistent.db3", 1, 2)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,100 @@
+#include "database/artifact_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "database/calibration_database.hpp"
+#include "types/database_types.hpp"
+
+using namespace reprojection;
+
+class ArtifactCacheFixture : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        StepId const image_loading_id{database::GetOrCreateStep(db_.get(), StepType::ImageLoading, "").first};
+        database::ImagesInsert(db_.get(), image_loading_id, camera_id_, {{0, ImageBuffer{}}, {1, ImageBuffer{}}});
+
+        targets_id_ = database::GetOrCreateStep(db_.get(), StepType::FeatureExtraction, "").first;
+        ExtractedTarget const target{Bundle{MatrixX2d{{1, 2}}, MatrixX3d{{3, 4, 5}}}, {{6, 7}}};
+        database::ExtractedTargetsInsert(db_.get(), targets_id_, image_loading_id, camera_id_,
+                                         {{0, target}, {1, target}});
+
+        camera_info_id_ = database::GetOrCreateStep(db_.get(), StepType::CameraInfo, "").first;
+        database::CameraInfoInsert(db_.get(), camera_info_id_, camera_id_, {CameraModel::Pinhole, {0, 720, 0, 480}});
+    }
+
+    SqlitePtr db_{database::OpenCalibrationDatabase(":memory:", true)};
+    AssetId camera_id_{database::GetOrCreateAsset(db_.get(), AssetType::Camera, 0, "")};
+    StepId targets_id_;
+    StepId camera_info_id_;
+};
+
+TEST_F(ArtifactCacheFixture, TestWithoutScope) {
+    // Without a scope every call is a plain select that returns its own copy.
+    auto const targets_a{database::CachedExtractedTargetsSelect(db_.get(), targets_id_, camera_id_)};
+    auto const targets_b{database::CachedExtractedTargetsSelect(db_.get(), targets_id_, camera_id_)};
+    ASSERT_EQ(std::size(*targets_a), 2);
+    EXPECT_NE(targets_a, targets_b);
+
+    auto const camera_info{database::CachedCameraInfoSelect(db_.get(), camera_info_id_, camera_id_)};
+    ASSERT_TRUE(camera_info.has_value());
+    EXPECT_EQ(camera_info->bounds.u_max, 720);
+}
+
+TEST_F(ArtifactCacheFixture, TestScope) {
+    database::ArtifactCacheScope const scope{db_.get()};
+
+    auto const targets_a{database::CachedExtractedTargetsSelect(db_.get(), targets_id_, camera_id_)};
+    auto const targets_b{database::CachedExtractedTargetsSelect(db_.get(), targets_id_, camera_id_)};
+    EXPECT_EQ(targets_a, targets_b);
+    EXPECT_TRUE(targets_b->at(1).bundle.points.isApprox(MatrixX3d{{3, 4, 5}}));
+
+    // A different asset is a different artifact, even if it does not exist the result is an empty map.
+    auto const other_targets{database::CachedExtractedTargetsSelect(db_.get(), targets_id_, AssetId{111})};
+    EXPECT_NE(other_targets, targets_a);
+    EXPECT_TRUE(other_targets->empty());
+
+    EXPECT_TRUE(database::CachedCameraInfoSelect(db_.get(), camera_info_id_, camera_id_).has_value());
+    EXPECT_TRUE(database::CachedCameraInfoSelect(db_.get(), camera_info_id_, camera_id_).has_value());
+
+    auto const stats{scope.GetStats()};
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 3);
+    EXPECT_GT(stats.bytes, 0);
+
+    // Only one scope per database at a time.
+    EXPECT_THROW(database::ArtifactCacheScope{db_.get()}, std::runtime_error);
+}
+
+TEST_F(ArtifactCacheFixture, TestMissingArtifactNotCached) {
+    database::ArtifactCacheScope const scope{db_.get()};
+
+    StepId const step_id{database::GetOrCreateStep(db_.get(), StepType::CameraInfo, "other").first};
+    auto const missing{database::CachedCameraInfoSelect(db_.get(), step_id, camera_id_)};
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error(), database::CameraInfoSelect(db_.get(), step_id, camera_id_).error());
+
+    // Once the artifact is written it is found, because the failed select was not cached.
+    database::CameraInfoInsert(db_.get(), step_id, camera_id_, {CameraModel::DoubleSphere, {0, 20, 0, 10}});
+    auto const found{database::CachedCameraInfoSelect(db_.get(), step_id, camera_id_)};
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->camera_model, CameraModel::DoubleSphere);
+    EXPECT_EQ(scope.GetStats().misses, 1);
+}
+
+TEST_F(ArtifactCacheFixture, TestEviction) {
+    // The budget only fits the small camera info, the targets are evicted as soon as they are cached.
+    database::ArtifactCacheScope const scope{db_.get(), sizeof(CameraInfo)};
+
+    auto const targets_a{database::CachedExtractedTargetsSelect(db_.get(), targets_id_, camera_id_)};
+    auto const targets_b{database::CachedExtractedTargetsSelect(db_.get(), targets_id_, camera_id_)};
+    EXPECT_NE(targets_a, targets_b);
+    EXPECT_EQ(std::size(*targets_a), 2);  // Eviction does not touch the artifacts which are still in use
+
+    EXPECT_TRUE(database::CachedCameraInfoSelect(db_.get(), camera_info_id_, camera_id_).has_value());
+    EXPECT_TRUE(database::CachedCameraInfoSelect(db_.get(), camera_info_id_, camera_id_).has_value());
+
+    auto const stats{scope.GetStats()};
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 3);
+    EXPECT_EQ(stats.bytes, sizeof(CameraInfo));
+}
\ No newline at end of file
@@ -2,9 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <format>
 #include <string>
 
 #include "database/sqlite_exception.hpp"
+#include "testing_utilities/temporary_file.hpp"
 #include "types/database_types.hpp"
 
 using namespace reprojection;
@@ -232,6 +234,41 @@ TEST_F(CalibrationDatabaseFixture, TestImages) {
     EXPECT_EQ(std::size(result.at(timestamp_ns).data), 0);
 }
 
+TEST_F(CalibrationDatabaseFixture, TestImagesCursor) {
+    AssetId const asset_id{database::GetOrCreateAsset(db_.get(), AssetType::Camera, 0, "")};
+    StepId const step_id{database::GetOrCreateStep(db_.get(), StepType::ImageLoading, "").first};
+    EncodedImages const images{
+        {10, ImageBuffer{{1}}}, {20, ImageBuffer{{1, 2}}}, {30, ImageBuffer{}}, {40, ImageBuffer{}}};
+    database::ImagesInsert(db_.get(), step_id, asset_id, images);
+
+    auto const batch{database::ImagesSelect(db_.get(), step_id, asset_id, 15, 2)};
+    ASSERT_EQ(std::size(batch), 2);
+    EXPECT_EQ(std::cbegin(batch)->first, 20);
+    EXPECT_EQ(std::size(batch.at(20).data), 2);
+    EXPECT_TRUE(batch.contains(30));
+
+    // Five rows in batches of two, the last batch is not full and ends the iteration.
+    InsertImage(step_id, asset_id, 50);
+    database::SelectCursor<EncodedImages> cursor{db_.get(), &database::ImagesSelect, step_id, asset_id, 2};
+    std::vector<std::size_t> batch_sizes;
+    EncodedImages result;
+    for (EncodedImages batch_i{cursor.Next()}; not batch_i.empty(); batch_i = cursor.Next()) {
+        batch_sizes.push_back(std::size(batch_i));
+        result.merge(batch_i);
+    }
+    EXPECT_EQ(batch_sizes, (std::vector<std::size_t>{2, 2, 1}));
+    EXPECT_EQ(std::size(result), 5);
+    EXPECT_TRUE(cursor.Next().empty());
+
+    // When the last batch is exactly full it takes one more (empty) query to know that there are no more rows.
+    database::SelectCursor<EncodedImages> exact_cursor{db_.get(), &database::ImagesSelect, step_id, asset_id, 5};
+    EXPECT_EQ(std::size(exact_cursor.Next()), 5);
+    EXPECT_TRUE(exact_cursor.Next().empty());
+
+    ImageSizes const sizes{database::ImageSizesSelect(db_.get(), step_id, asset_id)};
+    EXPECT_EQ(sizes, (ImageSizes{{10, 1}, {20, 2}, {30, 0}, {40, 0}, {50, 0}}));
+}
+
 TEST(DatabaseCalibrationDatbase, TestImuData) {
     auto const db{database::OpenCalibrationDatabase(":memory:", true)};
 
@@ -247,6 +284,32 @@ TEST(DatabaseCalibrationDatbase, TestImuData) {
     EXPECT_TRUE(result.at(0).angular_velocity.isApprox(imu_data.at(0).angular_velocity));
 }
 
+TEST(DatabaseCalibrationDatbase, TestImuDataChunks) {
+    auto const db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    StepId const imu_data_id{database::GetOrCreateStep(db.get(), StepType::ImuDataLoading, "").first};
+    AssetId const asset_id{database::GetOrCreateAsset(db.get(), AssetType::Imu, 0, "")};
+
+    // 2.5 seconds of 100hz data, which is spread over three chunks.
+    ImuMeasurements imu_data;
+    for (uint64_t timestamp_ns{0}; timestamp_ns < 2'500'000'000; timestamp_ns += 10'000'000) {
+        imu_data.insert({timestamp_ns, {{1, 2, 3}, {4, 5, static_cast<double>(timestamp_ns)}}});
+    }
+    EXPECT_NO_THROW(database::ImuDataInsert(db.get(), imu_data_id, asset_id, imu_data));
+
+    auto const result{database::ImuDataSelect(db.get(), imu_data_id, asset_id)};
+    EXPECT_EQ(std::size(result), std::size(imu_data));
+
+    // A range which crosses the border between the first and second chunk, both ends are inclusive.
+    auto const range{database::ImuDataSelect(db.get(), imu_data_id, asset_id, 990'000'000, 1'010'000'000)};
+    ASSERT_EQ(std::size(range), 3);
+    EXPECT_EQ(std::cbegin(range)->first, 990'000'000);
+    EXPECT_EQ(std::crbegin(range)->first, 1'010'000'000);
+    EXPECT_EQ(range.at(1'000'000'000).linear_acceleration.z(), 1'000'000'000);
+
+    EXPECT_EQ(std::size(database::ImuDataSelect(db.get(), imu_data_id, asset_id, 3'000'000'000, 4'000'000'000)), 0);
+}
+
 TEST(DatabaseCalibrationDatbase, TestImuErrors) {
     auto const db{database::OpenCalibrationDatabase(":memory:", true)};
 
@@ -260,6 +323,56 @@ TEST(DatabaseCalibrationDatbase, TestImuErrors) {
 
     StepId const extrinsic_init_id{database::GetOrCreateStep(db.get(), StepType::ExtrinsicInit, "").first};
     EXPECT_NO_THROW(database::ImuErrorsInsert(db.get(), extrinsic_init_id, imu_data_id, asset_id, imu_errors));
+
+    auto const result{database::ImuErrorsSelect(db.get(), extrinsic_init_id, asset_id)};
+    EXPECT_EQ(std::size(result), std::size(imu_errors));
+    EXPECT_TRUE(result.at(1).delta_linear_acceleration.isApprox(imu_errors.at(1).delta_linear_acceleration));
+
+    EXPECT_EQ(std::size(database::ImuErrorsSelect(db.get(), extrinsic_init_id, asset_id, 1, 1)), 1);
+}
+
+TEST(DatabaseCalibrationDatbase, TestImuRowTablesMigration) {
+    testing_utilities::TemporaryFile const db_file{".db3"};
+    StepId imu_data_id;
+    StepId extrinsic_init_id;
+    AssetId asset_id;
+    {
+        // Recreate a database written before the chunk tables existed, with one row per imu sample.
+        auto const db{database::OpenCalibrationDatabase(db_file.Path(), true)};
+        imu_data_id = database::GetOrCreateStep(db.get(), StepType::ImuDataLoading, "").first;
+        extrinsic_init_id = database::GetOrCreateStep(db.get(), StepType::ExtrinsicInit, "").first;
+        asset_id = database::GetOrCreateAsset(db.get(), AssetType::Imu, 0, "");
+
+        std::string const sql{std::format(R"sql(
+            CREATE TABLE imu_data (step_id INTEGER, asset_id INTEGER, timestamp_ns INTEGER, omega_x REAL,
+                                   omega_y REAL, omega_z REAL, ax REAL, ay REAL, az REAL,
+                                   PRIMARY KEY (step_id, asset_id, timestamp_ns));
+            CREATE TABLE imu_errors (step_id INTEGER, source_step_id INTEGER, asset_id INTEGER, timestamp_ns INTEGER,
+                                     omega_x REAL, omega_y REAL, omega_z REAL, ax REAL, ay REAL, az REAL,
+                                     FOREIGN KEY (source_step_id, asset_id, timestamp_ns)
+                                         REFERENCES imu_data (step_id, asset_id, timestamp_ns));
+            INSERT INTO imu_data VALUES ({0}, {2}, 0, 1, 2, 3, 4, 5, 6), ({0}, {2}, 1500000000, 1, 2, 3, 4, 5, 7);
+            INSERT INTO imu_errors VALUES ({1}, {0}, {2}, 1500000000, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6);
+        )sql",
+                                          imu_data_id.value, extrinsic_init_id.value, asset_id.value)};
+        ASSERT_EQ(sqlite3_exec(db.get(), sql.c_str(), nullptr, nullptr, nullptr), SQLITE_OK);
+    }
+
+    // Opening the database moves the rows into the chunk tables, which is where all the readers look.
+    auto const db{database::OpenCalibrationDatabase(db_file.Path(), false)};
+
+    auto const imu_data{database::ImuDataSelect(db.get(), imu_data_id, asset_id)};
+    ASSERT_EQ(std::size(imu_data), 2);
+    EXPECT_EQ(imu_data.at(1'500'000'000).linear_acceleration.z(), 7);
+
+    auto const imu_errors{database::ImuErrorsSelect(db.get(), extrinsic_init_id, asset_id)};
+    ASSERT_EQ(std::size(imu_errors), 1);
+    EXPECT_EQ(imu_errors.at(1'500'000'000).delta_angular_velocity.x(), 0.1);
+
+    // The row tables are gone, so the migration only ever runs once.
+    EXPECT_NE(sqlite3_exec(db.get(), "SELECT * FROM imu_data;", nullptr, nullptr, nullptr), SQLITE_OK);
+    EXPECT_NO_THROW(database::OpenCalibrationDatabase(db_file.Path(), false));
+    EXPECT_EQ(std::size(database::ImuDataSelect(db.get(), imu_data_id, asset_id)), 2);
 }
 
 TEST(DatabaseCalibrationDatbase, TestIntrinsics) {
@@ -299,6 +412,82 @@ TEST_F(CalibrationDatabaseFixture, TestExtractedTargets) {
     EXPECT_EQ(result.at(0).indices.size(), 0);
 }
 
+TEST_F(CalibrationDatabaseFixture, TestExtractedTargetsCursor) {
+    AssetId const asset_id{database::GetOrCreateAsset(db_.get(), AssetType::Camera, 0, "")};
+    StepId const image_loading_id{database::GetOrCreateStep(db_.get(), StepType::ImageLoading, "").first};
+    CameraMeasurements targets;
+    for (uint64_t timestamp_ns{0}; timestamp_ns < 7; ++timestamp_ns) {
+        InsertImage(image_loading_id, asset_id, timestamp_ns);
+        targets.insert({timestamp_ns, ExtractedTarget{Bundle{MatrixX2d{{1, 2}}, MatrixX3d{{3, 4, 5}}}, {{6, 7}}}});
+    }
+    StepId const step_id{database::GetOrCreateStep(db_.get(), StepType::FeatureExtraction, "").first};
+    database::ExtractedTargetsInsert(db_.get(), step_id, image_loading_id, asset_id, targets);
+
+    database::SelectCursor<CameraMeasurements> cursor{db_.get(), &database::ExtractedTargetsSelect, step_id,
+                                                      asset_id, 3};
+    CameraMeasurements result;
+    for (CameraMeasurements batch{cursor.Next()}; not batch.empty(); batch = cursor.Next()) {
+        EXPECT_LE(std::size(batch), 3);
+        result.merge(batch);
+    }
+    ASSERT_EQ(std::size(result), 7);
+    EXPECT_TRUE(result.at(6).bundle.points.isApprox(targets.at(6).bundle.points));
+}
+
+TEST(DatabaseCalibrationDatbase, TestExtractionCache) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    ExtractedTarget const target{Bundle{MatrixX2d{{1, 2}}, MatrixX3d{{3, 4, 5}}}, {{6, 7}}};
+    EXPECT_NO_THROW(
+        database::ExtractionCacheInsert(db.get(), "target_a", {{"image_a", target}, {"image_b", std::nullopt}}));
+
+    // Inserting an entry again is a no-op, the first extraction result is kept.
+    EXPECT_NO_THROW(database::ExtractionCacheInsert(db.get(), "target_a", {{"image_a", std::nullopt}}));
+
+    auto const result{database::ExtractionCacheSelect(db.get(), "target_a")};
+    ASSERT_EQ(std::size(result), 2);
+    ASSERT_TRUE(result.at("image_a").has_value());
+    EXPECT_TRUE(result.at("image_a")->bundle.pixels.isApprox(target.bundle.pixels));
+    EXPECT_TRUE(result.at("image_a")->bundle.points.isApprox(target.bundle.points));
+    EXPECT_TRUE((result.at("image_a")->indices == target.indices).all());
+    EXPECT_FALSE(result.at("image_b").has_value());
+
+    // Entries are only shared between identical targets.
+    EXPECT_TRUE(database::ExtractionCacheSelect(db.get(), "target_b").empty());
+
+    // Selecting by image only reads the requested images, unknown images are simply missing.
+    auto const batch{database::ExtractionCacheSelect(db.get(), "target_a", {"image_b", "image_c"})};
+    ASSERT_EQ(std::size(batch), 1);
+    EXPECT_FALSE(batch.at("image_b").has_value());
+    EXPECT_TRUE(database::ExtractionCacheSelect(db.get(), "target_a", {}).empty());
+}
+
+TEST(DatabaseCalibrationDatbase, TestExtractionCacheUses) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+    AssetId const camera_id{database::GetOrCreateAsset(db.get(), AssetType::Camera, 0, "")};
+    WorkflowId const workflow_id{database::GetOrCreateWorkflow(db.get(), WorkflowType::Cam, {camera_id})};
+
+    database::ExtractionCacheInsert(db.get(), "target_a", {{"image_a", std::nullopt}, {"image_b", std::nullopt}});
+    StepId const step_id{database::GetOrCreateStep(db.get(), StepType::FeatureExtraction, "a").first};
+    database::WorkflowStepUpsert(db.get(), workflow_id, StepType::FeatureExtraction, step_id);
+    EXPECT_NO_THROW(database::ExtractionCacheUsesInsert(db.get(), step_id, "target_a", {"image_a"}));
+
+    // Recording a use again is a no-op.
+    EXPECT_NO_THROW(database::ExtractionCacheUsesInsert(db.get(), step_id, "target_a", {"image_a"}));
+
+    // Only the entry which no step uses is deleted.
+    database::DeleteUnusedExtractionCache(db.get());
+    auto const result{database::ExtractionCacheSelect(db.get(), "target_a")};
+    ASSERT_EQ(std::size(result), 1);
+    EXPECT_TRUE(result.contains("image_a"));
+
+    // Once another step replaces it in the workflow the step is deleted, and with it its uses.
+    StepId const new_step_id{database::GetOrCreateStep(db.get(), StepType::FeatureExtraction, "b").first};
+    database::WorkflowStepUpsert(db.get(), workflow_id, StepType::FeatureExtraction, new_step_id);
+    database::DeleteUnusedExtractionCache(db.get());
+    EXPECT_TRUE(database::ExtractionCacheSelect(db.get(), "target_a").empty());
+}
+
 TEST(DatabaseCalibrationDatbase, TestExtrinsics) {
     auto db{database::OpenCalibrationDatabase(":memory:", true)};
 
@@ -354,6 +543,82 @@ TEST_F(CalibrationDatabaseFixture, TestReprojectionErrors) {
 
     StepId const reprojection_error_id{database::GetOrCreateStep(db_.get(), StepType::PoseInit, "").first};
     EXPECT_NO_THROW(database::ReprojectionErrorsInsert(db_.get(), reprojection_error_id, targets_id, asset_id, data));
+
+    ReprojectionErrors const result{database::ReprojectionErrorsSelect(db_.get(), reprojection_error_id, asset_id)};
+    EXPECT_EQ(std::size(result), 1);
+    EXPECT_EQ(result.at(timestamp_ns).size(), 0);
+
+    EXPECT_EQ(std::size(database::ReprojectionErrorsSelect(db_.get(), targets_id, asset_id)), 0);
+}
+
+TEST(DatabaseCalibrationDatbase, TestSolverIterations) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    StepId const step_id{database::GetOrCreateStep(db.get(), StepType::BundleAdjustment, "").first};
+
+    EXPECT_NO_THROW(database::SolverIterationsInsert(db.get(), step_id, {{0, 100, 10, 0, 0.1, 0.1, true}}));
+    EXPECT_NO_THROW(database::SolverIterationsInsert(db.get(), step_id,
+                                                     {{1, 50, 5, 1, 0.2, 0.3, true}, {2, 60, 5, 1, 0.2, 0.5, false}}));
+
+    // An iteration can only be written once per step.
+    EXPECT_THROW(database::SolverIterationsInsert(db.get(), step_id, {{2, 60, 5, 1, 0.2, 0.5, false}}),
+                 std::runtime_error);
+
+    auto const result{database::SolverIterationsSelect(db.get(), step_id)};
+    ASSERT_EQ(std::size(result), 3);
+    EXPECT_EQ(result[0].iteration, 0);
+    EXPECT_EQ(result[1].cost, 50);
+    EXPECT_EQ(result[1].cumulative_time_s, 0.3);
+    EXPECT_FALSE(result[2].step_is_successful);
+
+    EXPECT_TRUE(database::SolverIterationsSelect(db.get(), StepId{-1}).empty());
+}
+
+TEST(DatabaseCalibrationDatbase, TestSolverMetrics) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    StepId const step_id{database::GetOrCreateStep(db.get(), StepType::BundleAdjustment, "").first};
+
+    SolverMetrics const metrics{100, 1, 10, 2, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7};
+    EXPECT_NO_THROW(database::SolverMetricsInsert(db.get(), step_id, metrics));
+
+    auto result{database::SolverMetricsSelect(db.get(), step_id)};
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->initial_cost, 100);
+    EXPECT_EQ(result->num_unsuccessful_steps, 2);
+    EXPECT_EQ(result->linear_solver_time_s, 0.3);
+    EXPECT_EQ(result->total_time_s, 0.7);
+
+    // Check the error message.
+    result = database::SolverMetricsSelect(db.get(), StepId{-1});
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), "{'database::': 'SolverMetricsSelect', 'step_id': -1}");
+}
+
+TEST(DatabaseCalibrationDatbase, TestSolverSnapshots) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    StepId const step_id{database::GetOrCreateStep(db.get(), StepType::BundleAdjustment, "").first};
+
+    ArrayXd const intrinsics{Array3d{600, 360, 240}};
+    Array6d const se3_a_b{1, 2, 3, 4, 5, 6};
+    EXPECT_NO_THROW(database::SolverSnapshotInsert(db.get(), step_id, {0, std::pair{CameraModel::Pinhole, intrinsics},
+                                                                       std::nullopt}));
+    EXPECT_NO_THROW(database::SolverSnapshotInsert(db.get(), step_id, {5, std::nullopt, se3_a_b}));
+
+    auto const result{database::SolverSnapshotsSelect(db.get(), step_id)};
+    ASSERT_EQ(std::size(result), 2);
+
+    EXPECT_EQ(result[0].iteration, 0);
+    ASSERT_TRUE(result[0].intrinsics.has_value());
+    EXPECT_EQ(result[0].intrinsics->first, CameraModel::Pinhole);
+    EXPECT_TRUE(result[0].intrinsics->second.isApprox(intrinsics));
+    EXPECT_FALSE(result[0].se3_a_b.has_value());
+
+    EXPECT_EQ(result[1].iteration, 5);
+    EXPECT_FALSE(result[1].intrinsics.has_value());
+    ASSERT_TRUE(result[1].se3_a_b.has_value());
+    EXPECT_TRUE(result[1].se3_a_b->isApprox(se3_a_b));
 }
 
 TEST(DatabaseCalibrationDatbase, TestSplineInfo) {
@@ -377,6 +642,45 @@ TEST(DatabaseCalibrationDatbase, TestSplineInfo) {
     EXPECT_EQ(result.error(), "{'database::': 'SplineInfoSelect', 'step_id': 1, 'asset_id': -1}");
 }
 
+TEST(DatabaseCalibrationDatbase, TestSplineInfoNonUniformKnots) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    // Satisfy foreign key constraints
+    StepId const step_id{database::GetOrCreateStep(db.get(), StepType::SplineInit, "").first};
+    AssetId const asset_id{database::GetOrCreateAsset(db.get(), AssetType::Camera, 0, "")};
+
+    spline::TimeHandler const time_handler{std::vector<std::uint64_t>{100, 110, 130, 170}};
+    EXPECT_NO_THROW(database::SplineInfoInsert(db.get(), step_id, asset_id, time_handler));
+
+    auto const result{database::SplineInfoSelect(db.get(), step_id, asset_id)};
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result->IsUniform());
+    EXPECT_EQ(result->t0_ns_, time_handler.t0_ns_);
+    EXPECT_EQ(result->delta_t_ns_, time_handler.delta_t_ns_);
+    EXPECT_EQ(result->knots_ns_, time_handler.knots_ns_);
+}
+
+TEST(DatabaseCalibrationDatbase, TestStepMetrics) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    StepId const step_id{database::GetOrCreateStep(db.get(), StepType::FeatureExtraction, "").first};
+
+    // Unlike the other tables one step can have many metrics entries.
+    EXPECT_NO_THROW(database::StepMetricsInsert(db.get(), step_id, {CacheStatus::CacheMiss, 10.0, 35.0, 2048, 8}));
+    EXPECT_NO_THROW(database::StepMetricsInsert(db.get(), step_id, {CacheStatus::CacheHit, 0.1, 0.1, 0, 1}));
+
+    auto const result{database::StepMetricsSelect(db.get(), step_id)};
+    ASSERT_EQ(std::size(result), 2);
+    EXPECT_EQ(result[0].cache_status, CacheStatus::CacheMiss);
+    EXPECT_EQ(result[0].wall_time_s, 10.0);
+    EXPECT_EQ(result[0].cpu_time_s, 35.0);
+    EXPECT_EQ(result[0].peak_rss_delta_kb, 2048);
+    EXPECT_EQ(result[0].peak_num_threads, 8);
+    EXPECT_EQ(result[1].cache_status, CacheStatus::CacheHit);
+
+    EXPECT_TRUE(database::StepMetricsSelect(db.get(), StepId{-1}).empty());
+}
+
 TEST(DatabaseCalibrationDatbase, TestTargetInfo) {
     auto db{database::OpenCalibrationDatabase(":memory:", true)};
 
@@ -396,4 +700,49 @@ TEST(DatabaseCalibrationDatbase, TestTargetInfo) {
     result = database::TargetInfoSelect(db.get(), step_id, AssetId{-1});
     EXPECT_FALSE(result.has_value());
     EXPECT_EQ(result.error(), "{'database::': 'TargetInfoSelect', 'step_id': 1, 'asset_id': -1}");
-}
\ No newline at end of file
+}
+
+TEST(DatabaseCalibrationDatbase, TestWarmStarts) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+    AssetId const asset_id{database::GetOrCreateAsset(db.get(), AssetType::Camera, 0, "")};
+
+    // Only completed bundle adjustments with intrinsics for the right camera model are warm start sources.
+    auto source{database::WarmStartSourceSelect(db.get(), asset_id, CameraModel::Pinhole)};
+    EXPECT_FALSE(source.has_value());
+    EXPECT_EQ(source.error(), "{'database::': 'WarmStartSourceSelect', 'asset_id': 1, 'camera_model': 'pinhole'}");
+
+    auto const insert_step{[&db, asset_id](StepType const type, CameraModel const model, CameraState const& intrinsics,
+                                           std::optional<Hash> const& cache_key) {
+        StepId const step_id{database::GetOrCreateStep(db.get(), type, "").first};
+        database::IntrinsicInsert(db.get(), step_id, asset_id, model, intrinsics);
+        if (cache_key) {
+            database::StepCacheKeyUpdate(db.get(), step_id, *cache_key);
+        }
+
+        return step_id;
+    }};
+    insert_step(StepType::IntrinsicInit, CameraModel::Pinhole, {Array3d{1, 2, 3}}, "a");
+    StepId const ba_id{insert_step(StepType::BundleAdjustment, CameraModel::Pinhole, {Array3d{1, 2, 3}}, "b")};
+    insert_step(StepType::BundleAdjustment, CameraModel::UnifiedCameraModel, {Array4d{1, 2, 3, 4}}, "c");
+    insert_step(StepType::BundleAdjustment, CameraModel::Pinhole, {Array3d{1, 2, 3}}, std::nullopt);  // Not complete
+
+    source = database::WarmStartSourceSelect(db.get(), asset_id, CameraModel::Pinhole);
+    ASSERT_TRUE(source.has_value());
+    EXPECT_EQ(source->first, ba_id);
+    EXPECT_EQ(source->second.value, "b");
+
+    // A step which was not warm started has no source key.
+    auto source_key{database::WarmStartSelect(db.get(), ba_id, "input_key")};
+    EXPECT_FALSE(source_key.has_value());
+    EXPECT_EQ(source_key.error(), "{'database::': 'WarmStartSelect', 'step_id': 2, 'input_key': 'input_key'}");
+
+    StepId const warm_id{database::GetOrCreateStep(db.get(), StepType::BundleAdjustment, "").first};
+    EXPECT_NO_THROW(database::WarmStartInsert(db.get(), warm_id, asset_id, "input_key", ba_id, "b", 5));
+
+    source_key = database::WarmStartSelect(db.get(), warm_id, "input_key");
+    ASSERT_TRUE(source_key.has_value());
+    EXPECT_EQ(source_key->value, "b");
+
+    // The source key is only returned for the same inputs.
+    EXPECT_FALSE(database::WarmStartSelect(db.get(), warm_id, "other_input_key").has_value());
+}
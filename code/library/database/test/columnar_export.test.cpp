@@ -0,0 +1,91 @@
+#include "database/columnar_export.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include <toml++/toml.hpp>
+
+#include "database/calibration_database.hpp"
+#include "types/database_types.hpp"
+
+using namespace reprojection;
+namespace fs = std::filesystem;
+
+template <typename T>
+std::vector<T> ReadColumn(fs::path const& file) {
+    std::ifstream in{file, std::ios::binary | std::ios::ate};
+    std::vector<T> column(static_cast<std::size_t>(in.tellg()) / sizeof(T));
+
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(std::data(column)), static_cast<std::streamsize>(std::size(column) * sizeof(T)));
+
+    return column;
+}
+
+TEST(DatabaseColumnarExport, TestColumnarExport) {
+    auto const db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    AssetId const asset_id{database::GetOrCreateAsset(db.get(), AssetType::Camera, 0, "")};
+    WorkflowId const workflow_id{database::GetOrCreateWorkflow(db.get(), WorkflowType::Cam, {asset_id})};
+
+    // Satisfy foreign keys - the poses and reprojection errors require targets which require images.
+    StepId const image_loading_id{database::GetOrCreateStep(db.get(), StepType::ImageLoading, "").first};
+    database::ImagesInsert(db.get(), image_loading_id, asset_id, {{0, ImageBuffer{}}, {1, ImageBuffer{}}});
+    StepId const targets_id{database::GetOrCreateStep(db.get(), StepType::FeatureExtraction, "").first};
+    database::ExtractedTargetsInsert(db.get(), targets_id, image_loading_id, asset_id,
+                                     {{0, ExtractedTarget{}}, {1, ExtractedTarget{}}});
+
+    StepId const pose_init_id{database::GetOrCreateStep(db.get(), StepType::PoseInit, "").first};
+    database::CameraPosesInsert(db.get(), pose_init_id, targets_id, asset_id,
+                                {Frame{0, Array6d::Zero()}, Frame{1, Array6d{1, 2, 3, 4, 5, 6}}});
+    ArrayX2d const errors_0{{0.1, 0.2}, {0.3, 0.4}, {0.5, 0.6}};
+    ArrayX2d const errors_1{{-1.0, -2.0}};
+    database::ReprojectionErrorsInsert(db.get(), pose_init_id, targets_id, asset_id, {{0, errors_0}, {1, errors_1}});
+    database::WorkflowStepUpsert(db.get(), workflow_id, StepType::PoseInit, pose_init_id);
+
+    StepId const intrinsic_init_id{database::GetOrCreateStep(db.get(), StepType::IntrinsicInit, "").first};
+    database::IntrinsicInsert(db.get(), intrinsic_init_id, asset_id, CameraModel::Pinhole,
+                              CameraState{Array3d{600, 360, 240}});
+    database::WorkflowStepUpsert(db.get(), workflow_id, StepType::IntrinsicInit, intrinsic_init_id);
+
+    // A step which does not belong to the workflow must not be exported.
+    StepId const other_step_id{database::GetOrCreateStep(db.get(), StepType::PoseInit, "other").first};
+    database::CameraPosesInsert(db.get(), other_step_id, targets_id, asset_id, {Frame{0, Array6d::Ones()}});
+
+    // NOTE(Jack): A unique directory so that concurrent test runs do not export into the same place.
+    fs::path const output_dir{fs::temp_directory_path() /
+                              ("reprojection_columnar_export_test_" + std::to_string(std::random_device{}()))};
+    EXPECT_NO_THROW(database::ColumnarExport(db.get(), workflow_id, output_dir));
+
+    toml::table const poses_schema{toml::parse_file((output_dir / "camera_poses" / "schema.toml").string())};
+    EXPECT_EQ(poses_schema["rows"].value<int64_t>(), 2);
+    EXPECT_EQ(poses_schema["columns"].as_array()->size(), 9);
+    EXPECT_EQ(ReadColumn<uint64_t>(output_dir / "camera_poses" / "timestamp_ns.bin"), (std::vector<uint64_t>{0, 1}));
+    EXPECT_EQ(ReadColumn<double>(output_dir / "camera_poses" / "z.bin"), (std::vector<double>{0, 6}));
+
+    // The reprojection errors are flattened to one row per residual.
+    fs::path const errors_dir{output_dir / "reprojection_errors"};
+    EXPECT_EQ(ReadColumn<int64_t>(errors_dir / "step_id.bin"), (std::vector<int64_t>(4, pose_init_id.value)));
+    EXPECT_EQ(ReadColumn<uint64_t>(errors_dir / "timestamp_ns.bin"), (std::vector<uint64_t>{0, 0, 0, 1}));
+    EXPECT_EQ(ReadColumn<double>(errors_dir / "residual_u.bin"), (std::vector<double>{0.1, 0.3, 0.5, -1.0}));
+    EXPECT_EQ(ReadColumn<double>(errors_dir / "residual_v.bin"), (std::vector<double>{0.2, 0.4, 0.6, -2.0}));
+
+    // The intrinsics are flattened to one row per parameter, and the schema maps the camera model back to its name.
+    fs::path const intrinsics_dir{output_dir / "intrinsics"};
+    toml::table const intrinsics_schema{toml::parse_file((intrinsics_dir / "schema.toml").string())};
+    EXPECT_EQ(intrinsics_schema["categories"]["camera_model"]["pinhole"].value<int64_t>(),
+              static_cast<int64_t>(CameraModel::Pinhole));
+    EXPECT_EQ(ReadColumn<int64_t>(intrinsics_dir / "parameter.bin"), (std::vector<int64_t>{0, 1, 2}));
+    EXPECT_EQ(ReadColumn<double>(intrinsics_dir / "value.bin"), (std::vector<double>{600, 360, 240}));
+
+    // The workflow has no imu, the table still exists but is empty.
+    toml::table const imu_schema{toml::parse_file((output_dir / "imu_errors" / "schema.toml").string())};
+    EXPECT_EQ(imu_schema["rows"].value<int64_t>(), 0);
+    EXPECT_EQ(std::size(ReadColumn<double>(output_dir / "imu_errors" / "omega_x.bin")), 0);
+
+    fs::remove_all(output_dir);
+}
\ No newline at end of file
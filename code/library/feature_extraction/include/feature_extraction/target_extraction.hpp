@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <optional>
+#include <string_view>
 
 #include <opencv2/opencv.hpp>
 
@@ -36,6 +37,11 @@ class TargetExtractor {
 
 std::unique_ptr<TargetExtractor> CreateTargetExtractor(TargetInfo const& target_info);
 
+// NOTE(Jack): The result of an extractor only depends on the target info and the extractor implementation itself. The
+// caches of the extraction results therefore use this in addition to the target info. Increment the version whenever a
+// change to an extractor changes its results, otherwise the results of the old extractor are reused forever.
+inline std::string_view constexpr extractor_version_key{"extractor_version=1;"};
+
 // NOTE(Jack): For those unfamiliar with the opencv type (or even those who know it well), this function signature might
 // look ugly. But what we need to remember is that a cv::Mat is basically just a smart pointer, and even though it is
 // passed here const, we can indeed still edit the data it points to.
@@ -84,7 +84,9 @@ std::optional<ExtractedTarget> CircleGridExtractor::ExtractImplementation(cv::Ma
 // NOTE(Jack): Use of the tagCustom36h11 and all settings are hardcoded here! This means no on can select another
 // family. Find a way to make this configurable if possible, but it will likely require recompilation, so it might not
 // really be feasible - there might also be no problem with hardcoding the tag family for most use cases.
-// TODO(Jack): Should we pass the number of threads from the application here? Does that speed things up?
+// NOTE(Jack): The detector runs single threaded (nthreads=1) on purpose. The feature extraction step already runs one
+// extractor per thread of the shared thread pool, and extra detector threads on top of that would only oversubscribe
+// the machine (see concurrency::ThreadBudget()).
 Aprilgrid3Extractor::Aprilgrid3Extractor(cv::Size const& pattern_size, const double unit_dimension)
     : TargetExtractor(pattern_size, unit_dimension),
       tag_family_{AprilTagFamily{tagCustom36h11_create(), tagCustom36h11_destroy}},
@@ -30,17 +30,20 @@ Vector3<T> Log(Matrix3<T> const& SO3) {
     return so3;
 }
 
-// TODO(Jack): Unit test!
+// NOTE(Jack): The inverse of a rotation is the rotation by the same angle about the negated axis, therefore the
+// rotation part needs no round trip through a rotation matrix, and the translation is rotated directly with Rodrigues'
+// formula. This sits in the reprojection error of every spline frame, so every Exp() and Log() here counts.
 template <typename T>
 Array6<T> InverseTransform(Array6<T> const& tf_a_b) {
-    Array3<T> const aa_a_b{tf_a_b.template head<3>()};
-    Matrix3<T> const R_a_b{Exp<T>(aa_a_b)};
-    Matrix3<T> const R_b_a{R_a_b.transpose()};
+    Vector3<T> const aa_b_a{-tf_a_b.template head<3>()};
+    Vector3<T> const p_a_b{tf_a_b.template tail<3>()};
+
+    Vector3<T> R_b_a_p_a_b;
+    ceres::AngleAxisRotatePoint(aa_b_a.data(), p_a_b.data(), R_b_a_p_a_b.data());
 
     Array6<T> tf_b_a;
-    tf_b_a.template head<3>() = Log<T>(R_b_a);
-    Vector3<T> const p_a_b{tf_a_b.template tail<3>()};
-    tf_b_a.template tail<3>() = -R_b_a * p_a_b;
+    tf_b_a.template head<3>() = aa_b_a;
+    tf_b_a.template tail<3>() = -R_b_a_p_a_b;
 
     return tf_b_a;
 }
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <ceres/rotation.h>
+
+#include "types/eigen_types.hpp"
+
+namespace reprojection::geometry {
+
+// NOTE(Jack): The quaternion counterparts of the so3 Exp() and Log() in lie.hpp, also autodiff compatible. They exist
+// for code that chains several rotations, like the so3 spline evaluation. There, every intermediate Log() and Exp()
+// round trip through a rotation matrix is a lot of trigonometry, which for ceres Jets is paid once per derivative
+// component. Composing quaternions costs 16 multiplications instead of the 27 of a matrix product, and Log() from a
+// quaternion is a single atan2 where RotationMatrixToAngleAxis() first has to convert the matrix to a quaternion.
+// Therefore: compose in rotation space and apply LogQuaternion() once at the end.
+template <typename T>
+Quaternion<T> ExpQuaternion(Vector3<T> const& so3) {
+    T q[4];  // LCOV_EXCL_LINE
+    ceres::AngleAxisToQuaternion(so3.data(), q);
+
+    // NOTE(Jack): ceres stores the quaternion as [w, x, y, z], which is also the order of this Eigen constructor.
+    return Quaternion<T>{q[0], q[1], q[2], q[3]};
+}
+
+template <typename T>
+Vector3<T> LogQuaternion(Quaternion<T> const& SO3) {
+    T const q[4]{SO3.w(), SO3.x(), SO3.y(), SO3.z()};
+
+    Vector3<T> so3;
+    ceres::QuaternionToAngleAxis(q, so3.data());
+
+    return so3;
+}
+
+}  // namespace reprojection::geometry
\ No newline at end of file
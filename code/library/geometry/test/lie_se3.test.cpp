@@ -57,3 +57,14 @@ TEST(GeometryLie, TestSe3Invertability) {
     Isometry3d const SE3_random_processed{geometry::Exp(geometry::Log(SE3_random))};
     EXPECT_TRUE(SE3_random_processed.isApprox(SE3_random));
 }
+
+TEST(GeometryLie, TestInverseTransform) {
+    Array6d tf_a_b;
+    tf_a_b << 0.1, -0.2, 0.3, 1, 2, 3;
+
+    Array6d const tf_b_a{geometry::InverseTransform(tf_a_b)};
+
+    Isometry3d const expected_SE3_b_a{geometry::Exp(Vector6d{tf_a_b.matrix()}).inverse()};
+    EXPECT_TRUE(geometry::Exp(Vector6d{tf_b_a.matrix()}).isApprox(expected_SE3_b_a));
+    EXPECT_TRUE(geometry::InverseTransform(tf_b_a).isApprox(tf_a_b));
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "geometry/quaternion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "geometry/lie.hpp"
+#include "types/eigen_types.hpp"
+
+using namespace reprojection;
+
+std::vector<Vector3d> const test_so3{Vector3d{0, 0, 0},         //
+                                     Vector3d{1e-9, 0, -1e-9},  //
+                                     Vector3d{0.1, -0.2, 0.3},  //
+                                     Vector3d{M_PI / 2, 0, 0}};
+
+TEST(GeometryQuaternion, TestExpQuaternion) {
+    for (auto const& so3_i : test_so3) {
+        Quaternion<double> const SO3_i{geometry::ExpQuaternion(so3_i)};
+
+        EXPECT_NEAR(SO3_i.norm(), 1.0, 1e-15);
+        EXPECT_TRUE(SO3_i.toRotationMatrix().isApprox(geometry::Exp(so3_i)));
+    }
+}
+
+TEST(GeometryQuaternion, TestLogQuaternion) {
+    for (auto const& so3_i : test_so3) {
+        Vector3d const so3_processed{geometry::LogQuaternion(geometry::ExpQuaternion(so3_i))};
+
+        EXPECT_TRUE(so3_processed.isApprox(so3_i, 1e-12) or so3_i.isZero()) << so3_processed.transpose();
+    }
+
+    // A quaternion and its negation are the same rotation, Log() must return the shortest rotation for both.
+    Quaternion<double> const SO3{geometry::ExpQuaternion<double>({0.1, -0.2, 0.3})};
+    Quaternion<double> const negated_SO3{-SO3.w(), -SO3.x(), -SO3.y(), -SO3.z()};
+    EXPECT_TRUE(geometry::LogQuaternion(negated_SO3).isApprox(Vector3d{0.1, -0.2, 0.3}));
+}
+
+TEST(GeometryQuaternion, TestComposition) {
+    // Composing as quaternions and taking a single Log() at the end must give the same result as composing rotation
+    // matrices, this is what the so3 spline evaluation relies on.
+    Vector3d const so3_a{0.3, 0.1, -0.2};
+    Vector3d const so3_b{-0.5, 0.4, 0.2};
+
+    Vector3d const so3_matrix{geometry::Log<double>(geometry::Exp(so3_a) * geometry::Exp(so3_b))};
+    Vector3d const so3_quaternion{
+        geometry::LogQuaternion(geometry::ExpQuaternion(so3_a) * geometry::ExpQuaternion(so3_b))};
+
+    EXPECT_TRUE(so3_quaternion.isApprox(so3_matrix));
+}
\ No newline at end of file
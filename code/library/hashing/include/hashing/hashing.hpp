@@ -1,14 +1,21 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "hashing/serialize.hpp"
+#include "types/algorithm_types.hpp"
 #include "types/database_types.hpp"
 
 namespace reprojection::hashing {
 
 std::string Sha256(std::string_view input);
 
+// NOTE(Jack): Serialize(EncodedImages) only uses the timestamps and sizes of the images, because hashing the full image
+// data of a dataset for every step cache key is too slow. When we need to know if the image itself changed (ex. the
+// per-frame extraction cache) we hash the content of that one image with this function instead.
+Hash HashContent(ImageBuffer const& image);
+
 // NOTE(Jack): A helper function which calls the serialize method on every argument passed - this requires that every
 // argument passed here has to have a fitting Serialize() function defined for it.
 template <typename... Args>
@@ -19,4 +26,25 @@ Hash HashArguments(Args const&... args) {
     return Hash{Sha256(data)};
 }
 
+// NOTE(Jack): Settings that are added to a step after it already existed are only part of its cache key when they are
+// set, so that the results cached before the setting existed keep their key. Pass the result to HashArguments(). An
+// unset setting adds nothing, a set one adds "name=value;" so that two settings with the same value cannot be mistaken
+// for each other. The settings which were added to a key before this helper existed had no name, those pass an empty
+// name so that their keys do not change.
+template <typename T>
+std::string OptionalKeyPart(std::optional<T> const& value, std::string_view const name = {}) {
+    if (not value) {
+        return "";
+    } else if (name.empty()) {
+        return Serialize(*value);
+    }
+
+    return std::string{name} + "=" + Serialize(*value) + ";";
+}
+
+// A flag adds only its name, and only when it is set.
+inline std::string OptionalKeyPart(bool const flag, std::string_view const name) {
+    return flag ? std::string{name} : "";
+}
+
 }  // namespace reprojection::hashing
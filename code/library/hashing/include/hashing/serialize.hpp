@@ -26,6 +26,10 @@ std::string Serialize(Extrinsic const& data);
 
 std::string Serialize(Frames const& data);
 
+// NOTE(Jack): Gives the same result as Serialize(EncodedImages) for the same images, so that a step can build its cache
+// key from the image sizes alone without loading the images.
+std::string Serialize(ImageSizes const& data);
+
 std::string Serialize(ImuMeasurements const& data);
 
 std::string Serialize(OptimizationState const& data);
@@ -39,6 +43,8 @@ std::string Serialize(std::string_view data);
 
 std::string Serialize(std::vector<AssetId> const& data);
 
+std::string Serialize(std::vector<std::uint64_t> const& data);
+
 template <typename T>
 concept Stringifiable = requires(T const value) {
     { std::to_string(value) } -> std::same_as<std::string>;
@@ -23,4 +23,8 @@ std::string Sha256(std::string_view input) {
     return result;
 }  // LCOV_EXCL_LINE
 
+Hash HashContent(ImageBuffer const& image) {
+    return Hash{Sha256(std::string_view{reinterpret_cast<char const*>(std::data(image.data)), std::size(image.data)})};
+}
+
 }  // namespace reprojection::hashing
\ No newline at end of file
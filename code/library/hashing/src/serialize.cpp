@@ -77,6 +77,17 @@ std::string Serialize(Frames const& data) {
     return oss.str();
 }
 
+std::string Serialize(ImageSizes const& data) {
+    std::ostringstream oss;
+
+    for (auto const& [timestamp_ns, size] : data) {
+        oss << timestamp_ns << "|";
+        oss << size << "|";
+    }
+
+    return oss.str();
+}
+
 std::string Serialize(ImuMeasurements const& data) {
     std::ostringstream oss;
     oss << std::fixed << std::setprecision(3);
@@ -128,4 +139,13 @@ std::string Serialize(std::vector<AssetId> const& data) {
     return oss.str();
 }
 
+std::string Serialize(std::vector<std::uint64_t> const& data) {
+    std::string result;
+    for (auto const data_i : data) {
+        result.append(std::to_string(data_i) + ",");
+    }
+
+    return result;
+}
+
 }  // namespace reprojection::hashing
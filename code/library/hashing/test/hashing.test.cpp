@@ -11,6 +11,26 @@ TEST(CachingHashing, TestHash) {
     EXPECT_EQ(result, "b5fd03dd91df1cfbd2f19c115d24d58bbda01a23fb01924bb78b2cc14f7ff1cb");
 }
 
+TEST(CachingHashing, TestHashContent) {
+    ImageBuffer const image{{'J', 'a', 'c', 'k'}};
+    EXPECT_EQ(hashing::HashContent(image).value, hashing::Sha256("Jack"));
+
+    // Same size but different content gives a different hash.
+    ImageBuffer const edited_image{{'J', 'a', 'c', 'x'}};
+    EXPECT_NE(hashing::HashContent(edited_image), hashing::HashContent(image));
+}
+
+TEST(CachingHashing, TestOptionalKeyPart) {
+    // An unset setting must not change the key, that is the whole point.
+    EXPECT_EQ(hashing::HashArguments(1, hashing::OptionalKeyPart(std::optional<int>{})), hashing::HashArguments(1));
+    EXPECT_EQ(hashing::OptionalKeyPart(std::optional<int>{}, "levels"), "");
+    EXPECT_EQ(hashing::OptionalKeyPart(false, "sequential"), "");
+
+    EXPECT_EQ(hashing::OptionalKeyPart(std::optional<int>{2}), "2");
+    EXPECT_EQ(hashing::OptionalKeyPart(std::optional<int>{2}, "levels"), "levels=2;");
+    EXPECT_EQ(hashing::OptionalKeyPart(true, "sequential"), "sequential");
+}
+
 // TODO(Jack): Fixture is copy and pasted
 class HashingFixture : public ::testing::Test {
    protected:
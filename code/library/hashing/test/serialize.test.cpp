@@ -55,6 +55,19 @@ TEST(HashingSerialize, TestSerializeEncodedImages) {
     EXPECT_EQ(result, gt_result);
 }
 
+TEST(HashingSerialize, TestSerializeImageSizes) {
+    ImageSizes const image_sizes{{0, 0}, {1, 3}};
+
+    std::string const result{hashing::Serialize(image_sizes)};
+    std::string const gt_result{"0|0|1|3|"};
+
+    EXPECT_EQ(result, gt_result);
+
+    // Matches the serialization of the images themselves.
+    EncodedImages const encoded_images{{0, ImageBuffer{}}, {1, ImageBuffer{{1, 2, 3}}}};
+    EXPECT_EQ(result, hashing::Serialize(encoded_images));
+}
+
 TEST(HashingSerialize, TestSerializeExtrinsic) {
     Extrinsic const data{AssetId{1}, AssetId{2}, Array6d::Ones()};
 
@@ -82,6 +95,12 @@ TEST(HashingSerialize, TestSerializeImuMeasurements) {
     EXPECT_EQ(result, gt_result);
 }
 
+TEST(HashingSerialize, TestSerializeTimestamps) {
+    std::vector<std::uint64_t> const timestamps_ns{0, 10, 25};
+
+    EXPECT_EQ(hashing::Serialize(timestamps_ns), "0,10,25,");
+}
+
 TEST(HashingSerialize, TestSerializeConfigTarget) {
     config::Config::Target const target_info{TargetType::Aprilgrid3, {8, 6}, 0.1, false};
 
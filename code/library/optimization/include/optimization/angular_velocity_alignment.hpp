@@ -1,5 +1,6 @@
 #pragma once
 
+#include "optimization/solver_progress.hpp"
 #include "spline/se3_spline.hpp"
 #include "types/ceres_types.hpp"
 #include "types/eigen_types.hpp"
@@ -16,8 +17,29 @@ namespace reprojection::optimization {
  *
  * Note that if not all axes of the camera-IMU motion have sufficient rotational velocity excitement then the returned
  * solution will be degenerate.
+ *
+ * The solution is a ceres optimization that starts from aa_imu_co_init. It minimizes exactly the same cost as
+ * KabschAngularVelocityAlignment(), therefore it is only worth it as a refinement of that closed form solution.
  */
 std::pair<Array3d, CeresState> AngularVelocityAlignment(VelocityMeasurements const& omega_imu, spline::Se3Spline spline,
-                                                        int const num_threads);
+                                                        int const num_threads,
+                                                        SolverProgress* const progress = nullptr);
+
+std::pair<Array3d, CeresState> AngularVelocityAlignment(VelocityMeasurements const& omega_imu, spline::Se3Spline spline,
+                                                        Array3d const& aa_imu_co_init, int const num_threads,
+                                                        SolverProgress* const progress = nullptr);
+
+/**
+ * \brief Closed form version of AngularVelocityAlignment().
+ *
+ * The camera's angular velocity is evaluated at all IMU timestamps in one batch (see Se3Spline::EvaluateMany()), and
+ * the rotation which best aligns the pairs of angular velocities in the least squares sense is then solved with one SVD
+ * of their 3x3 cross-covariance (Kabsch algorithm). No ceres problem is built, which makes this orders of magnitude
+ * faster than the optimization for long recordings.
+ *
+ * The same degeneracy warning as for AngularVelocityAlignment() applies. Returns the identity (zero) rotation if no IMU
+ * timestamp lies on the spline.
+ */
+Array3d KabschAngularVelocityAlignment(VelocityMeasurements const& omega_imu, spline::Se3Spline const& spline);
 
 }  // namespace  reprojection::optimization
@@ -2,6 +2,7 @@
 
 #include <tuple>
 
+#include "optimization/solver_progress.hpp"
 #include "types/calibration_types.hpp"
 #include "types/ceres_types.hpp"
 
@@ -11,7 +12,8 @@ namespace reprojection::optimization {
 std::tuple<OptimizationState, CeresState> BundleAdjustment(CameraInfo const& sensor, CameraMeasurements const& targets,
                                                            OptimizationState const& initial_state,
                                                            int const num_threads,
-                                                           bool const constant_intrinsics = false);
+                                                           bool const constant_intrinsics = false,
+                                                           SolverProgress* const progress = nullptr);
 
 ReprojectionErrors ReprojectionError(CameraInfo const& sensor, CameraMeasurements const& targets,
                                      OptimizationState const& state);
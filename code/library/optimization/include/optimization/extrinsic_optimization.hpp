@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+
+#include "optimization/solver_progress.hpp"
 #include "spline/se3_spline.hpp"
 #include "types/calibration_types.hpp"
 #include "types/ceres_types.hpp"
@@ -8,10 +11,46 @@ namespace reprojection::optimization {
 
 // TODO(Jack): This has way too many arguments... is that just how it is? Or a sign that we are missing a clean
 // abstraction?
-std::tuple<spline::Se3Spline, Extrinsic, Vector3d> ExtrinsicOptimization(
+// If imu_samples_per_segment is set the IMU data is aggregated with AggregateImuData() before the problem is built,
+// otherwise every IMU sample gets its own residuals.
+std::tuple<spline::Se3Spline, Extrinsic, Vector3d, CeresState> ExtrinsicOptimization(
+    ImuMeasurements const& imu_data, spline::Se3Spline const& initial_spline, Extrinsic const& initial_extrinsic,
+    Vector3d const& initial_gravity, CameraInfo const& sensor, CameraMeasurements const& targets,
+    CameraState const& intrinsics, std::optional<int> const imu_samples_per_segment, int const num_threads,
+    SolverProgress* const progress = nullptr);
+
+/**
+ * \brief The extrinsic optimization for long recordings, solved in overlapping windows of window_size control points.
+ *
+ * Instead of one problem over the whole recording the spline is optimized window by window, with the extrinsic and
+ * gravity carried over from one window to the next, and refined over the whole recording at the end. The size of the
+ * window problems and of the final refinement does not depend on the length of the recording. All solves report to the
+ * same progress, i.e. the time budget is for the whole optimization. Throws std::invalid_argument if the window has
+ * fewer than 2 * spline::K control points.
+ */
+std::tuple<spline::Se3Spline, Extrinsic, Vector3d, CeresState> SlidingWindowExtrinsicOptimization(
+    ImuMeasurements const& imu_data, spline::Se3Spline const& initial_spline, Extrinsic const& initial_extrinsic,
+    Vector3d const& initial_gravity, CameraInfo const& sensor, CameraMeasurements const& targets,
+    CameraState const& intrinsics, std::optional<int> const imu_samples_per_segment, int const window_size,
+    int const num_threads, SolverProgress* const progress = nullptr);
+
+/**
+ * \brief The extrinsic optimization solved coarse-to-fine over num_levels halvings of the knot spacing.
+ *
+ * The initial spline is first downsampled num_levels times with spline::DownsampleSe3Spline(). The problem is then
+ * solved at the coarsest knot spacing, and after each level the result is upsampled with spline::UpsampleSe3Spline()
+ * and solved again, until the knot spacing of the initial spline is reached. Most iterations therefore run on a much
+ * smaller problem, and the coarse levels cannot fit the high frequency IMU noise before the low frequency motion is
+ * right. Because every downsampling rounds the number of segments up, the result can extend up to 2^num_levels - 1
+ * segments past the end of the initial spline. All levels report to the same progress, i.e. the time budget is for all
+ * levels together. If the progress stops a coarse level the initial spline, extrinsic and gravity are returned
+ * unchanged. Throws std::invalid_argument if num_levels is negative.
+ */
+std::tuple<spline::Se3Spline, Extrinsic, Vector3d, CeresState> CoarseToFineExtrinsicOptimization(
     ImuMeasurements const& imu_data, spline::Se3Spline const& initial_spline, Extrinsic const& initial_extrinsic,
     Vector3d const& initial_gravity, CameraInfo const& sensor, CameraMeasurements const& targets,
-    CameraState const& intrinsics, int const num_threads);
+    CameraState const& intrinsics, std::optional<int> const imu_samples_per_segment, int const num_levels,
+    int const num_threads, SolverProgress* const progress = nullptr);
 
 std::pair<Frames, ReprojectionErrors> ReprojectionErrorSpline(CameraInfo const& sensor,
                                                               CameraMeasurements const& targets,
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+#include "spline/time_handler.hpp"
+#include "types/sensor_data_types.hpp"
+
+namespace reprojection::optimization {
+
+// NOTE(Jack): An aggregated measurement is the mean of all raw samples in one bin, stamped at the mean timestamp of
+// those samples. Averaging is a box low-pass filter followed by decimation to the bin rate. The number of samples is
+// the weight of the measurement in the optimization, because the mean of n samples has 1/n of the noise variance of a
+// single sample, i.e. n times the information.
+struct AggregatedImuMeasurement {
+    ImuData data;
+    int num_samples;
+};
+
+using AggregatedImuMeasurements = std::map<std::uint64_t, AggregatedImuMeasurement>;
+
+// Splits every spline segment into samples_per_segment bins of equal duration and aggregates the samples of each bin,
+// i.e. ties the rate of the IMU residuals to the knot frequency of the spline instead of to the IMU rate. Bins never
+// cross a segment boundary, and samples before the start of the spline are dropped.
+//
+// The accuracy trade-off: within one bin the spline is evaluated at the mean time only, so signal content faster than
+// the bin rate is averaged away. As long as the bins are much shorter than a segment, which the spline cannot represent
+// faster motion than anyway, the error is of second order in the bin duration. Two to four bins per segment are a
+// sensible starting point. Throws std::invalid_argument for samples_per_segment < 1.
+AggregatedImuMeasurements AggregateImuData(ImuMeasurements const& imu_data, spline::TimeHandler const& time_handler,
+                                           int const samples_per_segment);
+
+// Every sample is its own measurement with a weight of one, i.e. no aggregation.
+AggregatedImuMeasurements ToAggregatedImuData(ImuMeasurements const& imu_data);
+
+}  // namespace reprojection::optimization
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <ceres/iteration_callback.h>
+#include <ceres/solver.h>
+
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+#include "types/calibration_types.hpp"
+#include "types/database_types.hpp"
+
+namespace reprojection::optimization {
+
+enum class EarlyStop { Cancelled, TimeBudget };
+
+inline std::string ToString(EarlyStop const data) {
+    if (data == EarlyStop::Cancelled) {
+        return "cancelled";
+    } else if (data == EarlyStop::TimeBudget) {
+        return "time_budget";
+    } else {
+        throw std::runtime_error("LIBRARY IMPLEMENTATION ERROR - Unknown EarlyStop");  // LCOV_EXCL_LINE
+    }
+}
+
+struct SolverProgressOptions {
+    std::stop_token stop_token;           // Request a stop on the matching std::stop_source to cancel the solve
+    std::optional<double> time_budget_s;  // Measured from the start of the minimizer, i.e. without preprocessing
+    std::function<void(SolverIteration const&)> on_iteration;
+    std::function<void(SolverSnapshot const&)> on_snapshot;
+};
+
+/**
+ * \brief Ceres iteration callback which records the progress of a running optimization and can stop it early.
+ *
+ * Ceres calls the callback once before the first step (iteration zero) and then at the end of every minimizer
+ * iteration, always on the thread that called ceres::Solve(). The sinks therefore block the solver and must be cheap.
+ * Anything expensive, like writing to the database, should be handed off to another thread (see
+ * steps::SolverProgressWriter).
+ *
+ * If the stop token is triggered or the time budget is used up we tell ceres to terminate successfully. Ceres then
+ * treats the result like a converged one and writes the last accepted (i.e. lowest cost) state back into the parameter
+ * blocks, so no progress is lost. The budget is only checked between iterations, so a slow iteration can overshoot it.
+ *
+ * Attach() can be called for several solves one after the other (ex. the windows of the sliding window extrinsic
+ * optimization). They are then recorded as one run: the iteration numbers continue where the previous solve stopped,
+ * the time budget covers all the solves together, and once one solve was stopped early all the following ones stop at
+ * their iteration zero.
+ *
+ * WARN(Jack): Snapshots require ceres to copy the state into the parameter blocks after every iteration
+ * (Solver::Options::update_state_every_iteration), therefore they are only enabled if there is an on_snapshot sink.
+ */
+class SolverProgress final : public ceres::IterationCallback {
+   public:
+    explicit SolverProgress(SolverProgressOptions options);
+
+    // NOTE(Jack): The snapshot function reads the current values of the parameter blocks, which means it references the
+    // locals of the optimization that calls Attach(). It is only valid until that optimization returns.
+    void Attach(ceres::Solver::Options& solver_options, std::function<SolverSnapshot(int)> snapshot);
+
+    ceres::CallbackReturnType operator()(ceres::IterationSummary const& summary) override;
+
+    std::vector<SolverIteration> const& Iterations() const;
+
+    std::optional<EarlyStop> StoppedEarly() const;
+
+   private:
+    SolverProgressOptions options_;
+    std::function<SolverSnapshot(int)> snapshot_;
+
+    std::vector<SolverIteration> iterations_;
+    std::optional<EarlyStop> early_stop_;
+
+    // Where the solves before the current one stopped, see Attach().
+    int iteration_offset_{0};
+    double time_offset_s_{0};
+};
+
+}  // namespace reprojection::optimization
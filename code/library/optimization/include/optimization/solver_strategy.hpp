@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace reprojection::optimization {
+
+enum class SolverProblem { AngularVelocityAlignment, BundleAdjustment, ExtrinsicOptimization };
+
+// NOTE(Jack): The names are the ceres names of the enum values, for example "SPARSE_SCHUR" for the linear solver or
+// "SCHUR_JACOBI" for the preconditioner. Everything that is not set is selected automatically from the structure and
+// size of the problem, see ApplySolverStrategy().
+struct SolverOverride {
+    std::optional<std::string> linear_solver;
+    std::optional<std::string> preconditioner;
+};
+
+// Applies to all following solves of the given problem in this process. Throws std::invalid_argument for a name that
+// ceres does not know.
+void SetSolverOverride(SolverProblem const problem, SolverOverride const& solver_override);
+
+// NOTE(Jack): A different linear solver or preconditioner does not give bit identical results, therefore the steps put
+// the override of their problem into their cache key. The names are returned in the ceres spelling (ex. "dense_qr" is
+// returned as "DENSE_QR"), so that the same choice always gives the same key. An override which happens to match the
+// automatically selected strategy still changes the key, the selection is only known once the problem is built.
+SolverOverride GetSolverOverride(SolverProblem const problem);
+
+// NOTE(Jack): The automatic selection changed the default linear solver and preconditioner of the problems, which is not
+// visible in the key when no override is set. The steps therefore always add this to their key. Increment the version
+// whenever the automatic selection changes, so that the results solved with the old selection are not reused.
+inline std::string_view constexpr solver_strategy_key{"solver_strategy=1;"};
+
+}  // namespace reprojection::optimization
\ No newline at end of file
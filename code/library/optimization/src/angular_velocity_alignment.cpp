@@ -1,22 +1,31 @@
 #include "optimization/angular_velocity_alignment.hpp"
 
 #include <ranges>
+#include <vector>
 
+#include "ceres_threading.hpp"
 #include "cost_functions/rigid_body_angular_velocity.hpp"
+#include "geometry/lie.hpp"
+#include "solver_strategy.hpp"
 
 namespace reprojection::optimization {
 
-// NOTE(Jack): The angular velocity initialization actually only uses the so3 rotation component of the spline. But our
-// rigid body angular velocity cost function requires the full control points because ceres does not allow parameter
-// aliasing (see comment at RigidBodyAngularVelocity::Create()).
+// NOTE(Jack): The angular velocity initialization only uses the so3 rotation component of the spline, therefore only
+// the rotation blocks of the control points (see cost_functions::So3Blocks()) and of the extrinsic are in the problem.
 std::pair<Array3d, CeresState> AngularVelocityAlignment(VelocityMeasurements const& omega_imu, spline::Se3Spline spline,
-                                                        int const num_threads) {
-    // TODO(Jack): We need a better more uniform way of parameterizing the ceres optimizations.
-    CeresState ceres_state{ceres::TAKE_OWNERSHIP, ceres::DENSE_SCHUR};
-    ceres_state.solver_options.num_threads = num_threads;
+                                                        int const num_threads, SolverProgress* const progress) {
+    return AngularVelocityAlignment(omega_imu, spline, Array3d::Zero(), num_threads, progress);
+}
+
+std::pair<Array3d, CeresState> AngularVelocityAlignment(VelocityMeasurements const& omega_imu, spline::Se3Spline spline,
+                                                        Array3d const& aa_imu_co_init, int const num_threads,
+                                                        SolverProgress* const progress) {
+    CeresState ceres_state{ceres::TAKE_OWNERSHIP};
+    UseSharedThreads(num_threads, ceres_state);
     ceres::Problem problem{ceres_state.problem_options};
 
-    Array6d tf_imu_co{0, 0, 0, 0, 0, 0};
+    Array6d tf_imu_co{aa_imu_co_init(0), aa_imu_co_init(1), aa_imu_co_init(2), 0, 0, 0};
+    spline::BlendingCache blendings{spline.GetTimeHandler()};
     for (auto const timestamp_ns : omega_imu | std::views::keys) {
         auto const normalized_position{spline.GetTimeHandler().SplinePosition(timestamp_ns, spline.Size())};
         if (not normalized_position) {
@@ -25,19 +34,30 @@ std::pair<Array3d, CeresState> AngularVelocityAlignment(VelocityMeasurements con
         auto const [u_i, i]{normalized_position.value()};
 
         ceres::CostFunction* const cost_function{cost_functions::RigidBodyAngularVelocity::Create(
-            omega_imu.at(timestamp_ns).velocity, u_i, spline.GetTimeHandler().delta_t_ns_)};
-
-        problem.AddResidualBlock(cost_function, nullptr, tf_imu_co.data(),     //
-                                 spline.MutableControlPoints().col(i).data(),  //
-                                 spline.MutableControlPoints().col(i + 1).data(),
-                                 spline.MutableControlPoints().col(i + 2).data(),
-                                 spline.MutableControlPoints().col(i + 3).data());
-
-        // NOTE(Jack): We only want to initialize the extrinsic orientation between the imu and camera therefore we set
-        // the control points constant.
-        for (int j{0}; j < 4; ++j) {
-            problem.SetParameterBlockConstant(spline.MutableControlPoints().col(i + j).data());
+            omega_imu.at(timestamp_ns).velocity, u_i, blendings.Blending(i))};
+
+        auto const so3{cost_functions::So3Blocks(spline.MutableControlPoints(), i)};
+        problem.AddResidualBlock(cost_function, nullptr, cost_functions::RotationBlock(tf_imu_co.data()), so3[0],
+                                 so3[1], so3[2], so3[3]);
+    }
+
+    // NOTE(Jack): We only want to initialize the extrinsic orientation between the imu and camera therefore we set
+    // the control points constant, so the only thing being solved for is the extrinsic.
+    ProblemStructure structure{{}, {}, {cost_functions::RotationBlock(tf_imu_co.data())}};
+    for (int i{0}; i < spline.Size(); ++i) {
+        double* const block{cost_functions::RotationBlock(spline.MutableControlPoints().col(i).data())};
+        if (problem.HasParameterBlock(block)) {
+            problem.SetParameterBlockConstant(block);
         }
+        structure.banded_blocks.push_back(block);
+    }
+    ApplySolverStrategy(SolverProblem::AngularVelocityAlignment, problem, structure, ceres_state);
+
+    if (progress) {
+        // NOTE(Jack): Only the rotation is optimized here, the snapshot translation therefore stays zero.
+        progress->Attach(ceres_state.solver_options, [&tf_imu_co](int const iteration) {
+            return SolverSnapshot{iteration, std::nullopt, tf_imu_co};
+        });
     }
 
     ceres::Solve(ceres_state.solver_options, &problem, &ceres_state.solver_summary);
@@ -45,4 +65,39 @@ std::pair<Array3d, CeresState> AngularVelocityAlignment(VelocityMeasurements con
     return {tf_imu_co.topRows<3>(), ceres_state};
 }
 
+Array3d KabschAngularVelocityAlignment(VelocityMeasurements const& omega_imu, spline::Se3Spline const& spline) {
+    std::vector<std::uint64_t> timestamps_ns;
+    timestamps_ns.reserve(std::size(omega_imu));
+    for (auto const timestamp_ns : omega_imu | std::views::keys) {
+        timestamps_ns.push_back(timestamp_ns);
+    }
+    auto const omega_co{spline.EvaluateMany(timestamps_ns, spline::DerivativeOrder::First)};
+
+    // NOTE(Jack): The residual of the cost function is omega_imu - R_imu_co * omega_co. The R_imu_co that minimizes
+    // the sum of its squares is the Kabsch solution for the cross-covariance H = sum(omega_co * omega_imu^T).
+    Matrix3d H{Matrix3d::Zero()};
+    int num_pairs{0};
+    for (std::size_t k{0}; auto const& measurement : omega_imu | std::views::values) {
+        if (omega_co[k].has_value()) {
+            H += omega_co[k]->head<3>() * measurement.velocity.transpose();
+            num_pairs += 1;
+        }
+        k += 1;
+    }
+    if (num_pairs == 0) {
+        return Array3d::Zero();  // LCOV_EXCL_LINE
+    }
+
+    Eigen::JacobiSVD<Matrix3d> const svd{H, Eigen::ComputeFullU | Eigen::ComputeFullV};
+    Matrix3d const U{svd.matrixU()};
+    Matrix3d const V{svd.matrixV()};
+
+    // Flip the axis of the smallest singular value if needed, so that the result is a rotation and not a reflection.
+    Matrix3d D{Matrix3d::Identity()};
+    D(2, 2) = (V * U.transpose()).determinant() < 0 ? -1 : 1;
+    Matrix3d const R_imu_co{V * D * U.transpose()};
+
+    return geometry::Log<double>(R_imu_co).array();
+}
+
 }  // namespace  reprojection::optimization
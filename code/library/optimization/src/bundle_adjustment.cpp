@@ -4,7 +4,9 @@
 
 #include <ranges>
 
+#include "ceres_threading.hpp"
 #include "cost_functions/reprojection_error.hpp"
+#include "solver_strategy.hpp"
 
 namespace reprojection::optimization {
 
@@ -12,13 +14,17 @@ namespace reprojection::optimization {
 // that frame? Or what if in general we have a minimum required of points per frame threshold?
 std::tuple<OptimizationState, CeresState> BundleAdjustment(CameraInfo const& sensor, CameraMeasurements const& targets,
                                                            OptimizationState const& initial_state,
-                                                           int const num_threads, bool const constant_intrinsics) {
-    CeresState ceres_state{ceres::TAKE_OWNERSHIP, ceres::DENSE_SCHUR};
-    ceres_state.solver_options.num_threads = num_threads;
+                                                           int const num_threads, bool const constant_intrinsics,
+                                                           SolverProgress* const progress) {
+    CeresState ceres_state{ceres::TAKE_OWNERSHIP};
+    UseSharedThreads(num_threads, ceres_state);
     ceres::Problem problem{ceres_state.problem_options};
 
     OptimizationState optimized_state{initial_state};
+    ProblemStructure structure{{}, {}, {optimized_state.camera_state.intrinsics.data()}};
     for (auto const timestamp_ns : optimized_state.frames | std::views::keys) {
+        structure.independent_blocks.push_back(optimized_state.frames.at(timestamp_ns).pose.data());
+
         auto const& [pixels, points]{targets.at(timestamp_ns).bundle};
 
         for (Eigen::Index j{0}; j < pixels.rows(); ++j) {
@@ -34,6 +40,14 @@ std::tuple<OptimizationState, CeresState> BundleAdjustment(CameraInfo const& sen
     if (constant_intrinsics) {
         problem.SetParameterBlockConstant(optimized_state.camera_state.intrinsics.data());
     }
+    ApplySolverStrategy(SolverProblem::BundleAdjustment, problem, structure, ceres_state);
+
+    if (progress) {
+        progress->Attach(ceres_state.solver_options, [&sensor, &optimized_state](int const iteration) {
+            return SolverSnapshot{iteration, std::pair{sensor.camera_model, optimized_state.camera_state.intrinsics},
+                                  std::nullopt};
+        });
+    }
 
     ceres::Solve(ceres_state.solver_options, &problem, &ceres_state.solver_summary);
 
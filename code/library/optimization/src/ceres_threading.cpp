@@ -0,0 +1,20 @@
+#include "ceres_threading.hpp"
+
+#include <ceres/context.h>
+
+#include <memory>
+
+#include "concurrency/thread_budget.hpp"
+
+namespace reprojection::optimization {
+
+void UseSharedThreads(int const num_threads, CeresState& ceres_state) {
+    // NOTE(Jack): Ceres grows the thread pool of a context to the largest num_threads it was asked for, but never
+    // shrinks it. Because the budget caps num_threads that is at most ThreadLimit() threads.
+    static std::unique_ptr<ceres::Context> const context{ceres::Context::Create()};
+
+    ceres_state.problem_options.context = context.get();
+    ceres_state.solver_options.num_threads = concurrency::ThreadBudget(num_threads);
+}
+
+}  // namespace reprojection::optimization
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "types/ceres_types.hpp"
+
+namespace reprojection::optimization {
+
+// NOTE(Jack): By default every ceres::Problem creates its own ceres::Context, and with that its own thread pool. All
+// our problems instead share one process wide context, so the ceres threads are started once and reused by every
+// solve. The number of threads is clamped to the process wide thread budget (see concurrency::ThreadBudget()). Must be
+// called before the ceres::Problem is constructed from the problem options.
+void UseSharedThreads(int const num_threads, CeresState& ceres_state);
+
+}  // namespace reprojection::optimization
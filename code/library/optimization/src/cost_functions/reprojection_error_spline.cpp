@@ -15,14 +15,20 @@ using namespace projection_functions;
 // WARN(Jack): This is an overloaded function, this error will not help the user identify which Create() failed!
 ceres::CostFunction* Create(CameraModel const projection_type, ImageBounds const& bounds, Vector2d const& pixel,
                             Vector3d const& point_w, double const u_i, uint64_t const delta_t_ns) {
+    return Create(projection_type, bounds, pixel, point_w, u_i,
+                  std::make_shared<spline::SegmentBlending const>(spline::TimeHandler::UniformBlending(delta_t_ns)));
+}
+
+ceres::CostFunction* Create(CameraModel const projection_type, ImageBounds const& bounds, Vector2d const& pixel,
+                            Vector3d const& point_w, double const u_i, spline::SharedBlending const& blending) {
     if (projection_type == CameraModel::DoubleSphere) {
-        return ReprojectionErrorSpline_T<DoubleSphere>::Create(pixel, point_w, bounds, u_i, delta_t_ns);
+        return ReprojectionErrorSpline_T<DoubleSphere>::Create(pixel, point_w, bounds, u_i, blending);
     } else if (projection_type == CameraModel::Pinhole) {
-        return ReprojectionErrorSpline_T<Pinhole>::Create(pixel, point_w, bounds, u_i, delta_t_ns);
+        return ReprojectionErrorSpline_T<Pinhole>::Create(pixel, point_w, bounds, u_i, blending);
     } else if (projection_type == CameraModel::PinholeRadtan4) {
-        return ReprojectionErrorSpline_T<PinholeRadtan4>::Create(pixel, point_w, bounds, u_i, delta_t_ns);
+        return ReprojectionErrorSpline_T<PinholeRadtan4>::Create(pixel, point_w, bounds, u_i, blending);
     } else if (projection_type == CameraModel::UnifiedCameraModel) {
-        return ReprojectionErrorSpline_T<UnifiedCameraModel>::Create(pixel, point_w, bounds, u_i, delta_t_ns);
+        return ReprojectionErrorSpline_T<UnifiedCameraModel>::Create(pixel, point_w, bounds, u_i, blending);
     } else {
         throw std::runtime_error  // LCOV_EXCL_LINE
             ("The requested camera model is not supported by the reprojection::optimization::Create() function.");  // LCOV_EXCL_LINE
@@ -3,8 +3,10 @@
 #include <ceres/autodiff_cost_function.h>
 
 #include "cost_functions/utils.hpp"
+#include "geometry/lie.hpp"
 #include "projection_functions/projection_class_concept.hpp"
 #include "spline/se3_spline.hpp"
+#include "spline/time_handler.hpp"
 #include "spline/types.hpp"
 #include "types/calibration_types.hpp"
 #include "types/eigen_types.hpp"
@@ -18,18 +20,25 @@ namespace reprojection::optimization::cost_functions {
 ceres::CostFunction* Create(CameraModel const projection_type, ImageBounds const& bounds, Vector2d const& pixel,
                             Vector3d const& point, double const u_i, uint64_t const delta_t_ns);
 
+ceres::CostFunction* Create(CameraModel const projection_type, ImageBounds const& bounds, Vector2d const& pixel,
+                            Vector3d const& point, double const u_i, spline::SharedBlending const& blending);
+
 template <typename T_Model>
     requires projection_functions::ProjectionClass<T_Model>
 class ReprojectionErrorSpline_T {
    public:
     template <typename T>
-    bool operator()(T const* const intrinsics_ptr, T const* const cp_0_ptr, T const* const cp_1_ptr,
-                    T const* const cp_2_ptr, T const* const cp_3_ptr, T* const residual_ptr) const {
-        auto const P{BuildP<T, 6>(cp_0_ptr, cp_1_ptr, cp_2_ptr, cp_3_ptr)};
+    bool operator()(T const* const intrinsics_ptr, T const* const so3_0_ptr, T const* const so3_1_ptr,
+                    T const* const so3_2_ptr, T const* const so3_3_ptr, T const* const r3_0_ptr,
+                    T const* const r3_1_ptr, T const* const r3_2_ptr, T const* const r3_3_ptr,
+                    T* const residual_ptr) const {
+        spline::Matrix2NK<T> P;
+        P.template topRows<3>() = BuildP<T, 3>(so3_0_ptr, so3_1_ptr, so3_2_ptr, so3_3_ptr);
+        P.template bottomRows<3>() = BuildP<T, 3>(r3_0_ptr, r3_1_ptr, r3_2_ptr, r3_3_ptr);
 
         // Evaluate the se3 pose from the spline and then return the normal reprojection error using the spline pose as
         // the world to camera optical transform.
-        Array6<T> const tf_w_co{spline::Se3Spline::EvaluatePose<T>(P, u_i_, delta_t_ns_)};
+        Array6<T> const tf_w_co{spline::Se3Spline::EvaluatePose<T>(P, u_i_, *blending_)};
         Array6<T> const tf_co_w{geometry::InverseTransform(tf_w_co)};
 
         return ReprojectionError_T<T_Model>(pixel_, point_w_, bounds_)
@@ -38,8 +47,15 @@ class ReprojectionErrorSpline_T {
 
     static ceres::CostFunction* Create(Vector2d const& pixel, Vector3d const& point_w, ImageBounds const& bounds,
                                        double const u_i, uint64_t const delta_t_ns) {
-        return new ceres::AutoDiffCostFunction<ReprojectionErrorSpline_T, 2, T_Model::Size, 6, 6, 6, 6>(
-            new ReprojectionErrorSpline_T(pixel, point_w, bounds, u_i, delta_t_ns));
+        return Create(pixel, point_w, bounds, u_i,
+                      std::make_shared<spline::SegmentBlending const>(
+                          spline::TimeHandler::UniformBlending(delta_t_ns)));
+    }
+
+    static ceres::CostFunction* Create(Vector2d const& pixel, Vector3d const& point_w, ImageBounds const& bounds,
+                                       double const u_i, spline::SharedBlending const& blending) {
+        return new ceres::AutoDiffCostFunction<ReprojectionErrorSpline_T, 2, T_Model::Size, 3, 3, 3, 3, 3, 3, 3, 3>(
+            new ReprojectionErrorSpline_T(pixel, point_w, bounds, u_i, blending));
     }
 
     Vector2d pixel_;
@@ -47,7 +63,7 @@ class ReprojectionErrorSpline_T {
     ImageBounds bounds_;
 
     double u_i_;
-    uint64_t delta_t_ns_;
+    spline::SharedBlending blending_;
 };
 
 }  // namespace reprojection::optimization::cost_functions
\ No newline at end of file
@@ -17,7 +17,7 @@ TEST(OptimizationCostFunctions, TestReprojectionErrorSplineCreate) {
     double const u_i{0};
     uint64_t const delta_t_ns{1};
 
-    int const num_parameter_blocks{5};  // intrinsics and four control points
+    int const num_parameter_blocks{9};  // intrinsics and the rotation and translation of four control points
 
     ceres::CostFunction* cost_function{
         Create(CameraModel::DoubleSphere, testing_utilities::image_bounds, pixel, point, u_i, delta_t_ns)};
@@ -47,14 +47,14 @@ TEST(OptimizationCostFunctions, TestReprojectionErrorSplineCreate) {
 TEST(OptimizationCostFunctions, TestReprojectionErrorSpline_T) {
     Array2d const pixel{testing_utilities::pinhole_intrinsics[1], testing_utilities::pinhole_intrinsics[2]};
     Array3d const point{0, 0, 10};
-    ReprojectionErrorSpline_T<projection_functions::Pinhole> const cost_function{pixel, point,
-                                                                                 testing_utilities::image_bounds, 0, 1};
+    ReprojectionErrorSpline_T<projection_functions::Pinhole> const cost_function{
+        pixel, point, testing_utilities::image_bounds, 0,
+        std::make_shared<spline::SegmentBlending const>(spline::TimeHandler::UniformBlending(1))};
 
-    Array6d const control_point{Array6d::Zero()};
+    Array3d const cp{Array3d::Zero()};
     Array2d residual{-1, -1};
-    bool const success{cost_function(testing_utilities::pinhole_intrinsics.data(), control_point.data(),
-                                     control_point.data(), control_point.data(), control_point.data(),
-                                     residual.data())};
+    bool const success{cost_function(testing_utilities::pinhole_intrinsics.data(), cp.data(), cp.data(), cp.data(),
+                                     cp.data(), cp.data(), cp.data(), cp.data(), cp.data(), residual.data())};
     EXPECT_TRUE(success);
     EXPECT_FLOAT_EQ(residual[0], 0.0);
     EXPECT_FLOAT_EQ(residual[1], 0.0);
@@ -66,12 +66,11 @@ TEST(OptimizationCostFunctions, TestReprojectionErrorSpline_TCreate) {
     ceres::CostFunction const* const cost_function{ReprojectionErrorSpline_T<projection_functions::Pinhole>::Create(
         pixel, point, testing_utilities::image_bounds, 0.0, 1)};
 
-    EXPECT_EQ(std::size(cost_function->parameter_block_sizes()), 5);
+    EXPECT_EQ(std::size(cost_function->parameter_block_sizes()), 9);
     EXPECT_EQ(cost_function->parameter_block_sizes()[0], 3);  // pinhole intrinsics
-    EXPECT_EQ(cost_function->parameter_block_sizes()[1], 6);  // control point 1
-    EXPECT_EQ(cost_function->parameter_block_sizes()[2], 6);  // control point 2
-    EXPECT_EQ(cost_function->parameter_block_sizes()[3], 6);  // control point 3
-    EXPECT_EQ(cost_function->parameter_block_sizes()[4], 6);  // control point 4
+    for (int i{1}; i < 9; ++i) {
+        EXPECT_EQ(cost_function->parameter_block_sizes()[i], 3);  // control point rotations and translations
+    }
     EXPECT_EQ(cost_function->num_residuals(), 2);
     delete cost_function;
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "spline/constants.hpp"
 #include "spline/r3_spline.hpp"
 #include "spline/so3_spline.hpp"
+#include "spline/time_handler.hpp"
 #include "spline/types.hpp"
 #include "types/eigen_types.hpp"
 #include "types/physics_constants.hpp"
@@ -21,22 +22,24 @@ using Order = spline::DerivativeOrder;
 class RigidBodyLinearAcceleration {
    public:
     template <typename T>
-    bool operator()(T const* const tf_imu_co_ptr, T const* const gravity_w_ptr, T const* const cp_0_ptr,
-                    T const* const cp_1_ptr, T const* const cp_2_ptr, T const* const cp_3_ptr,
-                    T* const residual) const {
-        auto const P{BuildP<T, 6>(cp_0_ptr, cp_1_ptr, cp_2_ptr, cp_3_ptr)};
-        auto const so3{P.template topRows<3>()};
-
-        Eigen::Map<Eigen::Vector<T, 6> const> tf_imu_co(tf_imu_co_ptr);
-        Vector3<T> const omega_co{So3Spline::Evaluate<T, Order::First>(so3, u_i_, delta_t_ns_)};
-        Vector3<T> const alpha_co{So3Spline::Evaluate<T, Order::Second>(so3, u_i_, delta_t_ns_)};
+    bool operator()(T const* const aa_imu_co_ptr, T const* const t_imu_co_ptr, T const* const gravity_w_ptr,
+                    T const* const so3_0_ptr, T const* const so3_1_ptr, T const* const so3_2_ptr,
+                    T const* const so3_3_ptr, T const* const r3_0_ptr, T const* const r3_1_ptr,
+                    T const* const r3_2_ptr, T const* const r3_3_ptr, T* const residual) const {
+        auto const so3{BuildP<T, 3>(so3_0_ptr, so3_1_ptr, so3_2_ptr, so3_3_ptr)};
+        auto const r3{BuildP<T, 3>(r3_0_ptr, r3_1_ptr, r3_2_ptr, r3_3_ptr)};
+
+        Eigen::Vector<T, 6> tf_imu_co;
+        tf_imu_co << Eigen::Map<Eigen::Vector<T, 3> const>(aa_imu_co_ptr),
+            Eigen::Map<Eigen::Vector<T, 3> const>(t_imu_co_ptr);
+        Vector3<T> const omega_co{So3Spline::Evaluate<T, Order::First>(so3, u_i_, *blending_)};
+        Vector3<T> const alpha_co{So3Spline::Evaluate<T, Order::Second>(so3, u_i_, *blending_)};
 
         // Get the linear acceleration of the camera with reference to the world and then transform this to reference
         // the camera optical frame using our known world referenced orientation.
-        Vector3<T> const aa_w_co{So3Spline::Evaluate<T, Order::Null>(so3, u_i_, delta_t_ns_)};
-        Matrix3<T> const R_co_w{geometry::Exp<T>(aa_w_co).transpose()};
+        Quaternion<T> const R_co_w{So3Spline::EvaluateRotation<T>(so3, u_i_, *blending_).conjugate()};
         // "acc_cam_w" - "acceleration of the camera with respect to the world frame" - this is not a transformation!
-        Vector3<T> const acc_cam_w{R3Spline::Evaluate<T, Order::Second>(P.template bottomRows<3>(), u_i_, delta_t_ns_)};
+        Vector3<T> const acc_cam_w{R3Spline::Evaluate<T, Order::Second>(r3, u_i_, *blending_)};
         Vector3<T> const acc_cam_co{R_co_w * acc_cam_w};
 
         // Transform the camera's acceleration to the IMU frame. This is the only place in the entire extrinsic
@@ -47,7 +50,8 @@ class RigidBodyLinearAcceleration {
         // Transform gravity in the world frame to gravity in the IMU frame using our known world referenced
         // orientation.
         Eigen::Map<Eigen::Vector<T, 3> const> gravity_w(gravity_w_ptr);
-        Vector3<T> const gravity_imu{geometry::Exp<T>(tf_imu_co.template topRows<3>()) * R_co_w * gravity_w};
+        Vector3<T> const gravity_co{R_co_w * Vector3<T>{gravity_w}};
+        Vector3<T> const gravity_imu{RotatePoint<T>(tf_imu_co.template topRows<3>(), gravity_co)};
 
         // Add the gravity in the IMU frame to our predicted camera acceleration in the IMU frame. This gives us the
         // "specific force" which is what an IMU actually measures (sum of gravity and motion induced acceleration
@@ -65,14 +69,23 @@ class RigidBodyLinearAcceleration {
         return true;
     }
 
+    // NOTE(Jack): The extrinsic and control points are passed as their separate rotation and translation blocks (see
+    // So3Blocks() and RigidBodyAngularVelocity::Create()).
     static ceres::CostFunction* Create(Vector3d const& acc_imu, double const u_i, uint64_t const delta_t_ns) {
-        return new ceres::AutoDiffCostFunction<RigidBodyLinearAcceleration, 4, 6, 3, 6, 6, 6, 6>(
-            new RigidBodyLinearAcceleration(acc_imu, u_i, delta_t_ns));
+        return Create(acc_imu, u_i,
+                      std::make_shared<spline::SegmentBlending const>(
+                          spline::TimeHandler::UniformBlending(delta_t_ns)));
+    }
+
+    static ceres::CostFunction* Create(Vector3d const& acc_imu, double const u_i,
+                                       spline::SharedBlending const& blending) {
+        return new ceres::AutoDiffCostFunction<RigidBodyLinearAcceleration, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3>(
+            new RigidBodyLinearAcceleration(acc_imu, u_i, blending));
     }
 
     Vector3d acc_imu_;
     double u_i_;
-    uint64_t delta_t_ns_;
+    spline::SharedBlending blending_;
 };
 
 }  // namespace reprojection::optimization::cost_functions
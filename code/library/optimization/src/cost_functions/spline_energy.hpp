@@ -11,25 +11,18 @@ namespace reprojection::optimization::cost_functions {
 
 // cp = "control point"
 
-// TODO(Jack): When we first designed the spline interpolation code we designed it such that it only
-// interpolates one part of the full se3 spline at a time (i.e. rotation or translation). But this I think was
-// an arbitrary decision and now we know that we use the same code to initialize both the rotation and
-// orientation parts of the spline. That is why we see this logic repeated here in the operator() just like we see it
-// repeated in the spline initialization function. Maybe one day we can unite them and just make it a single 6d spline
-// that is initialized instead of two 3d ones that are then merged.
+// NOTE(Jack): The energy of the rotation and translation part of the spline are independent of each other, just like
+// in the spline initialization where both are solved as separate 3d splines. Therefore, this cost function only takes
+// one of the two parts (see So3Blocks() and R3Blocks()) and gets added once for each.
 class SplineEnergy {
    public:
     template <typename T>
     bool operator()(T const* const cp_0_ptr, T const* const cp_1_ptr, T const* const cp_2_ptr, T const* const cp_3_ptr,
                     T* const residual_ptr) const {
-        auto const P{BuildP<T, 6>(cp_0_ptr, cp_1_ptr, cp_2_ptr, cp_3_ptr)};
+        auto const P{BuildP<T, 3>(cp_0_ptr, cp_1_ptr, cp_2_ptr, cp_3_ptr)};
 
-        Eigen::Vector<T, 12> const rotations{P.template topRows<3>().reshaped()};
-        Eigen::Vector<T, 12> const translations{P.template bottomRows<3>().reshaped()};
-
-        Eigen::Ref<Eigen::Vector<T, 24>> residuals{Eigen::Map<Eigen::Vector<T, 24>>(residual_ptr, 24, 1)};
-        residuals.template topRows<12>() = omega_ * rotations;
-        residuals.template bottomRows<12>() = omega_ * translations;
+        Eigen::Map<Eigen::Vector<T, 12>> residuals(residual_ptr);
+        residuals = omega_ * Eigen::Vector<T, 12>{P.reshaped()};
 
         return true;
     }
@@ -38,7 +31,7 @@ class SplineEnergy {
         // WARN(Jack): Do not hardcode lambda!?
         spline::CoefficientBlock const omega{spline::BuildOmega(delta_t_ns, 1e3)};
 
-        return new ceres::AutoDiffCostFunction<SplineEnergy, 24, 6, 6, 6, 6>(new SplineEnergy(omega));
+        return new ceres::AutoDiffCostFunction<SplineEnergy, 12, 3, 3, 3, 3>(new SplineEnergy(omega));
     }
 
     // TODO(Jack): Is it proper to have omega here directly? I am not 100% sure that is the proper way to carry over the
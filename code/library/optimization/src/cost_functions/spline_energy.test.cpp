@@ -15,7 +15,7 @@ TEST(OptimizationCostFunctions, TestSplineEnergyOptimization) {
     ceres::Problem problem{ceres_state.problem_options};
 
     ceres::CostFunction* const cost_function{SplineEnergy::Create(1)};
-    spline::Matrix2NK<double> control_points{spline::Matrix2NK<double>::Zero()};
+    spline::MatrixNKd control_points{spline::MatrixNKd::Zero()};
     // Set one of the control points as an outlier which needs to be optimized back to the minimum energy location.
     control_points.col(1).array() += 1;
 
@@ -41,9 +41,9 @@ TEST(OptimizationCostFunctions, TestSplineEnergyResidual) {
     spline::CoefficientBlock const omega{spline::BuildOmega(1, 1)};
     SplineEnergy const cost_function{omega};
 
-    Array6d const control_point{Array6d::Zero()};
+    Array3d const control_point{Array3d::Zero()};
 
-    Eigen::Array<double, 24, 1> residual{-Eigen::Array<double, 24, 1>::Ones()};
+    Eigen::Array<double, 12, 1> residual{-Eigen::Array<double, 12, 1>::Ones()};
     bool const success{cost_function(control_point.data(), control_point.data(), control_point.data(),
                                      control_point.data(), residual.data())};
 
@@ -55,10 +55,10 @@ TEST(OptimizationCostFunctions, TestSplineEnergyCreate) {
     ceres::CostFunction const* const cost_function{SplineEnergy::Create(1)};
 
     EXPECT_EQ(std::size(cost_function->parameter_block_sizes()), 4);
-    EXPECT_EQ(cost_function->parameter_block_sizes()[0], 6);  // control point 1
-    EXPECT_EQ(cost_function->parameter_block_sizes()[1], 6);  // control point 2
-    EXPECT_EQ(cost_function->parameter_block_sizes()[2], 6);  // control point 3
-    EXPECT_EQ(cost_function->parameter_block_sizes()[3], 6);  // control point 4
-    EXPECT_EQ(cost_function->num_residuals(), 24);
+    EXPECT_EQ(cost_function->parameter_block_sizes()[0], 3);  // control point 1
+    EXPECT_EQ(cost_function->parameter_block_sizes()[1], 3);  // control point 2
+    EXPECT_EQ(cost_function->parameter_block_sizes()[2], 3);  // control point 3
+    EXPECT_EQ(cost_function->parameter_block_sizes()[3], 3);  // control point 4
+    EXPECT_EQ(cost_function->num_residuals(), 12);
     delete cost_function;
 }
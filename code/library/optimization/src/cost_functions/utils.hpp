@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "spline/constants.hpp"
 #include "types/eigen_types.hpp"
 
@@ -27,4 +29,48 @@ Eigen::Matrix<T, N, spline::constants::order> BuildP(T const* const cp_0_ptr, T
     return P;
 }
 
+// NOTE(Jack): The rotation and translation part of every se3 control point are separate ceres parameter blocks. Both
+// point into the same column of the control point matrix, the rotation block at the first three values and the
+// translation block at the last three. The two blocks never overlap, so this is not the parameter aliasing that ceres
+// forbids, and cost functions that only use the rotation (ex. RigidBodyAngularVelocity) then also only depend on the
+// rotation blocks. The same is done for the extrinsic, see RotationBlock() and TranslationBlock().
+//
+// What this saves per residual, counted in parameters (i.e. the width of the ceres::Jet):
+//      RigidBodyAngularVelocity: 30 -> 15 (3x30 -> 3x15 jacobian), the translation is not a parameter at all anymore.
+//      SplineEnergy: one 24x24 jacobian -> one 12x12 each for the rotation and translation part, half the entries.
+//      RigidBodyLinearAcceleration and ReprojectionErrorSpline: unchanged (33 and intrinsics + 24), only more blocks.
+// For the angular velocity alignment this means that the translation blocks are not part of the problem anymore.
+template <typename T>
+T* RotationBlock(T* const se3_ptr) {
+    return se3_ptr;
+}
+
+template <typename T>
+T* TranslationBlock(T* const se3_ptr) {
+    return se3_ptr + spline::constants::states;
+}
+
+// The rotation parameter blocks of the control points of spline segment i. Works with both mutable and const control
+// points, the pointer type follows the constness of the control points.
+template <typename Derived>
+auto So3Blocks(Derived&& control_points, int const i) {
+    std::array<decltype(control_points.col(i).data()), spline::constants::order> blocks;
+    for (int j{0}; j < spline::constants::order; ++j) {
+        blocks[j] = RotationBlock(control_points.col(i + j).data());
+    }
+
+    return blocks;
+}
+
+// The translation parameter blocks of the control points of spline segment i, see So3Blocks().
+template <typename Derived>
+auto R3Blocks(Derived&& control_points, int const i) {
+    std::array<decltype(control_points.col(i).data()), spline::constants::order> blocks;
+    for (int j{0}; j < spline::constants::order; ++j) {
+        blocks[j] = TranslationBlock(control_points.col(i + j).data());
+    }
+
+    return blocks;
+}
+
 }  // namespace reprojection::optimization::cost_functions
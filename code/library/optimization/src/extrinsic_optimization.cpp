@@ -2,97 +2,358 @@
 
 #include <ceres/loss_function.h>
 
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <map>
 #include <ranges>
+#include <stdexcept>
+#include <tuple>
 
+#include "ceres_threading.hpp"
 #include "cost_functions/reprojection_error_spline.hpp"
 #include "cost_functions/rigid_body_angular_velocity.hpp"
 #include "cost_functions/rigid_body_linear_acceleration.hpp"
 #include "cost_functions/spline_energy.hpp"
+#include "optimization/imu_aggregation.hpp"
+#include "solver_strategy.hpp"
+#include "spline/knot_insertion.hpp"
 #include "spline/spline_initialization.hpp"
 
 namespace reprojection::optimization {
 
-std::tuple<spline::Se3Spline, Extrinsic, Vector3d> ExtrinsicOptimization(
-    ImuMeasurements const& imu_data, spline::Se3Spline const& initial_spline, Extrinsic const& initial_extrinsic,
-    Vector3d const& initial_gravity, CameraInfo const& sensor, CameraMeasurements const& targets,
-    CameraState const& intrinsics, int const num_threads) {
-    // TODO(Jack): What is the correct linear solver?
-    CeresState ceres_state{ceres::TAKE_OWNERSHIP, ceres::SPARSE_NORMAL_CHOLESKY};
-    ceres_state.solver_options.num_threads = num_threads;
-    ceres::Problem problem{ceres_state.problem_options};
+namespace {
+
+// The state that the extrinsic optimization problems are built on, the residuals reference these by pointer.
+struct ExtrinsicState {
+    spline::Se3Spline spline;
+    Extrinsic extrinsic;
+    Vector3d gravity;
+    CameraState intrinsics;
+};
+
+// NOTE(Jack): The final refinement of the sliding window optimization only has the extrinsic and gravity to estimate,
+// a few thousand IMU measurements spread over the whole recording constrain those just as well as all of them. Capping
+// the number keeps the size of that problem independent of the length of the recording, like the window problems.
+std::size_t constexpr max_refinement_imu_measurements{5000};
+
+// First and last (inclusive) spline segment that residuals are added for.
+struct SegmentRange {
+    int first;
+    int last;
+};
+
+// Returns the measurements whose time falls into the segment range. Because the measurements are sorted in time this
+// only touches the measurements in the range, which keeps building the window problems linear in the total data.
+template <typename T>
+auto MeasurementsInRange(std::map<std::uint64_t, T> const& measurements, spline::TimeHandler const& time_handler,
+                         SegmentRange const& segments) {
+    std::uint64_t const t_begin_ns{time_handler.SegmentStartNs(segments.first)};
+    std::uint64_t const t_end_ns{time_handler.SegmentStartNs(segments.last + 1)};
+
+    return std::ranges::subrange(measurements.lower_bound(t_begin_ns), measurements.lower_bound(t_end_ns));
+}
 
-    spline::Se3Spline optimized_spline{initial_spline};
-    Extrinsic optimized_extrinsic{initial_extrinsic};
-    Vector3d optimized_gravity{initial_gravity};
+void AddImuResiduals(AggregatedImuMeasurements const& imu_data, SegmentRange const& segments, ExtrinsicState& state,
+                     ceres::Problem& problem) {
+    spline::TimeHandler const time_handler{state.spline.GetTimeHandler()};
+    auto control_points{state.spline.MutableControlPoints()};
+    double* const extrinsic_rotation{cost_functions::RotationBlock(state.extrinsic.se3_a_b.data())};
+    double* const extrinsic_translation{cost_functions::TranslationBlock(state.extrinsic.se3_a_b.data())};
 
-    // Imu residuals
-    for (auto const timestamp_ns : imu_data | std::views::keys) {
-        auto const normalized_position{
-            optimized_spline.GetTimeHandler().SplinePosition(timestamp_ns, optimized_spline.ControlPoints().cols())};
+    spline::BlendingCache blendings{time_handler};
+    for (auto const& [timestamp_ns, measurement] : MeasurementsInRange(imu_data, time_handler, segments)) {
+        auto const normalized_position{time_handler.SplinePosition(timestamp_ns, state.spline.Size())};
         if (not normalized_position.has_value()) {
             continue;  // LCOV_EXCL_LINE
         }
         auto const [u_i, i]{normalized_position.value()};
+        spline::SharedBlending const blending{blendings.Blending(i)};
+
+        // NOTE(Jack): An aggregated measurement stands in for num_samples raw samples, so it gets their combined
+        // weight. The scaled loss is created per residual block because the problem takes ownership of the loss
+        // functions.
+        auto const weight{[&measurement]() -> ceres::LossFunction* {
+            if (measurement.num_samples == 1) {
+                return nullptr;
+            }
+            return new ceres::ScaledLoss(nullptr, measurement.num_samples, ceres::TAKE_OWNERSHIP);
+        }};
+
+        auto const so3{cost_functions::So3Blocks(control_points, i)};
+        auto const r3{cost_functions::R3Blocks(control_points, i)};
 
-        // WARN(Jack): We pass in the pointer to the full tf and control points but the angular velocity cost function
-        // only uses the top three rows of all. Is there a better design?
         ceres::CostFunction* const gyroscope_cost_function{cost_functions::RigidBodyAngularVelocity::Create(
-            imu_data.at(timestamp_ns).angular_velocity, u_i, optimized_spline.GetTimeHandler().delta_t_ns_)};
-        problem.AddResidualBlock(gyroscope_cost_function, nullptr, optimized_extrinsic.se3_a_b.data(),
-                                 optimized_spline.MutableControlPoints().col(i).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 1).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 2).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 3).data());
+            measurement.data.angular_velocity, u_i, blending)};
+        problem.AddResidualBlock(gyroscope_cost_function, weight(), extrinsic_rotation, so3[0], so3[1], so3[2],
+                                 so3[3]);
 
         ceres::CostFunction* const accelerometer_cost_function{cost_functions::RigidBodyLinearAcceleration::Create(
-            imu_data.at(timestamp_ns).linear_acceleration, u_i, optimized_spline.GetTimeHandler().delta_t_ns_)};
-        problem.AddResidualBlock(accelerometer_cost_function, nullptr, optimized_extrinsic.se3_a_b.data(),
-                                 optimized_gravity.data(), optimized_spline.MutableControlPoints().col(i).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 1).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 2).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 3).data());
+            measurement.data.linear_acceleration, u_i, blending)};
+        problem.AddResidualBlock(accelerometer_cost_function, weight(), extrinsic_rotation, extrinsic_translation,
+                                 state.gravity.data(), so3[0], so3[1], so3[2], so3[3], r3[0], r3[1], r3[2], r3[3]);
     }
+}
 
-    // Reprojection residuals
-    CameraState intrinsics_x{intrinsics};
-    for (auto const timestamp_ns : targets | std::views::keys) {
-        auto const normalized_position{
-            optimized_spline.GetTimeHandler().SplinePosition(timestamp_ns, optimized_spline.ControlPoints().cols())};
+void AddReprojectionResiduals(CameraInfo const& sensor, CameraMeasurements const& targets,
+                              SegmentRange const& segments, ExtrinsicState& state, ceres::Problem& problem) {
+    spline::TimeHandler const time_handler{state.spline.GetTimeHandler()};
+    auto control_points{state.spline.MutableControlPoints()};
+
+    spline::BlendingCache blendings{time_handler};
+    for (auto const& [timestamp_ns, target] : MeasurementsInRange(targets, time_handler, segments)) {
+        auto const normalized_position{time_handler.SplinePosition(timestamp_ns, state.spline.Size())};
         if (not normalized_position.has_value()) {
             continue;  // LCOV_EXCL_LINE
         }
         auto const [u_i, i]{normalized_position.value()};
+        spline::SharedBlending const blending{blendings.Blending(i)};
+
+        auto const so3{cost_functions::So3Blocks(control_points, i)};
+        auto const r3{cost_functions::R3Blocks(control_points, i)};
 
         // TODO(Jack): Copy and pasted from reprojectiom error below
-        auto const& [pixels, points]{targets.at(timestamp_ns).bundle};
+        auto const& [pixels, points]{target.bundle};
         for (Eigen::Index j{0}; j < pixels.rows(); ++j) {
-            ceres::CostFunction* const cost_function{
-                cost_functions::Create(sensor.camera_model, sensor.bounds, pixels.row(j), points.row(j), u_i,
-                                       optimized_spline.GetTimeHandler().delta_t_ns_)};
+            ceres::CostFunction* const cost_function{cost_functions::Create(
+                sensor.camera_model, sensor.bounds, pixels.row(j), points.row(j), u_i, blending)};
             // TODO(Jack): Should we also use robust loss here like we use for the stand alone bundle adjustment?
-            problem.AddResidualBlock(cost_function, nullptr, intrinsics_x.intrinsics.data(),
-                                     optimized_spline.MutableControlPoints().col(i).data(),
-                                     optimized_spline.MutableControlPoints().col(i + 1).data(),
-                                     optimized_spline.MutableControlPoints().col(i + 2).data(),
-                                     optimized_spline.MutableControlPoints().col(i + 3).data());
+            problem.AddResidualBlock(cost_function, nullptr, state.intrinsics.intrinsics.data(), so3[0], so3[1],
+                                     so3[2], so3[3], r3[0], r3[1], r3[2], r3[3]);
         }
     }
 
-    // Smoothness/minimum energy constraint
-    for (int i{0}; i < optimized_spline.Size() - 3; ++i) {
-        ceres::CostFunction* const cost_function{cost_functions::SplineEnergy::Create(1)};
-        problem.AddResidualBlock(cost_function, nullptr, optimized_spline.MutableControlPoints().col(i).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 1).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 2).data(),
-                                 optimized_spline.MutableControlPoints().col(i + 3).data());
-    }
-
     // This was already solved for in the bundle adjustment step, therefore I do not think there is a good reason to
     // further optimize it here.
-    problem.SetParameterBlockConstant(intrinsics_x.intrinsics.data());
+    if (problem.HasParameterBlock(state.intrinsics.intrinsics.data())) {
+        problem.SetParameterBlockConstant(state.intrinsics.intrinsics.data());
+    }
+}
+
+// Smoothness/minimum energy constraint
+void AddSmoothnessResiduals(SegmentRange const& segments, ExtrinsicState& state, ceres::Problem& problem) {
+    auto control_points{state.spline.MutableControlPoints()};
+
+    for (int i{segments.first}; i <= segments.last; ++i) {
+        for (auto const& blocks :
+             {cost_functions::So3Blocks(control_points, i), cost_functions::R3Blocks(control_points, i)}) {
+            ceres::CostFunction* const cost_function{cost_functions::SplineEnergy::Create(1)};
+            problem.AddResidualBlock(cost_function, nullptr, blocks[0], blocks[1], blocks[2], blocks[3]);
+        }
+    }
+}
+
+ProblemStructure ExtrinsicProblemStructure(SegmentRange const& segments, ExtrinsicState& state) {
+    ProblemStructure structure{{},
+                               {},
+                               {cost_functions::RotationBlock(state.extrinsic.se3_a_b.data()),
+                                cost_functions::TranslationBlock(state.extrinsic.se3_a_b.data()), state.gravity.data(),
+                                state.intrinsics.intrinsics.data()}};
+    for (int i{segments.first}; i <= segments.last + spline::D; ++i) {
+        double* const control_point{state.spline.MutableControlPoints().col(i).data()};
+        structure.banded_blocks.push_back(cost_functions::RotationBlock(control_point));
+        structure.banded_blocks.push_back(cost_functions::TranslationBlock(control_point));
+    }
+
+    return structure;
+}
+
+void AttachProgress(SolverProgress* const progress, ExtrinsicState const& state, CeresState& ceres_state) {
+    if (progress) {
+        progress->Attach(ceres_state.solver_options, [&state](int const iteration) {
+            return SolverSnapshot{iteration, std::nullopt, state.extrinsic.se3_a_b};
+        });
+    }
+}
+
+AggregatedImuMeasurements PrepareImuData(ImuMeasurements const& imu_data, spline::TimeHandler const& time_handler,
+                                         std::optional<int> const imu_samples_per_segment) {
+    return imu_samples_per_segment ? AggregateImuData(imu_data, time_handler, *imu_samples_per_segment)
+                                   : ToAggregatedImuData(imu_data);
+}
+
+// One aggregated measurement per segment, and of those only every n-th so that there are at most max_measurements. The
+// weights are not changed, dropping measurements evenly scales all the IMU residuals of the problem by the same factor.
+AggregatedImuMeasurements DecimateImuData(ImuMeasurements const& imu_data, spline::TimeHandler const& time_handler,
+                                          std::size_t const max_measurements) {
+    AggregatedImuMeasurements const per_segment{AggregateImuData(imu_data, time_handler, 1)};
+    std::size_t const stride{(std::size(per_segment) + max_measurements - 1) / max_measurements};
+    if (stride <= 1) {
+        return per_segment;
+    }
+
+    AggregatedImuMeasurements decimated;
+    std::size_t i{0};
+    for (auto const& measurement : per_segment) {
+        if (i++ % stride == 0) {
+            decimated.insert(std::cend(decimated), measurement);
+        }
+    }
+
+    return decimated;
+}
+
+}  // namespace
+
+std::tuple<spline::Se3Spline, Extrinsic, Vector3d, CeresState> ExtrinsicOptimization(
+    ImuMeasurements const& imu_data, spline::Se3Spline const& initial_spline, Extrinsic const& initial_extrinsic,
+    Vector3d const& initial_gravity, CameraInfo const& sensor, CameraMeasurements const& targets,
+    CameraState const& intrinsics, std::optional<int> const imu_samples_per_segment, int const num_threads,
+    SolverProgress* const progress) {
+    CeresState ceres_state{ceres::TAKE_OWNERSHIP};
+    UseSharedThreads(num_threads, ceres_state);
+    ceres::Problem problem{ceres_state.problem_options};
+
+    ExtrinsicState state{initial_spline, initial_extrinsic, initial_gravity, intrinsics};
+    SegmentRange const all_segments{0, state.spline.Size() - spline::K};
+    if (all_segments.last < all_segments.first) {
+        return {state.spline, state.extrinsic, state.gravity, ceres_state};  // LCOV_EXCL_LINE
+    }
+
+    AggregatedImuMeasurements const aggregated_imu_data{
+        PrepareImuData(imu_data, state.spline.GetTimeHandler(), imu_samples_per_segment)};
+    AddImuResiduals(aggregated_imu_data, all_segments, state, problem);
+    AddReprojectionResiduals(sensor, targets, all_segments, state, problem);
+    AddSmoothnessResiduals(all_segments, state, problem);
+
+    ApplySolverStrategy(SolverProblem::ExtrinsicOptimization, problem, ExtrinsicProblemStructure(all_segments, state),
+                        ceres_state);
+    AttachProgress(progress, state, ceres_state);
+
     ceres::Solve(ceres_state.solver_options, &problem, &ceres_state.solver_summary);
 
-    return {optimized_spline, optimized_extrinsic, optimized_gravity};
+    return {state.spline, state.extrinsic, state.gravity, ceres_state};
+}
+
+// NOTE(Jack): Each window is its own ceres problem over window_size control points. The first spline::D control points
+// of every window but the first are held constant at the values of the previous window, which lie in the middle of
+// the previous window and are therefore well constrained. Holding them constant fixes the position, velocity and
+// acceleration at the window boundary, so the spline stays C2 continuous across windows. The windows overlap by half,
+// so every control point except those at the very start is optimized with data on both of its sides. The extrinsic and
+// gravity are global, each window starts from the result of the previous one.
+//
+// Because the last windows see only the end of the recording, the extrinsic and gravity are refined once more over the
+// whole recording at the end, with the spline held constant and the IMU data decimated to one aggregated measurement
+// per segment, and at most max_refinement_imu_measurements of those. The reprojection residuals only depend on the
+// spline and the intrinsics, so they are not part of this refinement.
+//
+// Every window solve and the final refinement report to the same progress, so the time budget and the cancellation
+// cover the whole optimization. Once it was stopped early the remaining windows are skipped.
+std::tuple<spline::Se3Spline, Extrinsic, Vector3d, CeresState> SlidingWindowExtrinsicOptimization(
+    ImuMeasurements const& imu_data, spline::Se3Spline const& initial_spline, Extrinsic const& initial_extrinsic,
+    Vector3d const& initial_gravity, CameraInfo const& sensor, CameraMeasurements const& targets,
+    CameraState const& intrinsics, std::optional<int> const imu_samples_per_segment, int const window_size,
+    int const num_threads, SolverProgress* const progress) {
+    if (window_size < 2 * spline::K) {
+        throw std::invalid_argument(
+            std::format("The extrinsic optimization window must have at least {} control points", 2 * spline::K));
+    }
+
+    ExtrinsicState state{initial_spline, initial_extrinsic, initial_gravity, intrinsics};
+    spline::TimeHandler const time_handler{state.spline.GetTimeHandler()};
+    AggregatedImuMeasurements const aggregated_imu_data{
+        PrepareImuData(imu_data, time_handler, imu_samples_per_segment)};
+
+    int const window_step{window_size / 2};
+    for (int begin{0}; begin + spline::K <= state.spline.Size(); begin += window_step) {
+        int const end{std::min(begin + window_size, state.spline.Size())};
+        SegmentRange const segments{begin, end - spline::K};
+
+        CeresState window_state{ceres::TAKE_OWNERSHIP};
+        UseSharedThreads(num_threads, window_state);
+        ceres::Problem problem{window_state.problem_options};
+
+        AddImuResiduals(aggregated_imu_data, segments, state, problem);
+        AddReprojectionResiduals(sensor, targets, segments, state, problem);
+        AddSmoothnessResiduals(segments, state, problem);
+        if (begin > 0) {
+            for (int i{begin}; i < begin + spline::D; ++i) {
+                double* const control_point{state.spline.MutableControlPoints().col(i).data()};
+                problem.SetParameterBlockConstant(cost_functions::RotationBlock(control_point));
+                problem.SetParameterBlockConstant(cost_functions::TranslationBlock(control_point));
+            }
+        }
+
+        ApplySolverStrategy(SolverProblem::ExtrinsicOptimization, problem, ExtrinsicProblemStructure(segments, state),
+                            window_state);
+        AttachProgress(progress, state, window_state);
+        ceres::Solve(window_state.solver_options, &problem, &window_state.solver_summary);
+
+        if (end == state.spline.Size() or (progress and progress->StoppedEarly())) {
+            break;
+        }
+    }
+
+    CeresState ceres_state{ceres::TAKE_OWNERSHIP};
+    UseSharedThreads(num_threads, ceres_state);
+    ceres::Problem problem{ceres_state.problem_options};
+
+    SegmentRange const all_segments{0, state.spline.Size() - spline::K};
+    if (all_segments.last < all_segments.first) {
+        return {state.spline, state.extrinsic, state.gravity, ceres_state};  // LCOV_EXCL_LINE
+    }
+
+    AddImuResiduals(DecimateImuData(imu_data, time_handler, max_refinement_imu_measurements), all_segments, state,
+                    problem);
+    for (int i{0}; i < state.spline.Size(); ++i) {
+        double* const control_point{state.spline.MutableControlPoints().col(i).data()};
+        for (double* const block : {cost_functions::RotationBlock(control_point),
+                                    cost_functions::TranslationBlock(control_point)}) {
+            if (problem.HasParameterBlock(block)) {
+                problem.SetParameterBlockConstant(block);
+            }
+        }
+    }
+
+    ApplySolverStrategy(SolverProblem::ExtrinsicOptimization, problem, ExtrinsicProblemStructure(all_segments, state),
+                        ceres_state);
+    AttachProgress(progress, state, ceres_state);
+
+    ceres::Solve(ceres_state.solver_options, &problem, &ceres_state.solver_summary);
+
+    return {state.spline, state.extrinsic, state.gravity, ceres_state};
+}
+
+// NOTE(Jack): The spline smoothness residuals scale with the knot spacing (see spline::BuildOmega()), so they keep the
+// same meaning on every level. The aggregated IMU measurements on the other hand are per segment, which means that
+// with imu_samples_per_segment set the coarse levels also have proportionally fewer IMU residuals.
+//
+// All levels report to the same progress (see SolverProgress::Attach()), so the time budget and the cancellation cover
+// the coarse levels too. If it stops during a coarse level the remaining levels are skipped and the initial spline,
+// extrinsic and gravity are returned unchanged.
+std::tuple<spline::Se3Spline, Extrinsic, Vector3d, CeresState> CoarseToFineExtrinsicOptimization(
+    ImuMeasurements const& imu_data, spline::Se3Spline const& initial_spline, Extrinsic const& initial_extrinsic,
+    Vector3d const& initial_gravity, CameraInfo const& sensor, CameraMeasurements const& targets,
+    CameraState const& intrinsics, std::optional<int> const imu_samples_per_segment, int const num_levels,
+    int const num_threads, SolverProgress* const progress) {
+    if (num_levels < 0) {
+        throw std::invalid_argument("The number of coarse-to-fine levels must not be negative");
+    }
+
+    spline::Se3Spline spline{initial_spline};
+    for (int level{0}; level < num_levels; ++level) {
+        spline = spline::DownsampleSe3Spline(spline);
+    }
+
+    Extrinsic extrinsic{initial_extrinsic};
+    Vector3d gravity{initial_gravity};
+    for (int level{num_levels}; level > 0; --level) {
+        CeresState debug;
+        std::tie(spline, extrinsic, gravity, debug) =
+            ExtrinsicOptimization(imu_data, spline, extrinsic, gravity, sensor, targets, intrinsics,
+                                  imu_samples_per_segment, num_threads, progress);
+
+        // NOTE(Jack): A coarse spline cannot represent the initial spline exactly, so a result that never reached the
+        // final level is worse than what we started with.
+        if (progress and progress->StoppedEarly()) {
+            return {initial_spline, initial_extrinsic, initial_gravity, debug};
+        }
+
+        spline = spline::UpsampleSe3Spline(spline);
+    }
+
+    return ExtrinsicOptimization(imu_data, spline, extrinsic, gravity, sensor, targets, intrinsics,
+                                 imu_samples_per_segment, num_threads, progress);
 }
 
 std::pair<Frames, ReprojectionErrors> ReprojectionErrorSpline(CameraInfo const& sensor,
@@ -102,10 +363,18 @@ std::pair<Frames, ReprojectionErrors> ReprojectionErrorSpline(CameraInfo const&
     // TODO(Jack): We are calculating the reprojection errors for all targets that are on the interpolated spline. That
     //  means that even if there is no initial pose that we will have an evaluation. This means there can be no foreign
     //  key constraint. Do we need new tables for this?
+    std::vector<std::uint64_t> timestamps_ns;
+    for (auto const timestamp_ns : targets | std::views::keys) {
+        timestamps_ns.push_back(timestamp_ns);
+    }
+    auto const tf_w_co{spline_w_co.EvaluateMany(timestamps_ns, spline::DerivativeOrder::Null)};
+
+    spline::BlendingCache blendings{spline_w_co.GetTimeHandler()};
     Frames tf_co_w;
     ReprojectionErrors residuals;
-    for (auto const timestamp_ns : targets | std::views::keys) {
-        auto const tf_w_co_i{spline_w_co.Evaluate(timestamp_ns, spline::DerivativeOrder::Null)};
+    for (std::size_t k{0}; k < std::size(timestamps_ns); ++k) {
+        std::uint64_t const timestamp_ns{timestamps_ns[k]};
+        auto const& tf_w_co_i{tf_w_co[k]};
         if (not tf_w_co_i) {
             continue;  // LCOV_EXCL_LINE
         }
@@ -117,19 +386,19 @@ std::pair<Frames, ReprojectionErrors> ReprojectionErrorSpline(CameraInfo const&
             continue;  // LCOV_EXCL_LINE
         }
         auto const [u_i, i]{normalized_position.value()};
+        spline::SharedBlending const blending{blendings.Blending(i)};
 
-        std::vector<double const*> parameter_blocks;
-        parameter_blocks.push_back(camera_state.intrinsics.data());
-        for (int j{0}; j < 4; ++j) {
-            parameter_blocks.push_back(spline_w_co.ControlPoints().col(i + j).data());
-        }
+        std::vector<double const*> parameter_blocks{camera_state.intrinsics.data()};
+        std::ranges::copy(cost_functions::So3Blocks(spline_w_co.ControlPoints(), i),
+                          std::back_inserter(parameter_blocks));
+        std::ranges::copy(cost_functions::R3Blocks(spline_w_co.ControlPoints(), i),
+                          std::back_inserter(parameter_blocks));
 
         auto const& [pixels, points]{targets.at(timestamp_ns).bundle};
         Eigen::Array<double, Eigen::Dynamic, 2, Eigen::RowMajor> residuals_i{pixels.rows(), 2};
         for (Eigen::Index j{0}; j < pixels.rows(); ++j) {
-            ceres::CostFunction const* const cost_function{
-                cost_functions::Create(sensor.camera_model, sensor.bounds, pixels.row(j), points.row(j), u_i,
-                                       spline_w_co.GetTimeHandler().delta_t_ns_)};
+            ceres::CostFunction const* const cost_function{cost_functions::Create(
+                sensor.camera_model, sensor.bounds, pixels.row(j), points.row(j), u_i, blending)};
 
             cost_function->Evaluate(parameter_blocks.data(), residuals_i.row(j).data(), nullptr);
 
@@ -147,6 +416,7 @@ ImuErrors EvaluateImuError(ImuMeasurements const& imu_data, Extrinsic const& ext
                            spline::Se3Spline const& spline_w_co) {
     ImuErrors imu_residuals;
 
+    spline::BlendingCache blendings{spline_w_co.GetTimeHandler()};
     for (auto const timestamp_ns : imu_data | std::views::keys) {
         // TODO(Jack): This logic is now repeated several times... we are missing the point I think. How to fix!?
         auto const normalized_position{spline_w_co.GetTimeHandler().SplinePosition(timestamp_ns, spline_w_co.Size())};
@@ -154,23 +424,25 @@ ImuErrors EvaluateImuError(ImuMeasurements const& imu_data, Extrinsic const& ext
             continue;  // LCOV_EXCL_LINE
         }
         auto const [u_i, i]{normalized_position.value()};
+        spline::SharedBlending const blending{blendings.Blending(i)};
 
-        std::vector<double const*> parameter_blocks;
-        parameter_blocks.push_back(extrinsic.se3_a_b.data());
-        for (int j{0}; j < 4; ++j) {
-            parameter_blocks.push_back(spline_w_co.ControlPoints().col(i + j).data());
-        }
+        std::vector<double const*> parameter_blocks{cost_functions::RotationBlock(extrinsic.se3_a_b.data())};
+        std::ranges::copy(cost_functions::So3Blocks(spline_w_co.ControlPoints(), i),
+                          std::back_inserter(parameter_blocks));
         ceres::CostFunction const* const cost_function_1{cost_functions::RigidBodyAngularVelocity::Create(
-            imu_data.at(timestamp_ns).angular_velocity, u_i, spline_w_co.GetTimeHandler().delta_t_ns_)};
+            imu_data.at(timestamp_ns).angular_velocity, u_i, blending)};
 
         // WARN(Jack): If we ever decide to remove the gravity residual then we need to remember to change this back to
         // length 6 and also remove the .segment() logic below!
         Array7d residual_i;
         cost_function_1->Evaluate(parameter_blocks.data(), residual_i.topRows<3>().data(), nullptr);
 
-        parameter_blocks.insert(std::cbegin(parameter_blocks) + 1, gravity.data());
+        parameter_blocks.insert(std::cbegin(parameter_blocks) + 1,
+                                {cost_functions::TranslationBlock(extrinsic.se3_a_b.data()), gravity.data()});
+        std::ranges::copy(cost_functions::R3Blocks(spline_w_co.ControlPoints(), i),
+                          std::back_inserter(parameter_blocks));
         ceres::CostFunction const* const cost_function_2{cost_functions::RigidBodyLinearAcceleration::Create(
-            imu_data.at(timestamp_ns).linear_acceleration, u_i, spline_w_co.GetTimeHandler().delta_t_ns_)};
+            imu_data.at(timestamp_ns).linear_acceleration, u_i, blending)};
 
         cost_function_2->Evaluate(parameter_blocks.data(), residual_i.bottomRows<4>().data(), nullptr);
 
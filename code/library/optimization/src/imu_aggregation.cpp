@@ -0,0 +1,84 @@
+#include "optimization/imu_aggregation.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <utility>
+#include <stdexcept>
+
+namespace reprojection::optimization {
+
+namespace {
+
+struct Bin {
+    std::uint64_t t_first_ns;
+    std::uint64_t sum_offset_ns{0};
+    Vector3d sum_angular_velocity{Vector3d::Zero()};
+    Vector3d sum_linear_acceleration{Vector3d::Zero()};
+    int num_samples{0};
+};
+
+}  // namespace
+
+AggregatedImuMeasurements AggregateImuData(ImuMeasurements const& imu_data, spline::TimeHandler const& time_handler,
+                                           int const samples_per_segment) {
+    if (samples_per_segment < 1) {
+        throw std::invalid_argument("The number of IMU samples per spline segment must be at least one");
+    }
+
+    // NOTE(Jack): The timestamps are summed as offsets from the first sample in the bin, because the sum of the
+    // absolute nanosecond timestamps of a few hundred samples overflows.
+    std::map<std::uint64_t, Bin> bins;
+    for (auto const& [timestamp_ns, data] : imu_data) {
+        if (timestamp_ns < time_handler.t0_ns_) {
+            continue;
+        }
+
+        auto const [segment, sub_bin]{[&time_handler, samples_per_segment](std::uint64_t const timestamp_ns) {
+            std::uint64_t const t_ns{timestamp_ns - time_handler.t0_ns_};
+            if (time_handler.IsUniform()) {
+                return std::pair{t_ns / time_handler.delta_t_ns_,
+                                 (t_ns % time_handler.delta_t_ns_) * samples_per_segment / time_handler.delta_t_ns_};
+            }
+
+            // NOTE(Jack): With non-uniform knots every segment gets the same number of bins, no matter its duration.
+            // Samples past the last knot cannot be evaluated on the spline anyway, they all end up in one last bin.
+            auto const& knots_ns{time_handler.knots_ns_};
+            auto const knot{std::ranges::upper_bound(knots_ns, timestamp_ns) - 1};
+            std::uint64_t const segment{static_cast<std::uint64_t>(knot - std::cbegin(knots_ns))};
+            if (knot + 1 == std::cend(knots_ns)) {
+                return std::pair{segment, std::uint64_t{0}};
+            }
+
+            return std::pair{segment, (timestamp_ns - *knot) * samples_per_segment / (*(knot + 1) - *knot)};
+        }(timestamp_ns)};
+
+        auto [it, _]{bins.try_emplace(segment * samples_per_segment + sub_bin, Bin{timestamp_ns})};
+        Bin& bin{it->second};
+        bin.sum_offset_ns += timestamp_ns - bin.t_first_ns;
+        bin.sum_angular_velocity += data.angular_velocity;
+        bin.sum_linear_acceleration += data.linear_acceleration;
+        ++bin.num_samples;
+    }
+
+    AggregatedImuMeasurements aggregated_data;
+    for (Bin const& bin : bins | std::views::values) {
+        std::uint64_t const timestamp_ns{bin.t_first_ns + bin.sum_offset_ns / bin.num_samples};
+        aggregated_data.insert({timestamp_ns,
+                                {{bin.sum_angular_velocity / bin.num_samples,
+                                  bin.sum_linear_acceleration / bin.num_samples},
+                                 bin.num_samples}});
+    }
+
+    return aggregated_data;
+}
+
+AggregatedImuMeasurements ToAggregatedImuData(ImuMeasurements const& imu_data) {
+    AggregatedImuMeasurements aggregated_data;
+    for (auto const& [timestamp_ns, data] : imu_data) {
+        aggregated_data.insert({timestamp_ns, {data, 1}});
+    }
+
+    return aggregated_data;
+}
+
+}  // namespace reprojection::optimization
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "optimization/solver_progress.hpp"
+
+#include <utility>
+
+namespace reprojection::optimization {
+
+SolverProgress::SolverProgress(SolverProgressOptions options) : options_{std::move(options)} {}
+
+void SolverProgress::Attach(ceres::Solver::Options& solver_options, std::function<SolverSnapshot(int)> snapshot) {
+    snapshot_ = std::move(snapshot);
+    if (not iterations_.empty()) {
+        iteration_offset_ = iterations_.back().iteration + 1;
+        time_offset_s_ = iterations_.back().cumulative_time_s;
+    }
+
+    solver_options.callbacks.push_back(this);
+    if (options_.on_snapshot) {
+        solver_options.update_state_every_iteration = true;
+    }
+}
+
+ceres::CallbackReturnType SolverProgress::operator()(ceres::IterationSummary const& summary) {
+    SolverIteration const iteration{iteration_offset_ + summary.iteration,
+                                    summary.cost,
+                                    summary.gradient_norm,
+                                    summary.step_norm,
+                                    summary.iteration_time_in_seconds,
+                                    time_offset_s_ + summary.cumulative_time_in_seconds,
+                                    summary.step_is_successful};
+    iterations_.push_back(iteration);
+
+    if (options_.on_iteration) {
+        options_.on_iteration(iteration);
+    }
+    if (options_.on_snapshot and snapshot_) {
+        options_.on_snapshot(snapshot_(iteration.iteration));
+    }
+
+    // NOTE(Jack): Once stopped early the reason does not change anymore, even if more solves are attached after.
+    if (early_stop_) {
+        return ceres::SOLVER_TERMINATE_SUCCESSFULLY;
+    }
+
+    if (options_.stop_token.stop_requested()) {
+        early_stop_ = EarlyStop::Cancelled;
+    } else if (options_.time_budget_s and iteration.cumulative_time_s >= *options_.time_budget_s) {
+        early_stop_ = EarlyStop::TimeBudget;
+    }
+
+    return early_stop_ ? ceres::SOLVER_TERMINATE_SUCCESSFULLY : ceres::SOLVER_CONTINUE;
+}
+
+std::vector<SolverIteration> const& SolverProgress::Iterations() const { return iterations_; }
+
+std::optional<EarlyStop> SolverProgress::StoppedEarly() const { return early_stop_; }
+
+}  // namespace reprojection::optimization
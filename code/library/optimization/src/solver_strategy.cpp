@@ -0,0 +1,169 @@
+#include "solver_strategy.hpp"
+
+#include <format>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+namespace reprojection::optimization {
+
+namespace {
+
+// NOTE(Jack): Below these numbers of free parameters a dense factorization is faster than the bookkeeping of a sparse
+// one. For the Schur solvers the number that matters is the size of the reduced system, i.e. the parameters that are
+// not eliminated.
+int constexpr max_dense_parameters{300};
+int constexpr max_dense_schur_parameters{1000};
+
+std::mutex overrides_mutex;
+std::map<SolverProblem, SolverOverride> overrides;
+
+bool IsFree(ceres::Problem const& problem, double const* const block) {
+    return problem.HasParameterBlock(block) and not problem.IsParameterBlockConstant(block);
+}
+
+int NumFreeParameters(ceres::Problem const& problem, std::vector<double*> const& blocks) {
+    int size{0};
+    for (double const* const block : blocks) {
+        if (IsFree(problem, block)) {
+            size += problem.ParameterBlockSize(block);
+        }
+    }
+
+    return size;
+}
+
+// NOTE(Jack): Ceres requires that an ordering contains every parameter block of the problem, including the constant
+// ones, therefore we give up on the ordering if the structure does not list all of them.
+std::shared_ptr<ceres::ParameterBlockOrdering> MakeOrdering(ceres::Problem const& problem,
+                                                            std::vector<std::vector<double*>> const& groups) {
+    auto ordering{std::make_shared<ceres::ParameterBlockOrdering>()};
+    int group_id{0};
+    for (auto const& group : groups) {
+        bool group_used{false};
+        for (double* const block : group) {
+            if (problem.HasParameterBlock(block) and not ordering->IsMember(block)) {
+                ordering->AddElementToGroup(block, group_id);
+                group_used = true;
+            }
+        }
+        group_id += group_used ? 1 : 0;
+    }
+
+    if (ordering->NumElements() != problem.NumParameterBlocks()) {
+        return nullptr;  // LCOV_EXCL_LINE
+    }
+
+    return ordering;
+}
+
+ceres::PreconditionerType DefaultPreconditioner(ceres::LinearSolverType const linear_solver) {
+    return ceres::IsSchurType(linear_solver) ? ceres::SCHUR_JACOBI : ceres::JACOBI;
+}
+
+}  // namespace
+
+void SetSolverOverride(SolverProblem const problem, SolverOverride const& solver_override) {
+    SolverOverride canonical_override;
+
+    ceres::LinearSolverType linear_solver;
+    if (solver_override.linear_solver) {
+        if (not ceres::StringToLinearSolverType(*solver_override.linear_solver, &linear_solver)) {
+            throw std::invalid_argument(
+                std::format("Unknown ceres linear solver '{}'", *solver_override.linear_solver));
+        }
+        canonical_override.linear_solver = ceres::LinearSolverTypeToString(linear_solver);
+    }
+
+    ceres::PreconditionerType preconditioner;
+    if (solver_override.preconditioner) {
+        if (not ceres::StringToPreconditionerType(*solver_override.preconditioner, &preconditioner)) {
+            throw std::invalid_argument(
+                std::format("Unknown ceres preconditioner '{}'", *solver_override.preconditioner));
+        }
+        canonical_override.preconditioner = ceres::PreconditionerTypeToString(preconditioner);
+    }
+
+    std::lock_guard const lock{overrides_mutex};
+    overrides[problem] = canonical_override;
+}
+
+SolverOverride GetSolverOverride(SolverProblem const problem) {
+    std::lock_guard const lock{overrides_mutex};
+    if (auto const it{overrides.find(problem)}; it != std::cend(overrides)) {
+        return it->second;
+    }
+
+    return {};
+}
+
+// NOTE(Jack): The three cases map to our three problems, but are written in terms of the structure so that a new
+// problem does not need a new case:
+//
+//  1) Banded blocks (the spline problems): A normal equation matrix that is banded, plus a few dense rows and columns
+//     for the shared blocks. We order the banded blocks in time and put the shared blocks last, which keeps the
+//     Cholesky factorization inside the band instead of relying on the fill reducing ordering to find that.
+//  2) Independent blocks (the bundle adjustment): The poses are eliminated with the Schur complement. Because our
+//     targets are known, there are no landmarks and the reduced system is only the intrinsics. Therefore, even for
+//     thousands of frames the dense Schur solver is the right choice, the reduced system does not grow with the frames.
+//  3) Only shared blocks (the angular velocity alignment): A tiny dense problem.
+SolverStrategy SelectSolverStrategy(ceres::Problem const& problem, ProblemStructure const& structure) {
+    int const independent_size{NumFreeParameters(problem, structure.independent_blocks)};
+    int const banded_size{NumFreeParameters(problem, structure.banded_blocks)};
+    int const shared_size{NumFreeParameters(problem, structure.shared_blocks)};
+
+    if (banded_size > 0) {
+        if (independent_size + banded_size + shared_size <= max_dense_parameters) {
+            return {ceres::DENSE_NORMAL_CHOLESKY, ceres::JACOBI, nullptr};
+        }
+
+        std::vector<std::vector<double*>> groups{structure.independent_blocks};
+        for (double* const block : structure.banded_blocks) {
+            groups.push_back({block});
+        }
+        groups.push_back(structure.shared_blocks);
+
+        return {ceres::SPARSE_NORMAL_CHOLESKY, ceres::JACOBI, MakeOrdering(problem, groups)};
+    } else if (independent_size > 0) {
+        ceres::LinearSolverType const linear_solver{shared_size <= max_dense_schur_parameters ? ceres::DENSE_SCHUR
+                                                                                              : ceres::SPARSE_SCHUR};
+        // NOTE(Jack): If nothing is left in the reduced system (ex. constant intrinsics) there is no second group, and
+        // we let ceres find the independent set itself.
+        if (shared_size == 0) {
+            return {linear_solver, ceres::SCHUR_JACOBI, nullptr};
+        }
+
+        return {linear_solver, ceres::SCHUR_JACOBI,
+                MakeOrdering(problem, {structure.independent_blocks, structure.shared_blocks})};
+    } else {
+        return {ceres::DENSE_QR, ceres::JACOBI, nullptr};
+    }
+}
+
+void ApplySolverStrategy(SolverProblem const problem_type, ceres::Problem const& problem,
+                         ProblemStructure const& structure, CeresState& ceres_state) {
+    SolverStrategy strategy{SelectSolverStrategy(problem, structure)};
+
+    SolverOverride const solver_override{GetSolverOverride(problem_type)};
+
+    if (solver_override.linear_solver) {
+        ceres::LinearSolverType linear_solver;
+        ceres::StringToLinearSolverType(*solver_override.linear_solver, &linear_solver);
+
+        // NOTE(Jack): A Schur elimination ordering means nothing to a non-Schur solver and the other way around.
+        if (ceres::IsSchurType(linear_solver) != ceres::IsSchurType(strategy.linear_solver)) {
+            strategy.ordering = nullptr;
+        }
+        strategy.linear_solver = linear_solver;
+        strategy.preconditioner = DefaultPreconditioner(linear_solver);
+    }
+    if (solver_override.preconditioner) {
+        ceres::StringToPreconditionerType(*solver_override.preconditioner, &strategy.preconditioner);
+    }
+
+    ceres_state.solver_options.linear_solver_type = strategy.linear_solver;
+    ceres_state.solver_options.preconditioner_type = strategy.preconditioner;
+    ceres_state.solver_options.linear_solver_ordering = strategy.ordering;
+}
+
+}  // namespace reprojection::optimization
\ No newline at end of file
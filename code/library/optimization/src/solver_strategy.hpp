@@ -0,0 +1,42 @@
+#pragma once
+
+#include <ceres/ordered_groups.h>
+#include <ceres/problem.h>
+#include <ceres/types.h>
+
+#include <memory>
+#include <vector>
+
+#include "optimization/solver_strategy.hpp"
+#include "types/ceres_types.hpp"
+
+namespace reprojection::optimization {
+
+// NOTE(Jack): Describes the role each parameter block plays in a problem, so that the solver strategy can be selected
+// without knowing anything else about the problem. Constant blocks can be listed, they are simply not counted.
+struct ProblemStructure {
+    // Blocks that no residual connects with each other (ex. the bundle adjustment frame poses). These can be eliminated
+    // with the Schur complement.
+    std::vector<double*> independent_blocks;
+    // Blocks in time order where the residuals only connect neighbouring blocks (ex. the spline control points). These
+    // result in a banded normal equation matrix.
+    std::vector<double*> banded_blocks;
+    // Blocks that are connected to most residuals (ex. the intrinsics, the extrinsic or gravity).
+    std::vector<double*> shared_blocks;
+};
+
+struct SolverStrategy {
+    ceres::LinearSolverType linear_solver;
+    ceres::PreconditionerType preconditioner;
+    std::shared_ptr<ceres::ParameterBlockOrdering> ordering;  // nullptr lets ceres choose
+};
+
+// Selects the strategy from the structure and size of the problem only, i.e. without the overrides.
+SolverStrategy SelectSolverStrategy(ceres::Problem const& problem, ProblemStructure const& structure);
+
+// Selects the strategy, applies the overrides set with SetSolverOverride() and writes the result into the solver
+// options. Must be called after all residuals are added to the problem.
+void ApplySolverStrategy(SolverProblem const problem_type, ceres::Problem const& problem,
+                         ProblemStructure const& structure, CeresState& ceres_state);
+
+}  // namespace reprojection::optimization
\ No newline at end of file
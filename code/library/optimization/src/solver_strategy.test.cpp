@@ -0,0 +1,181 @@
+#include "solver_strategy.hpp"
+
+#include <ceres/autodiff_cost_function.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "types/eigen_types.hpp"
+
+using namespace reprojection;
+
+namespace {
+
+// A minimal residual that only exists to connect two parameter blocks with each other.
+struct Connect {
+    template <typename T>
+    bool operator()(T const* const a, T const* const b, T* const residual) const {
+        residual[0] = a[0] - b[0];
+        return true;
+    }
+
+    template <int NA, int NB>
+    static ceres::CostFunction* Create() {
+        return new ceres::AutoDiffCostFunction<Connect, 1, NA, NB>(new Connect{});
+    }
+};
+
+// Bundle adjustment like: every pose is connected to the intrinsics, but not to the other poses.
+struct IndependentProblem {
+    explicit IndependentProblem(int const num_poses) : poses(num_poses, Array6d::Zero()) {
+        for (auto& pose : poses) {
+            problem.AddResidualBlock(Connect::Create<6, 4>(), nullptr, pose.data(), intrinsics.data());
+            structure.independent_blocks.push_back(pose.data());
+        }
+        structure.shared_blocks.push_back(intrinsics.data());
+    }
+
+    std::vector<Array6d> poses;
+    Array4d intrinsics{Array4d::Zero()};
+    ceres::Problem problem;
+    optimization::ProblemStructure structure;
+};
+
+// Spline like: every control point is connected to its neighbour and to the extrinsic.
+struct BandedProblem {
+    explicit BandedProblem(int const num_control_points) : control_points(num_control_points, Array6d::Zero()) {
+        for (std::size_t i{0}; i < std::size(control_points); ++i) {
+            if (i + 1 < std::size(control_points)) {
+                problem.AddResidualBlock(Connect::Create<6, 6>(), nullptr, control_points[i].data(),
+                                         control_points[i + 1].data());
+            }
+            problem.AddResidualBlock(Connect::Create<6, 6>(), nullptr, control_points[i].data(), extrinsic.data());
+            structure.banded_blocks.push_back(control_points[i].data());
+        }
+        structure.shared_blocks.push_back(extrinsic.data());
+    }
+
+    std::vector<Array6d> control_points;
+    Array6d extrinsic{Array6d::Zero()};
+    ceres::Problem problem;
+    optimization::ProblemStructure structure;
+};
+
+}  // namespace
+
+TEST(OptimizationSolverStrategy, TestIndependentBlocks) {
+    IndependentProblem data{100};
+
+    optimization::SolverStrategy const strategy{optimization::SelectSolverStrategy(data.problem, data.structure)};
+    EXPECT_EQ(strategy.linear_solver, ceres::DENSE_SCHUR);
+    EXPECT_EQ(strategy.preconditioner, ceres::SCHUR_JACOBI);
+
+    // The poses are eliminated first, the intrinsics make up the reduced system.
+    ASSERT_NE(strategy.ordering, nullptr);
+    EXPECT_EQ(strategy.ordering->NumGroups(), 2);
+    EXPECT_EQ(strategy.ordering->GroupSize(0), 100);
+    EXPECT_EQ(strategy.ordering->GroupId(data.intrinsics.data()), 1);
+}
+
+TEST(OptimizationSolverStrategy, TestIndependentBlocksConstantShared) {
+    IndependentProblem data{10};
+    data.problem.SetParameterBlockConstant(data.intrinsics.data());
+
+    optimization::SolverStrategy const strategy{optimization::SelectSolverStrategy(data.problem, data.structure)};
+    EXPECT_EQ(strategy.linear_solver, ceres::DENSE_SCHUR);
+    EXPECT_EQ(strategy.ordering, nullptr);
+}
+
+TEST(OptimizationSolverStrategy, TestBandedBlocks) {
+    BandedProblem const small_data{10};
+    optimization::SolverStrategy const small_strategy{
+        optimization::SelectSolverStrategy(small_data.problem, small_data.structure)};
+    EXPECT_EQ(small_strategy.linear_solver, ceres::DENSE_NORMAL_CHOLESKY);
+    EXPECT_EQ(small_strategy.ordering, nullptr);
+
+    BandedProblem large_data{200};
+    optimization::SolverStrategy const large_strategy{
+        optimization::SelectSolverStrategy(large_data.problem, large_data.structure)};
+    EXPECT_EQ(large_strategy.linear_solver, ceres::SPARSE_NORMAL_CHOLESKY);
+
+    // One group per control point in time order, and the extrinsic last.
+    ASSERT_NE(large_strategy.ordering, nullptr);
+    EXPECT_EQ(large_strategy.ordering->NumGroups(), 201);
+    EXPECT_EQ(large_strategy.ordering->GroupId(large_data.control_points[0].data()), 0);
+    EXPECT_EQ(large_strategy.ordering->GroupId(large_data.control_points[199].data()), 199);
+    EXPECT_EQ(large_strategy.ordering->GroupId(large_data.extrinsic.data()), 200);
+}
+
+TEST(OptimizationSolverStrategy, TestSharedBlocksOnly) {
+    BandedProblem data{10};
+    for (auto& control_point : data.control_points) {
+        data.problem.SetParameterBlockConstant(control_point.data());
+    }
+
+    optimization::SolverStrategy const strategy{optimization::SelectSolverStrategy(data.problem, data.structure)};
+    EXPECT_EQ(strategy.linear_solver, ceres::DENSE_QR);
+    EXPECT_EQ(strategy.ordering, nullptr);
+}
+
+TEST(OptimizationSolverStrategy, TestApplySolverOverride) {
+    using optimization::SolverProblem;
+
+    IndependentProblem const data{10};
+
+    // Keeps the Schur ordering and switches to the matching default preconditioner.
+    optimization::SetSolverOverride(SolverProblem::BundleAdjustment, {"ITERATIVE_SCHUR", std::nullopt});
+    CeresState iterative_state{ceres::TAKE_OWNERSHIP};
+    optimization::ApplySolverStrategy(SolverProblem::BundleAdjustment, data.problem, data.structure, iterative_state);
+    EXPECT_EQ(iterative_state.solver_options.linear_solver_type, ceres::ITERATIVE_SCHUR);
+    EXPECT_EQ(iterative_state.solver_options.preconditioner_type, ceres::SCHUR_JACOBI);
+    EXPECT_NE(iterative_state.solver_options.linear_solver_ordering, nullptr);
+
+    // A non-Schur solver drops the Schur ordering.
+    optimization::SetSolverOverride(SolverProblem::BundleAdjustment, {"DENSE_QR", std::nullopt});
+    CeresState qr_state{ceres::TAKE_OWNERSHIP};
+    optimization::ApplySolverStrategy(SolverProblem::BundleAdjustment, data.problem, data.structure, qr_state);
+    EXPECT_EQ(qr_state.solver_options.linear_solver_type, ceres::DENSE_QR);
+    EXPECT_EQ(qr_state.solver_options.preconditioner_type, ceres::JACOBI);
+    EXPECT_EQ(qr_state.solver_options.linear_solver_ordering, nullptr);
+
+    // Only the preconditioner, and only for the problem the override was set for.
+    optimization::SetSolverOverride(SolverProblem::BundleAdjustment, {std::nullopt, "CLUSTER_JACOBI"});
+    CeresState preconditioner_state{ceres::TAKE_OWNERSHIP};
+    optimization::ApplySolverStrategy(SolverProblem::BundleAdjustment, data.problem, data.structure,
+                                      preconditioner_state);
+    EXPECT_EQ(preconditioner_state.solver_options.linear_solver_type, ceres::DENSE_SCHUR);
+    EXPECT_EQ(preconditioner_state.solver_options.preconditioner_type, ceres::CLUSTER_JACOBI);
+
+    CeresState other_state{ceres::TAKE_OWNERSHIP};
+    optimization::ApplySolverStrategy(SolverProblem::ExtrinsicOptimization, data.problem, data.structure,
+                                      other_state);
+    EXPECT_EQ(other_state.solver_options.preconditioner_type, ceres::SCHUR_JACOBI);
+
+    // Reset so the other tests in this process are not affected.
+    optimization::SetSolverOverride(SolverProblem::BundleAdjustment, {});
+}
+
+TEST(OptimizationSolverStrategy, TestGetSolverOverride) {
+    using optimization::SolverProblem;
+
+    EXPECT_FALSE(optimization::GetSolverOverride(SolverProblem::BundleAdjustment).linear_solver.has_value());
+
+    // The names are returned in the ceres spelling, no matter how they were set.
+    optimization::SetSolverOverride(SolverProblem::BundleAdjustment, {"dense_qr", "Jacobi"});
+    optimization::SolverOverride const solver_override{optimization::GetSolverOverride(SolverProblem::BundleAdjustment)};
+    EXPECT_EQ(solver_override.linear_solver, "DENSE_QR");
+    EXPECT_EQ(solver_override.preconditioner, "JACOBI");
+    EXPECT_FALSE(optimization::GetSolverOverride(SolverProblem::ExtrinsicOptimization).linear_solver.has_value());
+
+    optimization::SetSolverOverride(SolverProblem::BundleAdjustment, {});
+    EXPECT_FALSE(optimization::GetSolverOverride(SolverProblem::BundleAdjustment).linear_solver.has_value());
+}
+
+TEST(OptimizationSolverStrategy, TestInvalidSolverOverride) {
+    using optimization::SolverProblem;
+
+    EXPECT_THROW(optimization::SetSolverOverride(SolverProblem::BundleAdjustment, {"FASTEST_SOLVER", std::nullopt}),
+                 std::invalid_argument);
+    EXPECT_THROW(optimization::SetSolverOverride(SolverProblem::BundleAdjustment, {std::nullopt, "NOT_A_JACOBI"}),
+                 std::invalid_argument);
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "geometry/lie.hpp"
 #include "spline/spline_initialization.hpp"
 #include "testing_mocks/data_generators.hpp"
 #include "testing_utilities/constants.hpp"
@@ -30,4 +31,30 @@ TEST(OptimizationAngularVelocityAlignment, TestAngularVelocityAlignment) {
     EXPECT_TRUE(aa_imu_co.isZero(1e-3));  // Identity matrix
     EXPECT_EQ(diagnostics.solver_summary.termination_type, ceres::CONVERGENCE);
     EXPECT_NEAR(diagnostics.solver_summary.final_cost, 0, 1e-6);
+}
+
+TEST(OptimizationAngularVelocityAlignment, TestKabschAngularVelocityAlignment) {
+    double const duration_s{30};
+    auto [imu_data, spline_w_b]{testing_mocks::GenerateImuData(duration_s, 20)};
+
+    VelocityMeasurements const omega_imu{ExtractAngularVelocity(imu_data)};
+    Array3d const aa_imu_co{optimization::KabschAngularVelocityAlignment(omega_imu, spline_w_b)};
+    EXPECT_TRUE(aa_imu_co.isZero(1e-3));  // Identity matrix
+
+    // Rotate the IMU measurements by a known extrinsic rotation, which the alignment then needs to recover.
+    Vector3d const gt_aa_imu_co{0.1, -0.2, 0.3};
+    Matrix3d const R_imu_co{geometry::Exp<double>(gt_aa_imu_co)};
+    VelocityMeasurements rotated_omega_imu;
+    for (auto const& [timestamp_ns, omega_i] : omega_imu) {
+        rotated_omega_imu.insert({timestamp_ns, {R_imu_co * omega_i.velocity}});
+    }
+
+    Array3d const rotated_aa_imu_co{optimization::KabschAngularVelocityAlignment(rotated_omega_imu, spline_w_b)};
+    EXPECT_TRUE(rotated_aa_imu_co.isApprox(gt_aa_imu_co.array(), 1e-3));
+
+    // The ceres optimization minimizes the same cost, so refining the closed form solution must not move it.
+    auto const [refined_aa_imu_co, diagnostics]{
+        optimization::AngularVelocityAlignment(rotated_omega_imu, spline_w_b, rotated_aa_imu_co, 1)};
+    EXPECT_EQ(diagnostics.solver_summary.termination_type, ceres::CONVERGENCE);
+    EXPECT_TRUE(refined_aa_imu_co.isApprox(rotated_aa_imu_co, 1e-6));
 }
\ No newline at end of file
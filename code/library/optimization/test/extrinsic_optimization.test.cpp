@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include "geometry/lie.hpp"
+#include "optimization/solver_progress.hpp"
 #include "spline/spline_initialization.hpp"
 #include "testing_mocks/data_generators.hpp"
 #include "testing_utilities/constants.hpp"
@@ -41,13 +43,141 @@ TEST(OptimizationExtrinsicOptimization, TestExtrinsicOptimization) {
                                       Vector6d{-1.19516, 1.17219, -1.23556, -0.0242935, 0.0530558, 0.0251949}};
     Vector3d const initial_gravity{Vector3d{-0.212548, -0.293729, 9.79995}};
 
-    auto const [_1, optimized_extrinsic, optimized_gravity]{optimization::ExtrinsicOptimization(
-        imu_data, spline_w_co, initial_extrinsic, initial_gravity, camera_info, targets, {tu::pinhole_intrinsics}, 1)};
+    auto const [_1, optimized_extrinsic, optimized_gravity, _2]{optimization::ExtrinsicOptimization(
+        imu_data, spline_w_co, initial_extrinsic, initial_gravity, camera_info, targets, {tu::pinhole_intrinsics},
+        std::nullopt, 1)};
 
     EXPECT_TRUE(optimized_extrinsic.se3_a_b.isApprox(initial_extrinsic.se3_a_b, 1e-2));
     EXPECT_TRUE(optimized_gravity.isApprox(initial_gravity, 1e-2));
 }
 
+// Same data and heuristic values as the test above, but solved in windows of 100 control points (two seconds).
+TEST(OptimizationExtrinsicOptimization, TestSlidingWindowExtrinsicOptimization) {
+    double const duration_s{10};
+    CameraInfo const camera_info{CameraModel::Pinhole, tu::image_bounds};
+
+    auto const [targets, poses_co_w]{
+        testing_mocks::GenerateMvgData(camera_info, CameraState{tu::pinhole_intrinsics}, duration_s, 10)};
+    auto const [imu_data, _]{testing_mocks::GenerateImuData(duration_s, 20)};
+
+    Frames poses_w_co;
+    for (auto const& [timestamp_ns, pose_co_w] : poses_co_w) {
+        poses_w_co.insert({timestamp_ns, {geometry::Log(geometry::Exp(pose_co_w.pose).inverse())}});
+    }
+    spline::Se3Spline const spline_w_co{spline::InitializeSe3SplineState(poses_w_co, 50)};
+
+    Extrinsic const initial_extrinsic{AssetId{1}, AssetId{2},
+                                      Vector6d{-1.19516, 1.17219, -1.23556, -0.0242935, 0.0530558, 0.0251949}};
+    Vector3d const initial_gravity{Vector3d{-0.212548, -0.293729, 9.79995}};
+
+    auto const [optimized_spline, optimized_extrinsic, optimized_gravity, _2]{
+        optimization::SlidingWindowExtrinsicOptimization(imu_data, spline_w_co, initial_extrinsic, initial_gravity,
+                                                         camera_info, targets, {tu::pinhole_intrinsics}, std::nullopt,
+                                                         100, 1)};
+
+    EXPECT_EQ(optimized_spline.Size(), spline_w_co.Size());
+    EXPECT_TRUE(optimized_extrinsic.se3_a_b.isApprox(initial_extrinsic.se3_a_b, 1e-2));
+    EXPECT_TRUE(optimized_gravity.isApprox(initial_gravity, 1e-2));
+
+    EXPECT_THROW(optimization::SlidingWindowExtrinsicOptimization(imu_data, spline_w_co, initial_extrinsic,
+                                                                  initial_gravity, camera_info, targets,
+                                                                  {tu::pinhole_intrinsics}, std::nullopt, 4, 1),
+                 std::invalid_argument);
+}
+
+// The heuristic values from above are where the optimization converges to. Starting from a perturbed extrinsic the
+// sliding window optimization has to find its way back there.
+TEST(OptimizationExtrinsicOptimization, TestSlidingWindowRecoversPerturbedExtrinsic) {
+    double const duration_s{10};
+    CameraInfo const camera_info{CameraModel::Pinhole, tu::image_bounds};
+
+    auto const [targets, poses_co_w]{
+        testing_mocks::GenerateMvgData(camera_info, CameraState{tu::pinhole_intrinsics}, duration_s, 10)};
+    auto const [imu_data, _]{testing_mocks::GenerateImuData(duration_s, 20)};
+
+    Frames poses_w_co;
+    for (auto const& [timestamp_ns, pose_co_w] : poses_co_w) {
+        poses_w_co.insert({timestamp_ns, {geometry::Log(geometry::Exp(pose_co_w.pose).inverse())}});
+    }
+    spline::Se3Spline const spline_w_co{spline::InitializeSe3SplineState(poses_w_co, 50)};
+
+    Extrinsic const converged_extrinsic{AssetId{1}, AssetId{2},
+                                        Vector6d{-1.19516, 1.17219, -1.23556, -0.0242935, 0.0530558, 0.0251949}};
+    Vector3d const converged_gravity{Vector3d{-0.212548, -0.293729, 9.79995}};
+
+    // Roughly 5 degrees of rotation and 3.5 cm of translation, far outside the tolerance checked below.
+    Extrinsic perturbed_extrinsic{converged_extrinsic};
+    perturbed_extrinsic.se3_a_b += Array6d{0.05, -0.05, 0.05, 0.02, -0.02, 0.02};
+    ASSERT_FALSE(perturbed_extrinsic.se3_a_b.isApprox(converged_extrinsic.se3_a_b, 1e-2));
+
+    auto const [_1, optimized_extrinsic, optimized_gravity, _2]{optimization::SlidingWindowExtrinsicOptimization(
+        imu_data, spline_w_co, perturbed_extrinsic, converged_gravity, camera_info, targets, {tu::pinhole_intrinsics},
+        std::nullopt, 100, 1)};
+
+    EXPECT_TRUE(optimized_extrinsic.se3_a_b.isApprox(converged_extrinsic.se3_a_b, 1e-2))
+        << "Result:\n"
+        << optimized_extrinsic.se3_a_b.transpose() << "\nexpected result:\n"
+        << converged_extrinsic.se3_a_b.transpose();
+    EXPECT_TRUE(optimized_gravity.isApprox(converged_gravity, 1e-2));
+
+    // A used up time budget stops every window, not only the final refinement, so nothing moves at all.
+    optimization::SolverProgress progress{{{}, 0.0, {}, {}}};
+    auto const [_3, stopped_extrinsic, stopped_gravity, _4]{optimization::SlidingWindowExtrinsicOptimization(
+        imu_data, spline_w_co, perturbed_extrinsic, converged_gravity, camera_info, targets, {tu::pinhole_intrinsics},
+        std::nullopt, 100, 1, &progress)};
+
+    EXPECT_EQ(progress.StoppedEarly(), optimization::EarlyStop::TimeBudget);
+    EXPECT_TRUE(stopped_extrinsic.se3_a_b.isApprox(perturbed_extrinsic.se3_a_b));
+    EXPECT_TRUE(stopped_gravity.isApprox(converged_gravity));
+}
+
+// Same data and heuristic values as the first test, but solved at 12.5Hz and 25Hz knots before the 50Hz knots.
+TEST(OptimizationExtrinsicOptimization, TestCoarseToFineExtrinsicOptimization) {
+    double const duration_s{10};
+    CameraInfo const camera_info{CameraModel::Pinhole, tu::image_bounds};
+
+    auto const [targets, poses_co_w]{
+        testing_mocks::GenerateMvgData(camera_info, CameraState{tu::pinhole_intrinsics}, duration_s, 10)};
+    auto const [imu_data, _]{testing_mocks::GenerateImuData(duration_s, 20)};
+
+    Frames poses_w_co;
+    for (auto const& [timestamp_ns, pose_co_w] : poses_co_w) {
+        poses_w_co.insert({timestamp_ns, {geometry::Log(geometry::Exp(pose_co_w.pose).inverse())}});
+    }
+    spline::Se3Spline const spline_w_co{spline::InitializeSe3SplineState(poses_w_co, 50)};
+
+    Extrinsic const initial_extrinsic{AssetId{1}, AssetId{2},
+                                      Vector6d{-1.19516, 1.17219, -1.23556, -0.0242935, 0.0530558, 0.0251949}};
+    Vector3d const initial_gravity{Vector3d{-0.212548, -0.293729, 9.79995}};
+
+    auto const [optimized_spline, optimized_extrinsic, optimized_gravity, _2]{
+        optimization::CoarseToFineExtrinsicOptimization(imu_data, spline_w_co, initial_extrinsic, initial_gravity,
+                                                        camera_info, targets, {tu::pinhole_intrinsics}, std::nullopt,
+                                                        2, 1)};
+
+    EXPECT_EQ(optimized_spline.GetTimeHandler(), spline_w_co.GetTimeHandler());
+    EXPECT_GE(optimized_spline.Size(), spline_w_co.Size());
+    EXPECT_TRUE(optimized_extrinsic.se3_a_b.isApprox(initial_extrinsic.se3_a_b, 1e-2));
+    EXPECT_TRUE(optimized_gravity.isApprox(initial_gravity, 1e-2));
+
+    // Every level reports to the progress, not only the last one, so a used up time budget stops the coarsest level
+    // already. The coarse result is not returned, but the initial spline is.
+    optimization::SolverProgress progress{{{}, 0.0, {}, {}}};
+    auto const [stopped_spline, stopped_extrinsic, _4, _5]{optimization::CoarseToFineExtrinsicOptimization(
+        imu_data, spline_w_co, initial_extrinsic, initial_gravity, camera_info, targets, {tu::pinhole_intrinsics},
+        std::nullopt, 2, 1, &progress)};
+    EXPECT_EQ(progress.StoppedEarly(), optimization::EarlyStop::TimeBudget);
+    EXPECT_EQ(std::size(progress.Iterations()), 1);  // Iteration zero of the coarsest level
+    EXPECT_EQ(stopped_spline.GetTimeHandler(), spline_w_co.GetTimeHandler());
+    EXPECT_TRUE(stopped_spline.ControlPoints().isApprox(spline_w_co.ControlPoints()));
+    EXPECT_TRUE(stopped_extrinsic.se3_a_b.isApprox(initial_extrinsic.se3_a_b));
+
+    EXPECT_THROW(optimization::CoarseToFineExtrinsicOptimization(imu_data, spline_w_co, initial_extrinsic,
+                                                                 initial_gravity, camera_info, targets,
+                                                                 {tu::pinhole_intrinsics}, std::nullopt, -1, 1),
+                 std::invalid_argument);
+}
+
 // See comments in TEST(OptimizationBundleAdjustment, TestEvaluateReprojectionResiduals) for context.
 TEST(OptimizationExtrinsicOptimization, TestReprojectionErrorSpline) {
     MatrixX2d const gt_pixels{{-1, -1},  //
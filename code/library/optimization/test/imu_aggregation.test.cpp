@@ -0,0 +1,84 @@
+#include "optimization/imu_aggregation.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ranges>
+
+#include "testing_mocks/data_generators.hpp"
+
+using namespace reprojection;
+
+TEST(OptimizationImuAggregation, TestAggregateImuData) {
+    // A spline that starts at 100ns with segments of 100ns, and four samples per segment. Two samples fall in the first
+    // half of the first segment, one in the second half and one before the spline starts.
+    spline::TimeHandler const time_handler{100, 100};
+    ImuMeasurements const imu_data{
+        {50, {{9, 9, 9}, {9, 9, 9}}},
+        {110, {{1, 2, 3}, {4, 5, 6}}},
+        {130, {{3, 4, 5}, {6, 7, 8}}},
+        {160, {{1, 1, 1}, {2, 2, 2}}},
+    };
+
+    auto const aggregated_data{optimization::AggregateImuData(imu_data, time_handler, 2)};
+
+    ASSERT_EQ(std::size(aggregated_data), 2);
+
+    auto const& first{aggregated_data.at(120)};
+    EXPECT_EQ(first.num_samples, 2);
+    EXPECT_TRUE(first.data.angular_velocity.isApprox(Vector3d{2, 3, 4}));
+    EXPECT_TRUE(first.data.linear_acceleration.isApprox(Vector3d{5, 6, 7}));
+
+    auto const& second{aggregated_data.at(160)};
+    EXPECT_EQ(second.num_samples, 1);
+    EXPECT_TRUE(second.data.angular_velocity.isApprox(Vector3d{1, 1, 1}));
+    EXPECT_TRUE(second.data.linear_acceleration.isApprox(Vector3d{2, 2, 2}));
+}
+
+TEST(OptimizationImuAggregation, TestAggregateImuDataNonUniformKnots) {
+    // Two segments of different duration, [100, 120) and [120, 220), each split into two bins.
+    spline::TimeHandler const time_handler{std::vector<std::uint64_t>{100, 120, 220}};
+    ImuMeasurements const imu_data{
+        {105, {{1, 1, 1}, {1, 1, 1}}},
+        {115, {{2, 2, 2}, {2, 2, 2}}},
+        {130, {{3, 3, 3}, {3, 3, 3}}},
+        {150, {{5, 5, 5}, {5, 5, 5}}},
+        {190, {{7, 7, 7}, {7, 7, 7}}},
+    };
+
+    auto const aggregated_data{optimization::AggregateImuData(imu_data, time_handler, 2)};
+
+    ASSERT_EQ(std::size(aggregated_data), 4);
+    EXPECT_EQ(aggregated_data.at(105).num_samples, 1);
+    EXPECT_EQ(aggregated_data.at(115).num_samples, 1);
+    EXPECT_EQ(aggregated_data.at(140).num_samples, 2);
+    EXPECT_TRUE(aggregated_data.at(140).data.angular_velocity.isApprox(Vector3d{4, 4, 4}));
+    EXPECT_EQ(aggregated_data.at(190).num_samples, 1);
+}
+
+TEST(OptimizationImuAggregation, TestAggregateImuDataRate) {
+    // 200Hz IMU data on a spline with 20Hz knots, i.e. ten samples per segment.
+    auto const [imu_data, _]{testing_mocks::GenerateImuData(10, 200)};
+    spline::TimeHandler const time_handler{std::cbegin(imu_data)->first, 50'000'000};
+
+    for (int const samples_per_segment : {1, 2, 5}) {
+        auto const aggregated_data{optimization::AggregateImuData(imu_data, time_handler, samples_per_segment)};
+
+        // No sample is lost, the samples are only combined.
+        int num_samples{0};
+        for (auto const& measurement : aggregated_data | std::views::values) {
+            num_samples += measurement.num_samples;
+        }
+        EXPECT_EQ(num_samples, std::ssize(imu_data));
+        EXPECT_LE(std::ssize(aggregated_data), samples_per_segment * 201);
+        EXPECT_GE(std::ssize(aggregated_data), samples_per_segment * 199);
+    }
+
+    // One measurement per sample with a weight of one.
+    auto const full_data{optimization::ToAggregatedImuData(imu_data)};
+    EXPECT_EQ(std::size(full_data), std::size(imu_data));
+    EXPECT_EQ(std::cbegin(full_data)->second.num_samples, 1);
+}
+
+TEST(OptimizationImuAggregation, TestAggregateImuDataInvalid) {
+    EXPECT_THROW(optimization::AggregateImuData({}, {0, 100}, 0), std::invalid_argument);
+}
\ No newline at end of file
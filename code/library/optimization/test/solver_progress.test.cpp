@@ -0,0 +1,121 @@
+#include "optimization/solver_progress.hpp"
+
+#include <gtest/gtest.h>
+
+#include "geometry/lie.hpp"
+#include "optimization/bundle_adjustment.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+#include "types/calibration_types.hpp"
+
+using namespace reprojection;
+
+namespace {
+
+// Noisy initial poses so that the solver actually needs to run a few iterations, see
+// TEST(OptimizationBundleAdjustment, TestNoisyBundleAdjustment).
+std::tuple<CameraInfo, CameraMeasurements, OptimizationState> NoisyBundleAdjustmentProblem() {
+    CameraInfo const sensor{CameraModel::Pinhole, testing_utilities::image_bounds};
+    CameraState const gt_intrinsics{testing_utilities::pinhole_intrinsics};
+    auto const [targets, gt_frames]{testing_mocks::GenerateMvgData(sensor, gt_intrinsics, 60, 1, false)};
+
+    Frames noisy_frames{gt_frames};
+    for (auto& [_, frame_i] : noisy_frames) {
+        Isometry3d const SE3_i{geometry::Exp(frame_i.pose)};
+        frame_i.pose = geometry::Log(testing_mocks::AddGaussianNoise(0.1, 0.1, SE3_i));
+    }
+
+    return {sensor, targets, OptimizationState{gt_intrinsics, noisy_frames}};
+}
+
+}  // namespace
+
+TEST(OptimizationSolverProgress, TestRecordIterations) {
+    auto const [sensor, targets, initial_state]{NoisyBundleAdjustmentProblem()};
+
+    std::vector<SolverIteration> sunk_iterations;
+    std::vector<SolverSnapshot> sunk_snapshots;
+    optimization::SolverProgress progress{
+        {{},
+         std::nullopt,
+         [&sunk_iterations](SolverIteration const& iteration) { sunk_iterations.push_back(iteration); },
+         [&sunk_snapshots](SolverSnapshot const& snapshot) { sunk_snapshots.push_back(snapshot); }}};
+
+    auto const [optimized_state, diagnostics]{
+        optimization::BundleAdjustment(sensor, targets, initial_state, 1, false, &progress)};
+    EXPECT_EQ(diagnostics.solver_summary.termination_type, ceres::CONVERGENCE);
+    EXPECT_FALSE(progress.StoppedEarly().has_value());
+
+    // Ceres reports iteration zero plus one iteration per (successful or not) step.
+    auto const& iterations{progress.Iterations()};
+    ASSERT_EQ(std::size(iterations), std::size(diagnostics.solver_summary.iterations));
+    EXPECT_EQ(std::size(sunk_iterations), std::size(iterations));
+    EXPECT_EQ(iterations.front().iteration, 0);
+    EXPECT_EQ(iterations.front().cost, diagnostics.solver_summary.initial_cost);
+    EXPECT_GT(iterations.back().cumulative_time_s, 0);
+
+    // The last snapshot is the final state of the optimization.
+    ASSERT_EQ(std::size(sunk_snapshots), std::size(iterations));
+    ASSERT_TRUE(sunk_snapshots.back().intrinsics.has_value());
+    EXPECT_EQ(sunk_snapshots.back().intrinsics->first, CameraModel::Pinhole);
+    EXPECT_TRUE(sunk_snapshots.back().intrinsics->second.isApprox(optimized_state.camera_state.intrinsics));
+    EXPECT_FALSE(sunk_snapshots.back().se3_a_b.has_value());
+}
+
+TEST(OptimizationSolverProgress, TestCancel) {
+    auto const [sensor, targets, initial_state]{NoisyBundleAdjustmentProblem()};
+
+    std::stop_source stop_source;
+    optimization::SolverProgress progress{{stop_source.get_token(),
+                                           std::nullopt,
+                                           [&stop_source](SolverIteration const& iteration) {
+                                               if (iteration.iteration == 2) {
+                                                   stop_source.request_stop();
+                                               }
+                                           },
+                                           {}}};
+
+    auto const [optimized_state, diagnostics]{
+        optimization::BundleAdjustment(sensor, targets, initial_state, 1, false, &progress)};
+
+    // The state is not thrown away when we stop early, we get the best state so far.
+    EXPECT_EQ(diagnostics.solver_summary.termination_type, ceres::USER_SUCCESS);
+    EXPECT_EQ(progress.StoppedEarly(), optimization::EarlyStop::Cancelled);
+    EXPECT_EQ(std::size(progress.Iterations()), 3);
+    EXPECT_LT(diagnostics.solver_summary.final_cost, diagnostics.solver_summary.initial_cost);
+    EXPECT_EQ(std::size(optimized_state.frames), std::size(initial_state.frames));
+}
+
+TEST(OptimizationSolverProgress, TestSeveralSolves) {
+    auto const [sensor, targets, initial_state]{NoisyBundleAdjustmentProblem()};
+
+    optimization::SolverProgress progress{{{}, std::nullopt, {}, {}}};
+    auto const [first_state, first_diagnostics]{
+        optimization::BundleAdjustment(sensor, targets, initial_state, 1, false, &progress)};
+    auto const [second_state, second_diagnostics]{
+        optimization::BundleAdjustment(sensor, targets, first_state, 1, false, &progress)};
+
+    // Both solves are recorded as one run, the iteration numbers and the time continue where the first solve stopped.
+    auto const& iterations{progress.Iterations()};
+    ASSERT_EQ(std::size(iterations), std::size(first_diagnostics.solver_summary.iterations) +
+                                         std::size(second_diagnostics.solver_summary.iterations));
+    for (std::size_t i{1}; i < std::size(iterations); ++i) {
+        EXPECT_EQ(iterations[i].iteration, iterations[i - 1].iteration + 1);
+        EXPECT_GE(iterations[i].cumulative_time_s, iterations[i - 1].cumulative_time_s);
+    }
+    EXPECT_FALSE(progress.StoppedEarly().has_value());
+}
+
+TEST(OptimizationSolverProgress, TestTimeBudget) {
+    auto const [sensor, targets, initial_state]{NoisyBundleAdjustmentProblem()};
+
+    optimization::SolverProgress progress{{{}, 0.0, {}, {}}};
+    auto const [optimized_state, diagnostics]{
+        optimization::BundleAdjustment(sensor, targets, initial_state, 1, false, &progress)};
+
+    // A zero time budget is already used up at iteration zero, therefore we get the initial state back.
+    EXPECT_EQ(diagnostics.solver_summary.termination_type, ceres::USER_SUCCESS);
+    EXPECT_EQ(progress.StoppedEarly(), optimization::EarlyStop::TimeBudget);
+    EXPECT_EQ(std::size(progress.Iterations()), 1);
+    EXPECT_TRUE(optimized_state.camera_state.intrinsics.isApprox(initial_state.camera_state.intrinsics));
+}
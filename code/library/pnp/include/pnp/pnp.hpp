@@ -22,6 +22,20 @@ enum class PnpErrorCode {
 using PoseWithCost = std::pair<Isometry3d, double>;
 using PnpResult = std::variant<PoseWithCost, PnpErrorCode>;
 
-PnpResult Pnp(Bundle const& bundle, std::optional<ImageBounds> bounds = std::nullopt);
+// NOTE(Jack): Both refinements minimize the same cost. The fixed size Levenberg-Marquardt does not build a ceres
+// problem per call and is therefore much faster (see the pnp benchmark), the ceres bundle adjustment is kept as the
+// reference implementation.
+enum class PnpRefinement {
+    Ceres,
+    FixedSize,
+};
+
+PnpResult Pnp(Bundle const& bundle, std::optional<ImageBounds> bounds = std::nullopt,
+              PnpRefinement const refinement = PnpRefinement::FixedSize);
+
+// NOTE(Jack): Skips the DLT and only refines the given pose, for when a good initial pose is already known (ex. the pose
+// of the previous frame of a video). The bundle must be in unit image coordinates (K = I and bounds [-1, 1)), like in
+// the planar Dlt22 case of Pnp(), and needs the same minimum number of points as that case.
+PnpResult SeededPnp(Bundle const& bundle, Isometry3d const& initial_tf_co_w);
 
 }  // namespace reprojection::pnp
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "dlt.hpp"
 #include "plane_utilities.hpp"
+#include "pose_refinement.hpp"
 
 namespace reprojection::pnp {
 
@@ -18,7 +19,7 @@ namespace reprojection::pnp {
 //  degree FoV? Because only points that have x/z or y/z ratio greater than one are invalid. Is this really a physically
 //  meaningful and correct piece of logic? Or does it just happen to work, what if I chose to set the bounds as -2,+2
 //  instead?
-PnpResult Pnp(Bundle const& bundle, std::optional<ImageBounds> bounds) {
+PnpResult Pnp(Bundle const& bundle, std::optional<ImageBounds> bounds, PnpRefinement const refinement) {
     Isometry3d tf_co_w;
     Array3d pinhole_intrinsics;
 
@@ -50,6 +51,15 @@ PnpResult Pnp(Bundle const& bundle, std::optional<ImageBounds> bounds) {
         return PnpErrorCode::NotAllFinite;  // LCOV_EXCL_LINE
     }
 
+    if (refinement == PnpRefinement::FixedSize) {
+        auto const result{RefinePose(bundle, pinhole_intrinsics, bounds.value(), tf_co_w)};
+        if (not result) {
+            return PnpErrorCode::FailedRefinement;  // LCOV_EXCL_LINE
+        }
+
+        return *result;
+    }
+
     // Dummy value only for tracking and consistency of data access below
     uint64_t const timestamp_ns{0};
 
@@ -69,4 +79,17 @@ PnpResult Pnp(Bundle const& bundle, std::optional<ImageBounds> bounds) {
     }
 }
 
+PnpResult SeededPnp(Bundle const& bundle, Isometry3d const& initial_tf_co_w) {
+    if (bundle.pixels.rows() <= 4) {
+        return PnpErrorCode::InvalidDlt;
+    }
+
+    auto const result{RefinePose(bundle, {1, 0, 0}, ImageBounds{-1, 1, -1, 1}, initial_tf_co_w)};
+    if (not result) {
+        return PnpErrorCode::FailedRefinement;  // LCOV_EXCL_LINE
+    }
+
+    return *result;
+}
+
 }  // namespace reprojection::pnp
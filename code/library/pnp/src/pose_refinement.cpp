@@ -0,0 +1,162 @@
+#include "pose_refinement.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <Eigen/Cholesky>
+#include <Eigen/Geometry>
+
+#include "projection_functions/pinhole.hpp"
+
+namespace reprojection::pnp {
+
+namespace {
+
+using Matrix6d = Eigen::Matrix<double, 6, 6>;
+
+// NOTE(Jack): Same value as the ReprojectionError_T cost function uses for points that do not project, see the long
+// note there for why we do not simply drop these points.
+double constexpr invalid_residual{256};
+
+// NOTE(Jack): The termination criteria and their values are the same as the ceres defaults, which is what the bundle
+// adjustment based refinement used before.
+int constexpr max_num_iterations{50};
+double constexpr function_tolerance{1e-6};
+double constexpr gradient_tolerance{1e-10};
+double constexpr parameter_tolerance{1e-8};
+double constexpr initial_lambda{1e-4};  // Inverse of the ceres initial trust region radius
+double constexpr min_diagonal{1e-6};
+
+// Equivalent to ceres::HuberLoss(1.0), returns rho(s) and its derivative rho'(s) for the squared residual norm s.
+std::pair<double, double> HuberLoss(double const s) {
+    if (s <= 1.0) {
+        return {s, 1.0};
+    }
+
+    double const r{std::sqrt(s)};
+    return {(2.0 * r) - 1.0, 1.0 / r};
+}
+
+// The cost and the loss weighted normal equations (J^T * J and J^T * r) of the problem at one pose.
+struct Linearization {
+    double cost{0};
+    Matrix6d JtJ{Matrix6d::Zero()};
+    Vector6d Jtr{Vector6d::Zero()};
+};
+
+// NOTE(Jack): We parameterize the pose update as delta = {delta_aa, delta_p} where R_co_w <- Exp(delta_aa) * R_co_w and
+// p_co_w <- p_co_w + delta_p. Given point_co = R_co_w * point_w + p_co_w this makes the derivative of point_co with
+// respect to delta simply [-[R_co_w * point_w]_x, I], with no need to differentiate through the exponential map.
+Linearization Linearize(Bundle const& bundle, Array3d const& pinhole_intrinsics, ImageBounds const& bounds,
+                        Isometry3d const& tf_co_w) {
+    double const f{pinhole_intrinsics[0]};
+
+    Linearization linearization;
+    for (Eigen::Index i{0}; i < bundle.pixels.rows(); ++i) {
+        Vector3d const rotated_point{tf_co_w.linear() * bundle.points.row(i).transpose()};
+        Vector3d const point_co{rotated_point + tf_co_w.translation()};
+
+        auto const pixel{projection_functions::Pinhole::Project<double>(pinhole_intrinsics, bounds, point_co.array())};
+        if (not pixel) {
+            // The residual is constant, therefore it adds to the cost but there is no jacobian contribution.
+            double const s{2 * invalid_residual * invalid_residual};
+            linearization.cost += 0.5 * HuberLoss(s).first;
+            continue;
+        }
+
+        Vector2d const residual{bundle.pixels.row(i).transpose() - pixel->matrix()};
+        auto const [rho, rho_prime]{HuberLoss(residual.squaredNorm())};
+        linearization.cost += 0.5 * rho;
+
+        double const x{point_co[0]};
+        double const y{point_co[1]};
+        double const z{point_co[2]};
+
+        Eigen::Matrix<double, 2, 3> J_pixel_point;
+        J_pixel_point << f / z, 0, -f * x / (z * z),  //
+            0, f / z, -f * y / (z * z);
+
+        // -[rotated_point]_x for the rotation and identity for the translation.
+        Eigen::Matrix<double, 3, 6> J_point_delta;
+        J_point_delta << 0, rotated_point[2], -rotated_point[1], 1, 0, 0,  //
+            -rotated_point[2], 0, rotated_point[0], 0, 1, 0,               //
+            rotated_point[1], -rotated_point[0], 0, 0, 0, 1;
+
+        // The residual is measured minus projected pixel, hence the minus sign.
+        Eigen::Matrix<double, 2, 6> const J{-J_pixel_point * J_point_delta};
+        linearization.JtJ.noalias() += rho_prime * J.transpose() * J;
+        linearization.Jtr.noalias() += rho_prime * J.transpose() * residual;
+    }
+
+    return linearization;
+}
+
+Isometry3d Update(Isometry3d const& tf_co_w, Vector6d const& delta) {
+    Vector3d const delta_aa{delta.head<3>()};
+    double const angle{delta_aa.norm()};
+
+    Isometry3d updated{tf_co_w};
+    if (angle > 0) {
+        updated.linear() = Eigen::AngleAxisd{angle, delta_aa / angle}.toRotationMatrix() * tf_co_w.linear();
+    }
+    updated.translation() += delta.tail<3>();
+
+    return updated;
+}
+
+double ParameterNorm(Isometry3d const& tf_co_w) {
+    double const angle{Eigen::AngleAxisd{tf_co_w.linear()}.angle()};
+
+    return std::sqrt((angle * angle) + tf_co_w.translation().squaredNorm());
+}
+
+}  // namespace
+
+std::optional<PoseWithCost> RefinePose(Bundle const& bundle, Array3d const& pinhole_intrinsics,
+                                       ImageBounds const& bounds, Isometry3d const& tf_co_w) {
+    Isometry3d tf{tf_co_w};
+    Linearization linearization{Linearize(bundle, pinhole_intrinsics, bounds, tf)};
+    double lambda{initial_lambda};
+
+    for (int i{0}; i < max_num_iterations; ++i) {
+        if (linearization.Jtr.lpNorm<Eigen::Infinity>() <= gradient_tolerance) {
+            return PoseWithCost{tf, linearization.cost};
+        }
+
+        // Levenberg-Marquardt damping of the Gauss-Newton normal equations.
+        Matrix6d A{linearization.JtJ};
+        A.diagonal() += lambda * linearization.JtJ.diagonal().cwiseMax(min_diagonal);
+        Vector6d const delta{A.ldlt().solve(-linearization.Jtr)};
+        if (not delta.allFinite()) {
+            return std::nullopt;  // LCOV_EXCL_LINE
+        }
+
+        bool const small_step{delta.norm() <= parameter_tolerance * (ParameterNorm(tf) + parameter_tolerance)};
+
+        Isometry3d const candidate_tf{Update(tf, delta)};
+        Linearization const candidate{Linearize(bundle, pinhole_intrinsics, bounds, candidate_tf)};
+        if (candidate.cost < linearization.cost) {
+            double const cost_change{linearization.cost - candidate.cost};
+            bool const small_cost_change{cost_change <= function_tolerance * linearization.cost};
+
+            tf = candidate_tf;
+            linearization = candidate;
+            lambda = std::max(lambda / 10, 1e-16);
+
+            if (small_cost_change or small_step) {
+                return PoseWithCost{tf, linearization.cost};
+            }
+        } else if (small_step) {
+            // NOTE(Jack): Close to a perfect solution the cost difference can be lost in rounding errors, in which case
+            // a rejected tiny step also means we are done.
+            return PoseWithCost{tf, linearization.cost};
+        } else {
+            lambda *= 10;
+        }
+    }
+
+    return std::nullopt;  // LCOV_EXCL_LINE
+}
+
+}  // namespace reprojection::pnp
\ No newline at end of file
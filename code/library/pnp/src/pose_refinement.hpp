@@ -0,0 +1,21 @@
+#pragma once
+
+#include <optional>
+
+#include "pnp/pnp.hpp"
+#include "types/algorithm_types.hpp"
+#include "types/calibration_types.hpp"
+#include "types/eigen_types.hpp"
+
+namespace reprojection::pnp {
+
+// NOTE(Jack): Refines the pose of a pinhole camera with fixed intrinsics {f, cx, cy}. It minimizes exactly the same
+// cost as the ceres bundle adjustment with constant intrinsics (Huber loss with scale one, a constant residual of 256
+// for points that do not project), so the returned cost is comparable to the ceres final_cost. The difference is that
+// the problem is only six dimensional, so we can solve it with a hand written Levenberg-Marquardt on fixed size stack
+// matrices instead of building a ceres problem per frame. The only heap allocations are the ones the caller made for
+// the bundle. Returns nullopt if the optimization did not converge.
+std::optional<PoseWithCost> RefinePose(Bundle const& bundle, Array3d const& pinhole_intrinsics,
+                                       ImageBounds const& bounds, Isometry3d const& tf_co_w);
+
+}  // namespace reprojection::pnp
\ No newline at end of file
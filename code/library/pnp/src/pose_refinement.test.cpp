@@ -0,0 +1,88 @@
+#include "pose_refinement.hpp"
+
+#include <gtest/gtest.h>
+
+#include "geometry/lie.hpp"
+#include "optimization/bundle_adjustment.hpp"
+#include "testing_mocks/data_generators.hpp"
+#include "testing_utilities/constants.hpp"
+
+using namespace reprojection;
+
+namespace {
+
+Isometry3d Perturb(Isometry3d const& tf) {
+    Vector6d const delta{0.02, -0.01, 0.03, 0.05, -0.02, 0.01};
+
+    return geometry::Exp(delta) * tf;
+}
+
+}  // namespace
+
+TEST(PnpPoseRefinement, TestRefinePose) {
+    CameraInfo const sensor{CameraModel::Pinhole, testing_utilities::image_bounds};
+    auto const [targets, gt_frames]{
+        testing_mocks::GenerateMvgData(sensor, CameraState{testing_utilities::pinhole_intrinsics}, 60, 1, false)};
+
+    for (auto const& [timestamp_ns, target_i] : targets) {
+        Isometry3d const gt_tf_co_w{geometry::Exp(gt_frames.at(timestamp_ns).pose)};
+
+        auto const result{pnp::RefinePose(target_i.bundle, testing_utilities::pinhole_intrinsics,
+                                          testing_utilities::image_bounds, Perturb(gt_tf_co_w))};
+        ASSERT_TRUE(result.has_value());
+        auto const [tf_co_w, cost]{*result};
+
+        EXPECT_TRUE(tf_co_w.isApprox(gt_tf_co_w)) << "Result:\n"
+                                                  << tf_co_w.matrix() << "\nexpected result:\n"
+                                                  << gt_tf_co_w.matrix();
+        EXPECT_NEAR(cost, 0.0, 1e-15);
+    }
+}
+
+// The fixed size refinement should find the same optimum and report the same cost as the ceres bundle adjustment,
+// including the huber loss, when the pixels are noisy and some of them are outliers.
+TEST(PnpPoseRefinement, TestSameAsCeres) {
+    CameraInfo const sensor{CameraModel::Pinhole, testing_utilities::image_bounds};
+    auto const [targets, gt_frames]{
+        testing_mocks::GenerateMvgData(sensor, CameraState{testing_utilities::pinhole_intrinsics}, 10, 1, false)};
+
+    for (auto const& [timestamp_ns, target_i] : targets) {
+        Bundle noisy_bundle{target_i.bundle};
+        for (Eigen::Index i{0}; i < noisy_bundle.pixels.rows(); ++i) {
+            double const noise{i % 5 == 0 ? 5.0 : 0.3};
+            noisy_bundle.pixels(i, 0) += i % 2 == 0 ? noise : -noise;
+            noisy_bundle.pixels(i, 1) += i % 3 == 0 ? -noise : noise;
+        }
+        Isometry3d const initial_tf_co_w{Perturb(geometry::Exp(gt_frames.at(timestamp_ns).pose))};
+
+        auto const result{pnp::RefinePose(noisy_bundle, testing_utilities::pinhole_intrinsics,
+                                          testing_utilities::image_bounds, initial_tf_co_w)};
+        ASSERT_TRUE(result.has_value());
+        auto const [tf_co_w, cost]{*result};
+
+        OptimizationState const initial_state{CameraState{testing_utilities::pinhole_intrinsics},
+                                              {{timestamp_ns, {geometry::Log(initial_tf_co_w)}}}};
+        auto const [ceres_state, diagnostics]{optimization::BundleAdjustment(
+            sensor, {{timestamp_ns, {noisy_bundle, {}}}}, initial_state, 1, true)};
+        Isometry3d const ceres_tf_co_w{geometry::Exp(ceres_state.frames.at(timestamp_ns).pose)};
+
+        EXPECT_TRUE(tf_co_w.isApprox(ceres_tf_co_w, 1e-4)) << "Result:\n"
+                                                           << tf_co_w.matrix() << "\nexpected result:\n"
+                                                           << ceres_tf_co_w.matrix();
+        EXPECT_NEAR(cost, diagnostics.solver_summary.final_cost, 1e-5 * diagnostics.solver_summary.final_cost);
+    }
+}
+
+TEST(PnpPoseRefinement, TestPointsBehindCamera) {
+    // All points are behind the camera, so every residual is the constant invalid residual and there is nothing to
+    // optimize. The refinement still converges, the cost just reflects that no point projected.
+    Bundle const bundle{MatrixX2d::Zero(10, 2), MatrixX3d::Constant(10, 3, -1)};
+
+    auto const result{pnp::RefinePose(bundle, testing_utilities::unit_pinhole_intrinsics,
+                                      testing_utilities::unit_image_bounds, Isometry3d::Identity())};
+    ASSERT_TRUE(result.has_value());
+    auto const [tf_co_w, cost]{*result};
+
+    EXPECT_TRUE(tf_co_w.isApprox(Isometry3d::Identity()));
+    EXPECT_NEAR(cost, 10 * 0.5 * ((2 * 256 * std::sqrt(2)) - 1), 1e-9);
+}
\ No newline at end of file
@@ -50,6 +50,45 @@ TEST(Pnp, TestPnpFlat) {
     }
 }
 
+TEST(Pnp, TestPnpCeresRefinement) {
+    CameraInfo const sensor{CameraModel::Pinhole, testing_utilities::image_bounds};
+    auto const [targets, gt_frames]{
+        testing_mocks::GenerateMvgData(sensor, CameraState{testing_utilities::pinhole_intrinsics}, 10, 1, false)};
+
+    for (auto const& [timestamp_ns, target_i] : targets) {
+        pnp::PnpResult const pnp_result{pnp::Pnp(target_i.bundle, sensor.bounds, pnp::PnpRefinement::Ceres)};
+        ASSERT_TRUE(std::holds_alternative<pnp::PoseWithCost>(pnp_result));
+
+        auto const [tf_co_w, cost]{std::get<pnp::PoseWithCost>(pnp_result)};
+        EXPECT_TRUE(tf_co_w.isApprox(geometry::Exp(gt_frames.at(timestamp_ns).pose)));
+        EXPECT_NEAR(cost, 0.0, 1e-15);
+    }
+}
+
+TEST(Pnp, TestSeededPnp) {
+    CameraInfo const sensor{CameraModel::Pinhole, testing_utilities::unit_image_bounds};
+    auto const [targets, gt_frames]{
+        testing_mocks::GenerateMvgData(sensor, CameraState{testing_utilities::unit_pinhole_intrinsics}, 10, 1, true)};
+
+    Vector6d const perturbation{0.01, -0.02, 0.01, 0.03, 0.02, -0.05};
+    for (auto const& [timestamp_ns, target_i] : targets) {
+        Isometry3d const gt_tf_co_w{geometry::Exp(gt_frames.at(timestamp_ns).pose)};
+
+        pnp::PnpResult const pnp_result{pnp::SeededPnp(target_i.bundle, geometry::Exp(perturbation) * gt_tf_co_w)};
+        ASSERT_TRUE(std::holds_alternative<pnp::PoseWithCost>(pnp_result));
+
+        auto const [tf_co_w, cost]{std::get<pnp::PoseWithCost>(pnp_result)};
+        EXPECT_TRUE(tf_co_w.isApprox(gt_tf_co_w, 1e-9));
+        EXPECT_NEAR(cost, 0.0, 1e-15);
+    }
+
+    MatrixX2d const four_pixels(4, 2);
+    MatrixX3d const four_points(4, 3);
+    pnp::PnpResult const pnp_result{pnp::SeededPnp({four_pixels, four_points}, Isometry3d::Identity())};
+    ASSERT_TRUE(std::holds_alternative<pnp::PnpErrorCode>(pnp_result));
+    EXPECT_EQ(std::get<pnp::PnpErrorCode>(pnp_result), pnp::PnpErrorCode::InvalidDlt);
+}
+
 TEST(Pnp, TestNotEnoughPoints) {
     MatrixX2d const five_pixels(5, 2);
     MatrixX3d const five_points(5, 3);
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "spline/se3_spline.hpp"
+
+namespace reprojection::spline {
+
+// NOTE(Jack): These move a spline between knot spacings, which is what the coarse-to-fine extrinsic optimization is
+// built on. Both keep t0 and the end of the valid time range (a coarsened spline can end up to one coarse segment
+// later, because it has to cover the whole original range). Both only support uniform knots and throw
+// std::invalid_argument for a spline with non-uniform knots.
+
+/**
+ * \brief Halves the knot spacing by inserting a knot in the middle of every segment.
+ *
+ * For the r3 spline this is the exact b-spline knot insertion (subdivision), the curve does not change at all. The so3
+ * spline is cumulative, for it the same weights are applied along the geodesics between neighbouring control points,
+ * which is exact as long as the rotations between neighbouring control points commute (ex. rotation about one axis) and
+ * a close approximation otherwise. Throws std::invalid_argument if delta_t_ns is odd, because the halved knot spacing
+ * would not be a whole number of nanoseconds.
+ */
+Se3Spline UpsampleSe3Spline(Se3Spline const& spline);
+
+/**
+ * \brief Doubles the knot spacing, the control points are the least squares fit whose UpsampleSe3Spline() is closest
+ * to the input control points.
+ *
+ * Like the spline initialization the fit is linear in the so3 control points. Throws std::invalid_argument if the
+ * spline has fewer than K control points.
+ */
+Se3Spline DownsampleSe3Spline(Se3Spline const& spline);
+
+}  // namespace reprojection::spline
\ No newline at end of file
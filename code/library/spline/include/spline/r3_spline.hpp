@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include "spline/time_handler.hpp"
 #include "spline/types.hpp"
 #include "types/eigen_types.hpp"
 
@@ -12,6 +13,11 @@ namespace reprojection::spline {
 struct R3Spline {
     template <DerivativeOrder Derivative>
     static VectorKd B(double const u_i) {
+        return B<Derivative>(u_i, M_);
+    }
+
+    template <DerivativeOrder Derivative>
+    static VectorKd B(double const u_i, MatrixKd const& M) {
         static int constexpr derivative_order{static_cast<int>(Derivative)};
 
         static VectorKd const p{polynomial_coefficients_.row(derivative_order)};
@@ -19,7 +25,7 @@ struct R3Spline {
         VectorKd const t{TimePolynomial(K, u_i, derivative_order)};
         VectorKd const du{p.cwiseProduct(t)};
 
-        return M_ * du;
+        return M * du;
     }
 
     // NOTE(Jack): To be perfectly honest we passed the control points P here for the initial five months of the project
@@ -36,13 +42,27 @@ struct R3Spline {
     template <typename T, DerivativeOrder Derivative>
     static Vector3<T> Evaluate(Eigen::Ref<MatrixNK<T> const> const& P, double const u_i,
                                std::uint64_t const delta_t_ns) {
+        return Evaluate<T, Derivative>(P, u_i, M_, delta_t_ns);
+    }
+
+    // NOTE(Jack): For non-uniform knots every segment has its own blending matrix and duration, see
+    // TimeHandler::Blending().
+    template <typename T, DerivativeOrder Derivative>
+    static Vector3<T> Evaluate(Eigen::Ref<MatrixNK<T> const> const& P, double const u_i,
+                               SegmentBlending const& blending) {
+        return Evaluate<T, Derivative>(P, u_i, blending.r3, blending.delta_t_ns);
+    }
+
+    template <typename T, DerivativeOrder Derivative>
+    static Vector3<T> Evaluate(Eigen::Ref<MatrixNK<T> const> const& P, double const u_i, MatrixKd const& M,
+                               std::uint64_t const delta_t_ns) {
         static int constexpr derivative_order{static_cast<int>(Derivative)};
 
         // TODO(Jack): Is this the right place to convert from ns to s space? Is there a fundamental problem with this
         // here or do we maybe introduce some rounding error or anything like that?
         double const delta_t_s{static_cast<double>(delta_t_ns) / 1'000'000'000};
 
-        return P * B<Derivative>(u_i).template cast<T>() / std::pow(delta_t_s, derivative_order);
+        return P * B<Derivative>(u_i, M).template cast<T>() / std::pow(delta_t_s, derivative_order);
     }
 
     static inline MatrixKd const M_{BlendingMatrix(K)};
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <optional>
+#include <span>
+#include <vector>
 
 #include "spline/r3_spline.hpp"
 #include "spline/so3_spline.hpp"
@@ -26,6 +28,17 @@ class Se3Spline {
      */
     std::optional<Vector6d> Evaluate(std::uint64_t const t_ns, DerivativeOrder const derivative) const;
 
+    /**
+     * \brief Evaluate the spline at many times, the result is the same as calling Evaluate() for each of them.
+     *
+     * Consecutive times in the same segment share the so3 DeltaPhi() terms of that segment, the blending weights come
+     * from polynomials that are precomputed once per call, and contiguous chunks of the times are evaluated in parallel
+     * on the shared thread pool. The times do not need to be sorted, but only sorted times benefit from the sharing.
+     * For non-uniform knots the polynomials are rebuilt for every segment, because each segment has its own blending.
+     */
+    std::vector<std::optional<Vector6d>> EvaluateMany(std::span<std::uint64_t const> const t_ns,
+                                                      DerivativeOrder const derivative) const;
+
     /**
      * \brief A static function for evaluating the spline pose in optimization cost functions requiring autodiff
      * compatibility.
@@ -53,6 +66,22 @@ class Se3Spline {
         return pose;
     }
 
+    // NOTE(Jack): The version for non-uniform knots, where each segment has its own blending, see
+    // TimeHandler::Blending().
+    template <typename T>
+    static Array6<T> EvaluatePose(Matrix2NK<T> const& P, double const u_i, SegmentBlending const& blending) {
+        assert(0 <= u_i and u_i < 1);
+        assert(blending.delta_t_ns > 0);
+
+        constexpr auto derivative{DerivativeOrder::Null};
+
+        Array6<T> pose;
+        pose.template head<N>() = So3Spline::Evaluate<T, derivative>(P.template topRows<N>(), u_i, blending);
+        pose.template tail<N>() = R3Spline::Evaluate<T, derivative>(P.template bottomRows<N>(), u_i, blending);
+
+        return pose;
+    }
+
     Eigen::Ref<Matrix2NXd const> ControlPoints() const { return control_points_; }
 
     Eigen::Ref<Matrix2NXd> MutableControlPoints() { return control_points_; }
@@ -70,7 +99,7 @@ class Se3Spline {
 
     MatrixNXd R3() const { return control_points_.bottomRows<MatrixNXd::RowsAtCompileTime>(); }
 
-    TimeHandler GetTimeHandler() const { return time_handler_; }
+    TimeHandler const& GetTimeHandler() const { return time_handler_; }
 
    private:
     Matrix2NXd control_points_;
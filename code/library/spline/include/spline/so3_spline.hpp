@@ -1,6 +1,7 @@
 #pragma once
 
-#include "geometry/lie.hpp"
+#include "geometry/quaternion.hpp"
+#include "spline/time_handler.hpp"
 #include "spline/utilities.hpp"
 #include "types/eigen_types.hpp"
 
@@ -11,10 +12,15 @@ namespace reprojection::spline {
 // TODO(Jack): Test explicitly and make part of SoSpline static class if not used elsewhere?
 template <typename T>
 std::array<Vector3<T>, D> DeltaPhi(Eigen::Ref<MatrixNK<T> const> const& control_points) {
+    // NOTE(Jack): Every inner control point is part of two deltas, so we only Exp() each one once.
+    std::array<Quaternion<T>, K> rotations;
+    for (int j{0}; j < K; ++j) {
+        rotations[j] = geometry::ExpQuaternion<T>(control_points.col(j));
+    }
+
     std::array<Vector3<T>, D> delta_phi;
     for (int j{0}; j < D; ++j) {
-        delta_phi[j] = geometry::Log<T>(geometry::Exp<T>(control_points.col(j)).inverse() *
-                                        geometry::Exp<T>(control_points.col(j + 1)));
+        delta_phi[j] = geometry::LogQuaternion<T>(rotations[j].conjugate() * rotations[j + 1]);
     }
 
     return delta_phi;
@@ -35,6 +41,20 @@ struct So3Spline {
     template <typename T, DerivativeOrder Derivative>
     static Vector3<T> Evaluate(Eigen::Ref<MatrixNK<T> const> const& P, double const u_i,
                                std::uint64_t const delta_t_ns) {
+        return Evaluate<T, Derivative>(P, u_i, M_, delta_t_ns);
+    }
+
+    // NOTE(Jack): For non-uniform knots every segment has its own cumulative blending matrix and duration, see
+    // TimeHandler::Blending().
+    template <typename T, DerivativeOrder Derivative>
+    static Vector3<T> Evaluate(Eigen::Ref<MatrixNK<T> const> const& P, double const u_i,
+                               SegmentBlending const& blending) {
+        return Evaluate<T, Derivative>(P, u_i, blending.so3, blending.delta_t_ns);
+    }
+
+    template <typename T, DerivativeOrder Derivative>
+    static Vector3<T> Evaluate(Eigen::Ref<MatrixNK<T> const> const& P, double const u_i, MatrixKd const& M,
+                               std::uint64_t const delta_t_ns) {
         std::array<Vector3<T>, D> const delta_phis{DeltaPhi(P)};
 
         // TODO(Jack): See note in R3 spline if this is the right way to convert to seconds.
@@ -44,22 +64,33 @@ struct So3Spline {
         std::array<VectorKd, order + 1> weights;  // We use an array because the required size is known at compile time
         for (int j{0}; j <= order; ++j) {
             VectorKd const u_j{CalculateU(u_i, j)};
-            VectorKd const weight_j{M_ * u_j / std::pow(delta_t_s, j)};
+            VectorKd const weight_j{M * u_j / std::pow(delta_t_s, j)};
 
             weights[j] = weight_j;
         }
 
-        Vector3<T> rotation{P.col(0)};
-        Vector3<T> velocity{Vector3<T>::Zero()};
-        Vector3<T> acceleration{Vector3<T>::Zero()};
+        return Evaluate<T, Derivative>(P.col(0), delta_phis, weights);
+    }
 
-        for (int j{0}; j < D; ++j) {
-            VectorKd const& weight0{weights[0]};
-            Matrix3<T> const delta_R_j{geometry::Exp<T>(T(weight0[j + 1]) * delta_phis[j])};
-            rotation = geometry::Log<T>(delta_R_j * geometry::Exp<T>(rotation));
+    // NOTE(Jack): The part of the evaluation that remains once the DeltaPhi() terms of the segment and the blending
+    // weights are known. weights[j] are the cumulative blending weights of the j-th derivative, already divided by
+    // delta_t^j. This is split out so that Se3Spline::EvaluateMany() can share the DeltaPhi() terms between all
+    // evaluations in the same segment.
+    template <typename T, DerivativeOrder Derivative>
+    static Vector3<T> Evaluate(Vector3<T> const& p0, std::array<Vector3<T>, D> const& delta_phis,
+                               std::array<VectorKd, static_cast<int>(Derivative) + 1> const& weights) {
+        // NOTE(Jack): The velocity and acceleration only need the relative rotations of the segment, not the absolute
+        // rotation, therefore that is only accumulated for the null evaluation.
+        if constexpr (Derivative == DerivativeOrder::Null) {
+            return geometry::LogQuaternion<T>(Rotation<T>(p0, delta_phis, weights[0]));
+        } else if constexpr (Derivative == DerivativeOrder::First or Derivative == DerivativeOrder::Second) {
+            Vector3<T> velocity{Vector3<T>::Zero()};
+            Vector3<T> acceleration{Vector3<T>::Zero()};
 
-            if constexpr (Derivative == DerivativeOrder::First or Derivative == DerivativeOrder::Second) {
-                Matrix3<T> const inverse_delta_R_j{delta_R_j.inverse()};
+            for (int j{0}; j < D; ++j) {
+                VectorKd const& weight0{weights[0]};
+                Quaternion<T> const delta_R_j{geometry::ExpQuaternion<T>(T(weight0[j + 1]) * delta_phis[j])};
+                Matrix3<T> const inverse_delta_R_j{delta_R_j.conjugate().toRotationMatrix()};
 
                 VectorKd const& weight1{weights[1]};
                 Vector3<T> const delta_v_j{T(weight1[j + 1]) * delta_phis[j]};
@@ -71,14 +102,12 @@ struct So3Spline {
                     acceleration = delta_a_j + (inverse_delta_R_j * acceleration);
                 }
             }
-        }
 
-        if constexpr (Derivative == DerivativeOrder::Null) {
-            return rotation;
-        } else if constexpr (Derivative == DerivativeOrder::First) {
-            return velocity;
-        } else if constexpr (Derivative == DerivativeOrder::Second) {
-            return acceleration;
+            if constexpr (Derivative == DerivativeOrder::First) {
+                return velocity;
+            } else {
+                return acceleration;
+            }
         } else {
             static_assert(Derivative == DerivativeOrder::Null or Derivative == DerivativeOrder::First or
                               Derivative == DerivativeOrder::Second,
@@ -86,6 +115,33 @@ struct So3Spline {
         }
     }
 
+    // NOTE(Jack): The null evaluation without the final Log(), for callers that only use the rotation to rotate vectors
+    // (ex. RigidBodyLinearAcceleration) and would otherwise immediately Exp() the result again.
+    template <typename T>
+    static Quaternion<T> EvaluateRotation(Eigen::Ref<MatrixNK<T> const> const& P, double const u_i,
+                                          SegmentBlending const& blending) {
+        VectorKd const weight0{blending.so3 * CalculateU(u_i, 0)};
+
+        return Rotation<T>(P.col(0), DeltaPhi(P), weight0);
+    }
+
+    // NOTE(Jack): The rotation is accumulated as a quaternion and only mapped back to so3 once by the caller, see the
+    // note in geometry/quaternion.hpp.
+    template <typename T>
+    static Quaternion<T> Rotation(Vector3<T> const& p0, std::array<Vector3<T>, D> const& delta_phis,
+                                  VectorKd const& weight0) {
+        Quaternion<T> rotation{geometry::ExpQuaternion<T>(p0)};
+        for (int j{0}; j < D; ++j) {
+            rotation = geometry::ExpQuaternion<T>(T(weight0[j + 1]) * delta_phis[j]) * rotation;
+        }
+
+        return rotation;
+    }
+
+    // NOTE(Jack): Read-only access to the uniform cumulative blending matrix, ex. to compare it against the per
+    // segment blending matrices of the TimeHandler.
+    static MatrixKd const& GetBlendingMatrix() { return M_; }
+
    private:
     static inline MatrixKd const M_{CumulativeBlendingMatrix(K)};
 };
@@ -5,6 +5,7 @@
 
 #include "spline/spline_evaluation_concept.hpp"
 #include "spline/spline_state.hpp"
+#include "spline/time_handler.hpp"
 #include "spline/types.hpp"
 #include "types/eigen_types.hpp"
 
@@ -38,6 +39,21 @@ std::optional<Vector3d> EvaluateSpline(Eigen::Ref<MatrixNXd const> const& contro
 
     Eigen::Map<MatrixNKd const> const P{control_points.col(i).data(), N, K};
 
+    // NOTE(Jack): For uniform knots we skip building the SegmentBlending, the blending matrices are then the static
+    // ones of the spline models.
+    if (not time_handler.IsUniform()) {
+        SegmentBlending const blending{time_handler.Blending(i)};
+        if (derivative == DerivativeOrder::Null) {
+            return T_Model::template Evaluate<double, DerivativeOrder::Null>(P, u_i, blending);
+        } else if (derivative == DerivativeOrder::First) {
+            return T_Model::template Evaluate<double, DerivativeOrder::First>(P, u_i, blending);
+        } else if (derivative == DerivativeOrder::Second) {
+            return T_Model::template Evaluate<double, DerivativeOrder::Second>(P, u_i, blending);
+        } else {
+            throw std::runtime_error("Requested unknown derivative order from EvaluateSpline()");  // LCOV_EXCL_LINE
+        }
+    }
+
     if (derivative == DerivativeOrder::Null) {
         return T_Model::template Evaluate<double, DerivativeOrder::Null>(P, u_i, time_handler.delta_t_ns_);
     } else if (derivative == DerivativeOrder::First) {
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include "spline/time_handler.hpp"
 #include "spline/types.hpp"
 #include "types/eigen_types.hpp"
 
@@ -9,7 +10,8 @@ namespace reprojection::spline {
 
 template <typename T>
 concept CanEvaluateCubicBSplineC3 =
-    requires(Eigen::Ref<MatrixNKd const> const& P, double const u_i, std::uint64_t const delta_t_ns) {
+    requires(Eigen::Ref<MatrixNKd const> const& P, double const u_i, std::uint64_t const delta_t_ns,
+             SegmentBlending const& blending) {
         // WARN(Jack): I do not think this condition is as strict as it looks! During the transition to using Eigen::Ref
         // this did not catch when the so3 spline still had the old plain const& interface. We should investigate here
         // to make sure we are really doing this right.
@@ -24,6 +26,11 @@ concept CanEvaluateCubicBSplineC3 =
         { T::template Evaluate<double, DerivativeOrder::Null>(P, u_i, delta_t_ns) } -> std::same_as<Vector3d>;
         { T::template Evaluate<double, DerivativeOrder::First>(P, u_i, delta_t_ns) } -> std::same_as<Vector3d>;
         { T::template Evaluate<double, DerivativeOrder::Second>(P, u_i, delta_t_ns) } -> std::same_as<Vector3d>;
+
+        // Non-uniform knots
+        { T::template Evaluate<double, DerivativeOrder::Null>(P, u_i, blending) } -> std::same_as<Vector3d>;
+        { T::template Evaluate<double, DerivativeOrder::First>(P, u_i, blending) } -> std::same_as<Vector3d>;
+        { T::template Evaluate<double, DerivativeOrder::Second>(P, u_i, blending) } -> std::same_as<Vector3d>;
     };
 
 }  // namespace reprojection::spline
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "spline/spline_state.hpp"
+#include "spline/time_handler.hpp"
 #include "types/calibration_types.hpp"
 
 namespace reprojection::spline {
@@ -9,6 +13,24 @@ namespace reprojection::spline {
 //  pure spline logic. Or maybe even in the optimization package?
 std::pair<Matrix2NXd, TimeHandler> InitializeSe3SplineState(Frames const& frames, int const frequency);
 
+// NOTE(Jack): Initializes a spline with the given non-uniform knots (see TimeHandler). The first and last knot must be
+// the timestamps of the first and last frame, otherwise std::invalid_argument is thrown.
+std::pair<Matrix2NXd, TimeHandler> InitializeSe3SplineState(Frames const& frames,
+                                                            std::vector<std::uint64_t> const& knots_ns);
+
+/**
+ * \brief Places non-uniform knots so that their density follows the motion of the frames.
+ *
+ * The angular velocity and the linear acceleration are estimated from finite differences of the frame poses. Each of
+ * them is normalized by its 90th percentile, the larger of the two (clamped to one) interpolates the knot frequency
+ * between min_frequency_hz (no motion) and max_frequency_hz (fast motion), and the knots are then spaced so that every
+ * segment covers the same integral of that frequency. The first and last knot are the first and last frame timestamp.
+ *
+ * Throws std::invalid_argument if there are fewer than three frames or if not 0 < min_frequency_hz <= max_frequency_hz.
+ */
+std::vector<std::uint64_t> AdaptiveKnots(Frames const& frames, double const min_frequency_hz,
+                                         double const max_frequency_hz);
+
 // NOTE(Jack): This was originally intended just for the internal spline interpolation code. But it turns out we also
 // need the minimum energy constraint when we are doing the extrinsic optimization itself, otherwise the imu data camera
 // frames will get completely out of sync.
@@ -17,4 +39,7 @@ std::pair<Matrix2NXd, TimeHandler> InitializeSe3SplineState(Frames const& frames
 //      "For smoothing splines, using a stiffer material corresponds to increasing lambda"
 CoefficientBlock BuildOmega(std::uint64_t const delta_t_ns, double const lambda);
 
+// Version for one segment of a spline with non-uniform knots, see TimeHandler::Blending().
+CoefficientBlock BuildOmega(SegmentBlending const& blending, double const lambda);
+
 }  // namespace reprojection::spline
\ No newline at end of file
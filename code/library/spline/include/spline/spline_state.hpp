@@ -26,7 +26,7 @@ struct CubicBSplineC3 {
 
     Eigen::Ref<MatrixNXd> MutableControlPoints() { return control_points_; }
 
-    TimeHandler GetTimeHandler() const { return time_handler_; }
+    TimeHandler const& GetTimeHandler() const { return time_handler_; }
 
     // TODO(Jack): Can remove?
     std::optional<std::pair<double, int>> Position(std::uint64_t const t_ns) const {
@@ -1,17 +1,38 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
+#include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
+
+#include "spline/types.hpp"
 
 // https://math.stackexchange.com/questions/2599669/find-control-points-to-produce-a-given-curve
 
 namespace reprojection::spline {
 
+// NOTE(Jack): Everything the evaluation of one spline segment needs to know about the time. For uniform knots this is
+// the same for all segments (R3Spline::M_, So3Spline::GetBlendingMatrix() and delta_t_ns_), for non-uniform knots the
+// blending matrices depend on the spacing of the knots around the segment and the duration is the duration of that one
+// segment.
+struct SegmentBlending {
+    MatrixKd r3;
+    MatrixKd so3;  // Cumulative blending matrix
+    std::uint64_t delta_t_ns;
+};
+
 class TimeHandler {
    public:
     TimeHandler(std::uint64_t const t0_ns, std::uint64_t const delta_t_ns);
 
+    // NOTE(Jack): Non-uniform knots. knots_ns are the start times of all segments followed by the end time of the last
+    // segment, they must be strictly increasing. For the knots which are needed at the ends of the spline but lie
+    // outside of this range we repeat the spacing of the first/last segment. To keep the code that only wants to report
+    // or hash the timing working, t0_ns_ is set to the first knot and delta_t_ns_ to the mean segment duration.
+    explicit TimeHandler(std::vector<std::uint64_t> knots_ns);
+
     TimeHandler();
 
     // NOTE(Jack): We do not really need this, but I am paranoid and there is one piece of the code which scares me, and
@@ -21,9 +42,19 @@ class TimeHandler {
     // I am paranoid, so I need to assert that they are the same, therefore we need to add this comparison operator :)
     bool operator==(TimeHandler const&) const = default;
 
+    bool IsUniform() const;
+
     std::optional<std::pair<double, int>> SplinePosition(std::uint64_t const t_ns,
                                                          size_t const num_control_points) const;
 
+    std::uint64_t SegmentStartNs(int const i) const;
+
+    std::uint64_t SegmentDurationNs(int const i) const;
+
+    SegmentBlending Blending(int const i) const;
+
+    static SegmentBlending UniformBlending(std::uint64_t const delta_t_ns);
+
     // Calculates what [1] calls "u" - "normalized time elapsed since start of the segment" - see the second paragraph
     // in section 4.2 Matrix Representation. In addition to the normalized segment time u we also return the segment
     // index i as this is useful information for error/bounds checking and follows the "law of useful return" principle
@@ -33,6 +64,24 @@ class TimeHandler {
 
     std::uint64_t t0_ns_;
     std::uint64_t delta_t_ns_;
+    std::vector<std::uint64_t> knots_ns_;  // Empty for uniform knots
+};
+
+// NOTE(Jack): The cost functions keep the blending of their segment for the whole optimization. All residuals in one
+// segment need the same blending, so they share one copy instead of each keeping their own (~260 bytes).
+using SharedBlending = std::shared_ptr<SegmentBlending const>;
+
+// Builds the blending of each segment only once, no matter how many measurements fall into it. For uniform knots all
+// segments share a single blending.
+class BlendingCache {
+   public:
+    explicit BlendingCache(TimeHandler const& time_handler);
+
+    SharedBlending Blending(int const i);
+
+   private:
+    TimeHandler time_handler_;
+    std::map<int, SharedBlending> blendings_;
 };
 
 }  // namespace reprojection::spline
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "spline/types.hpp"
 #include "types/eigen_types.hpp"
 
@@ -23,6 +25,13 @@ MatrixXd BlendingMatrix(int const k);
 
 MatrixXd CumulativeBlendingMatrix(int const k);
 
+MatrixXd CumulativeBlendingMatrix(MatrixXd const& blending_matrix);
+
+// The blending matrix of one segment [t_i, t_i+1) of a non-uniform cubic b-spline. It has the same layout as
+// BlendingMatrix(K), i.e. the weights of the control points p_i, ..., p_i+3 are M * [1 u u^2 u^3]^T. The knots are
+// t_i-2, ..., t_i+3 normalized so that the segment is [0, 1) (i.e. knots[2] == 0 and knots[3] == 1).
+MatrixKd NonUniformBlendingMatrix(std::array<double, 2 * D> const& knots);
+
 // Note the symbol variables n and k come directly from wikipedia and are not chosen to reflect any relation to any
 // other variable symbol in the spline library.
 int BinomialCoefficient(int const n, int const k);
@@ -2,6 +2,7 @@
 
 #include <Eigen/SparseCholesky>
 #include <ranges>
+#include <vector>
 
 #include "geometry/lie.hpp"
 #include "spline/constants.hpp"
@@ -22,8 +23,12 @@ std::pair<MatrixNXd, TimeHandler> InitializeC3SplineState(PositionMeasurements c
     uint64_t const t0_ns{std::cbegin(measurements)->first};
     uint64_t const tn_ns{std::crbegin(measurements)->first};  // Reverse iterator ("rbegin")!
     uint64_t const delta_t_ns{(tn_ns - t0_ns) / num_segments};
-    TimeHandler const time_handler{t0_ns, delta_t_ns};
 
+    return InitializeC3SplineState(measurements, TimeHandler{t0_ns, delta_t_ns}, num_segments);
+}
+
+std::pair<MatrixNXd, TimeHandler> InitializeC3SplineState(PositionMeasurements const& measurements,
+                                                          TimeHandler const& time_handler, size_t const num_segments) {
     auto const [A, b]{CubicBSplineC3Init::BuildAb(measurements, num_segments, time_handler)};
 
     // NOTE(Jack): At this time lambda here is hardcoded, it might make sense at some time in the future to parameterize
@@ -31,8 +36,18 @@ std::pair<MatrixNXd, TimeHandler> InitializeC3SplineState(PositionMeasurements c
     // hardcoded for now.
     // NOTE(Jack): The lambda that you need to use is very large, about e7/e8/e9 magnitude because we use nanoseconds
     // timestamps which results in very small values in the omega matrix otherwise.
-    CoefficientBlock const omega{BuildOmega(delta_t_ns, 1e12)};
-    Eigen::SparseMatrix<double> const Q{DiagonalSparseMatrix(omega, N, num_segments)};
+    Eigen::SparseMatrix<double> const Q{[&time_handler, num_segments]() {
+        if (time_handler.IsUniform()) {
+            CoefficientBlock const omega{BuildOmega(time_handler.delta_t_ns_, 1e12)};
+            return DiagonalSparseMatrix(omega, N, num_segments);
+        }
+
+        std::vector<MatrixXd> omegas;
+        for (size_t i{0}; i < num_segments; ++i) {
+            omegas.push_back(BuildOmega(time_handler.Blending(i), 1e12));
+        }
+        return DiagonalSparseMatrix(omegas, N);
+    }()};
 
     // NOTE(Jack): When we first tried to apply this to larger spline initialization problems (ex. 2000 segments) it was
     // slow as hell and took about 55 seconds on my laptop to initialize the rotation and translation. But then I used a
@@ -80,6 +95,8 @@ std::pair<MatrixXd, VectorXd> CubicBSplineC3Init::BuildAb(PositionMeasurements c
 
     MatrixXd A{MatrixXd::Zero(measurement_dim, control_point_dim)};
 
+    std::uint64_t const last_segment_ns{time_handler.SegmentDurationNs(num_segments - 1)};
+
     for (size_t j{0}; auto timestamp_ns : positions | std::views::keys) {
         // ERROR(Jack): HACK - At this time we have no principled strategy to deal with the end conditions of the
         // spline, therefore we need this hack here. What this hack does is ensure that at the very end of the spline,
@@ -87,7 +104,7 @@ std::pair<MatrixXd, VectorXd> CubicBSplineC3Init::BuildAb(PositionMeasurements c
         // past the end of the spline, but instead stays on the last valid segment at the very end (ex. u_i=0.99999).
         // This is definitely a hack, but it "works"!
         if (j == std::size(positions) - 1) {
-            timestamp_ns -= static_cast<std::uint64_t>(1 + 0.01 * time_handler.delta_t_ns_);
+            timestamp_ns -= static_cast<std::uint64_t>(1 + 0.01 * last_segment_ns);
         }
 
         // WARN(Jack): Unprotected optional access! Technically we should always been in a valid time segment because
@@ -95,7 +112,8 @@ std::pair<MatrixXd, VectorXd> CubicBSplineC3Init::BuildAb(PositionMeasurements c
         // combination with the hack described above, we should not get problems here. However, in reality this shows
         // that maybe we are not describing or capturing the problem well. A better solution here is welcome!
         auto const [u_i, i]{time_handler.SplinePosition(timestamp_ns, num_control_points).value()};
-        A.block(j * N, i * N, N, KxN) = BlockifyWeights(u_i);
+        A.block(j * N, i * N, N, KxN) =
+            time_handler.IsUniform() ? BlockifyWeights(u_i) : BlockifyWeights(u_i, time_handler.Blending(i).r3);
 
         j += 1;
     }
@@ -112,11 +130,16 @@ std::pair<MatrixXd, VectorXd> CubicBSplineC3Init::BuildAb(PositionMeasurements c
 }
 
 CubicBSplineC3Init::ControlPointBlock CubicBSplineC3Init::BlockifyWeights(double const u_i) {
+    return BlockifyWeights(u_i, R3Spline::M_);
+}
+
+CubicBSplineC3Init::ControlPointBlock CubicBSplineC3Init::BlockifyWeights(double const u_i,
+                                                                          MatrixKd const& blending_matrix) {
     // WARN(Jack): We use R3Spline::B<> even for the so3 spline interpolation! This is somehow inconsistent because the
     // so3 spline is a cumulative spline and has a different basis matrix than the R3 spline. During testing of the
     // interpolation on the spline trajectory it seemed to work regardless, but maybe there is an error here anyway that
     // will come out in edge cases!
-    VectorKd const weights_i{R3Spline::B<DerivativeOrder::Null>(u_i)};
+    VectorKd const weights_i{R3Spline::B<DerivativeOrder::Null>(u_i, blending_matrix)};
 
     ControlPointBlock sparse_weights{ControlPointBlock::Zero()};
     for (int i{0}; i < K; ++i) {
@@ -28,6 +28,11 @@ namespace reprojection::spline {
 std::pair<MatrixNXd, TimeHandler> InitializeC3SplineState(PositionMeasurements const& measurements,
                                                           size_t const num_segments);
 
+// NOTE(Jack): Version with a given time handler, which is how non-uniform knots get initialized. The time handler must
+// start at the first measurement and num_segments must end at the last measurement.
+std::pair<MatrixNXd, TimeHandler> InitializeC3SplineState(PositionMeasurements const& measurements,
+                                                          TimeHandler const& time_handler, size_t const num_segments);
+
 // TODO(Jack): Do we really need this static class for the initialization? Maybe it helped organize things when we also
 // had the omega smoothing logic here, but now that is part of the public interface this struct does not help us
 // organize anything much better.
@@ -46,6 +51,8 @@ struct CubicBSplineC3Init {
     // TODO(Jack): Is weights really the right term here? We are blockifying the entire b vector which combines both the
     //  basis matrix contribution and the time weighting.
     static ControlPointBlock BlockifyWeights(double const u_i);
+
+    static ControlPointBlock BlockifyWeights(double const u_i, MatrixKd const& blending_matrix);
 };
 
 // TODO(Jack): Move all the functions that only have to do with the smoothing omega somewhere else?
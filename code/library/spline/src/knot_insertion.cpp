@@ -0,0 +1,134 @@
+#include "spline/knot_insertion.hpp"
+
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/lie.hpp"
+#include "spline/types.hpp"
+#include "types/eigen_types.hpp"
+
+namespace reprojection::spline {
+
+namespace {
+
+// NOTE(Jack): Halving the knot spacing of a uniform cubic b-spline replaces every control point j by a "vertex" point
+// (p_j-1 + 6 p_j + p_j+1) / 8 at its own knot, and adds an "edge" point (p_j + p_j+1) / 2 between each pair of
+// neighbours. The first and last control points only have one neighbour, they get no vertex point, which is why n
+// control points become 2n - 3 and the valid time range stays exactly the same.
+int UpsampledSize(int const num_control_points) { return 2 * num_control_points - 3; }
+
+MatrixNXd UpsampleR3ControlPoints(Eigen::Ref<MatrixNXd const> const& P) {
+    MatrixNXd Q{N, UpsampledSize(P.cols())};
+    for (int j{0}; j + 1 < P.cols(); ++j) {
+        Q.col(2 * j) = (P.col(j) + P.col(j + 1)) / 2;
+        if (j > 0) {
+            Q.col(2 * j - 1) = (P.col(j - 1) + 6 * P.col(j) + P.col(j + 1)) / 8;
+        }
+    }
+
+    return Q;
+}
+
+// NOTE(Jack): The same weights as in UpsampleR3ControlPoints(), but applied to the deltas Log(R_j^-1 * R_k) to the
+// neighbours, which are the same deltas that DeltaPhi() builds the cumulative so3 spline from.
+// WARN(Jack): So3Spline::Evaluate() applies these deltas from the left onto the first control point of the segment,
+// which only lines up with the control points at the knots if neighbouring rotations commute. There is therefore no
+// knot insertion that is exact for every so3 spline, this one is exact for the commuting case and a close
+// approximation for the smooth rotations a real trajectory has between neighbouring knots.
+MatrixNXd UpsampleSo3ControlPoints(Eigen::Ref<MatrixNXd const> const& P) {
+    auto const delta{[&P](int const j, int const k) -> Vector3d {
+        Vector3d const p_j{P.col(j)};
+        Vector3d const p_k{P.col(k)};
+
+        return geometry::Log<double>(geometry::Exp<double>(p_j).transpose() * geometry::Exp<double>(p_k));
+    }};
+    auto const step{[&P](int const j, Vector3d const& delta_j) -> Vector3d {
+        Vector3d const p_j{P.col(j)};
+
+        return geometry::Log<double>(geometry::Exp<double>(p_j) * geometry::Exp<double>(delta_j));
+    }};
+
+    MatrixNXd Q{N, UpsampledSize(P.cols())};
+    for (int j{0}; j + 1 < P.cols(); ++j) {
+        Q.col(2 * j) = step(j, delta(j, j + 1) / 2);
+        if (j > 0) {
+            Q.col(2 * j - 1) = step(j, (delta(j, j - 1) + delta(j, j + 1)) / 8);
+        }
+    }
+
+    return Q;
+}
+
+// The linear map from the coarse control points to the first num_fine rows of their upsampled control points.
+Eigen::SparseMatrix<double> UpsamplingMatrix(int const num_fine, int const num_coarse) {
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int j{0}; j + 1 < num_coarse; ++j) {
+        if (2 * j < num_fine) {
+            triplets.emplace_back(2 * j, j, 0.5);
+            triplets.emplace_back(2 * j, j + 1, 0.5);
+        }
+        if (j > 0 and 2 * j - 1 < num_fine) {
+            triplets.emplace_back(2 * j - 1, j - 1, 0.125);
+            triplets.emplace_back(2 * j - 1, j, 0.75);
+            triplets.emplace_back(2 * j - 1, j + 1, 0.125);
+        }
+    }
+
+    Eigen::SparseMatrix<double> S{num_fine, num_coarse};
+    S.setFromTriplets(std::cbegin(triplets), std::cend(triplets));
+
+    return S;
+}
+
+}  // namespace
+
+Se3Spline UpsampleSe3Spline(Se3Spline const& spline) {
+    TimeHandler const& time_handler{spline.GetTimeHandler()};
+    if (not time_handler.IsUniform()) {
+        throw std::invalid_argument("Cannot upsample a spline with non-uniform knots.");
+    } else if (time_handler.delta_t_ns_ % 2 != 0) {
+        throw std::invalid_argument("Cannot upsample a spline with an odd delta_t_ns.");
+    }
+
+    Matrix2NXd control_points{2 * N, UpsampledSize(spline.Size())};
+    control_points.topRows<N>() = UpsampleSo3ControlPoints(spline.So3());
+    control_points.bottomRows<N>() = UpsampleR3ControlPoints(spline.R3());
+
+    return Se3Spline{control_points, TimeHandler{time_handler.t0_ns_, time_handler.delta_t_ns_ / 2}};
+}
+
+Se3Spline DownsampleSe3Spline(Se3Spline const& spline) {
+    if (not spline.GetTimeHandler().IsUniform()) {
+        throw std::invalid_argument("Cannot downsample a spline with non-uniform knots.");
+    } else if (spline.Size() < K) {
+        throw std::invalid_argument("Cannot downsample a spline with fewer than K control points.");
+    }
+
+    // NOTE(Jack): Rounding the number of segments up means that the coarse spline covers the whole fine spline, the
+    // upsampling matrix then has at least as many columns as the fine spline has rows, and it has full column rank.
+    int const num_fine_segments{spline.Size() - D};
+    int const num_coarse{(num_fine_segments + 1) / 2 + D};
+    Eigen::SparseMatrix<double> const S{UpsamplingMatrix(spline.Size(), num_coarse)};
+
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+    solver.compute(Eigen::SparseMatrix<double>(S.transpose() * S));
+    if (solver.info() != Eigen::Success) {
+        throw std::runtime_error("Failed: solver.compute(S^T * S);");  // LCOV_EXCL_LINE
+    }
+
+    MatrixXd const fine_control_points{spline.ControlPoints().transpose()};
+    MatrixXd const coarse_control_points{solver.solve(S.transpose() * fine_control_points)};
+    if (solver.info() != Eigen::Success) {
+        throw std::runtime_error("Failed: solver.solve(S^T * P);");  // LCOV_EXCL_LINE
+    }
+
+    TimeHandler const& time_handler{spline.GetTimeHandler()};
+
+    return Se3Spline{Matrix2NXd{coarse_control_points.transpose()},
+                     TimeHandler{time_handler.t0_ns_, 2 * time_handler.delta_t_ns_}};
+}
+
+}  // namespace reprojection::spline
\ No newline at end of file
@@ -1,12 +1,87 @@
 #include "spline/se3_spline.hpp"
 
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include "concurrency/thread_budget.hpp"
 #include "geometry/lie.hpp"
 #include "spline/r3_spline.hpp"
 #include "spline/so3_spline.hpp"
 #include "spline/spline_evaluation.hpp"
+#include "spline/utilities.hpp"
 
 namespace reprojection::spline {
 
+namespace {
+
+// NOTE(Jack): CalculateU() returns the j-th derivative of [1 u u^2 u^3], which is a linear map of the plain powers of
+// u. Folding that map, the blending matrix and the 1/delta_t^j of the derivative into one matrix per derivative order
+// means a weight vector costs one 4x4 matrix vector product, without any std::pow() or dynamic allocation.
+struct WeightPolynomials {
+    explicit WeightPolynomials(SegmentBlending const& blending) {
+        static MatrixKd const polynomial_coefficients{PolynomialCoefficients(K)};
+        double const delta_t_s{static_cast<double>(blending.delta_t_ns) / 1'000'000'000};
+
+        double scale{1};
+        for (int j{0}; j < std::ssize(so3); ++j) {
+            MatrixKd derivative_map{MatrixKd::Zero()};
+            for (int i{j}; i < K; ++i) {
+                derivative_map(i, i - j) = polynomial_coefficients(j, i);
+            }
+
+            so3[j] = blending.so3 * derivative_map / scale;
+            r3[j] = blending.r3 * derivative_map / scale;
+            scale *= delta_t_s;
+        }
+    }
+
+    std::array<MatrixKd, 3> so3;
+    std::array<MatrixKd, 3> r3;
+};
+
+template <DerivativeOrder Derivative>
+void EvaluateChunk(Matrix2NXd const& control_points, TimeHandler const& time_handler,
+                   WeightPolynomials const& uniform_polynomials, std::span<std::uint64_t const> const t_ns,
+                   std::span<std::optional<Vector6d>> const result) {
+    int constexpr order{static_cast<int>(Derivative)};
+
+    int cached_segment{-1};
+    std::array<Vector3d, D> delta_phis;
+    std::optional<WeightPolynomials> segment_polynomials;
+    for (std::size_t k{0}; k < std::size(t_ns); ++k) {
+        auto const normalized_position{time_handler.SplinePosition(t_ns[k], control_points.cols())};
+        if (not normalized_position.has_value()) {
+            result[k] = std::nullopt;
+            continue;
+        }
+        auto const [u_i, i]{normalized_position.value()};
+
+        Eigen::Map<Matrix2NK<double> const> const P{control_points.col(i).data()};
+        if (i != cached_segment) {
+            delta_phis = DeltaPhi<double>(P.topRows<N>());
+            if (not time_handler.IsUniform()) {
+                segment_polynomials.emplace(time_handler.Blending(i));
+            }
+            cached_segment = i;
+        }
+        WeightPolynomials const& polynomials{segment_polynomials ? *segment_polynomials : uniform_polynomials};
+
+        VectorKd const u_powers{1, u_i, u_i * u_i, u_i * u_i * u_i};
+        std::array<VectorKd, order + 1> weights;
+        for (int j{0}; j <= order; ++j) {
+            weights[j] = polynomials.so3[j] * u_powers;
+        }
+
+        Vector6d value;
+        value.head<N>() = So3Spline::Evaluate<double, Derivative>(P.col(0).head<N>(), delta_phis, weights);
+        value.tail<N>() = P.bottomRows<N>() * (polynomials.r3[order] * u_powers);
+        result[k] = value;
+    }
+}
+
+}  // namespace
+
 Se3Spline::Se3Spline(Eigen::Ref<Matrix2NXd const> const& control_points, TimeHandler const& time_handler)
     : control_points_{control_points}, time_handler_{time_handler} {}
 
@@ -30,4 +105,42 @@ std::optional<Vector6d> Se3Spline::Evaluate(std::uint64_t const t_ns, Derivative
     return result;
 }
 
-}  // namespace reprojection::spline
+std::vector<std::optional<Vector6d>> Se3Spline::EvaluateMany(std::span<std::uint64_t const> const t_ns,
+                                                             DerivativeOrder const derivative) const {
+    // NOTE(Jack): Below this many evaluations per chunk the task overhead of the thread pool is not worth it.
+    int constexpr min_chunk_size{256};
+
+    std::vector<std::optional<Vector6d>> result(std::size(t_ns));
+    if (t_ns.empty()) {
+        return result;
+    }
+
+    WeightPolynomials const polynomials{TimeHandler::UniformBlending(time_handler_.delta_t_ns_)};
+    int const num_chunks{std::clamp(static_cast<int>(std::ssize(t_ns) / min_chunk_size), 1,
+                                    concurrency::ThreadLimit())};
+    std::size_t const chunk_size{(std::size(t_ns) + num_chunks - 1) / num_chunks};
+
+    concurrency::SharedThreadPool().ParallelFor(num_chunks, [&](int const chunk) {
+        std::size_t const begin{chunk * chunk_size};
+        std::size_t const size{std::min(chunk_size, std::size(t_ns) - begin)};
+        auto const chunk_t_ns{t_ns.subspan(begin, size)};
+        auto const chunk_result{std::span{result}.subspan(begin, size)};
+
+        if (derivative == DerivativeOrder::Null) {
+            EvaluateChunk<DerivativeOrder::Null>(control_points_, time_handler_, polynomials, chunk_t_ns,
+                                                 chunk_result);
+        } else if (derivative == DerivativeOrder::First) {
+            EvaluateChunk<DerivativeOrder::First>(control_points_, time_handler_, polynomials, chunk_t_ns,
+                                                  chunk_result);
+        } else if (derivative == DerivativeOrder::Second) {
+            EvaluateChunk<DerivativeOrder::Second>(control_points_, time_handler_, polynomials, chunk_t_ns,
+                                                   chunk_result);
+        } else {
+            throw std::runtime_error("Requested unknown derivative order from EvaluateMany()");  // LCOV_EXCL_LINE
+        }
+    });
+
+    return result;
+}
+
+}  // namespace reprojection::spline
\ No newline at end of file
@@ -28,4 +28,35 @@ Eigen::SparseMatrix<double> DiagonalSparseMatrix(MatrixXd const& block, size_t c
     return mat;
 }
 
+Eigen::SparseMatrix<double> DiagonalSparseMatrix(std::vector<MatrixXd> const& blocks, size_t const stride) {
+    if (blocks.empty()) {
+        throw std::runtime_error("Requires at least one block");
+    }
+
+    Eigen::Index const block_size{blocks[0].rows()};
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(block_size * block_size * std::size(blocks));
+
+    for (size_t n{0}; n < std::size(blocks); n++) {
+        MatrixXd const& block{blocks[n]};
+        if (not(block.rows() == block_size and block.cols() == block_size)) {
+            throw std::runtime_error("Only accepts square blocks of the same size");
+        }
+
+        size_t const start_index{n * stride};
+        for (Eigen::Index row{0}; row < block.rows(); row++) {
+            for (Eigen::Index col{0}; col < block.cols(); col++) {
+                triplets.push_back(
+                    {static_cast<int>(start_index + row), static_cast<int>(start_index + col), block(row, col)});
+            }
+        }
+    }
+
+    size_t const size{(block_size * std::size(blocks)) + (stride - block_size) * (std::size(blocks) - 1)};
+    Eigen::SparseMatrix<double> mat(size, size);
+    mat.setFromTriplets(std::cbegin(triplets), std::cend(triplets));
+
+    return mat;
+}
+
 }  // namespace reprojection::spline
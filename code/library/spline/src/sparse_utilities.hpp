@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/SparseCore>
+#include <vector>
 
 #include "types/eigen_types.hpp"
 
@@ -9,4 +10,7 @@ namespace reprojection::spline {
 // See section "Filling a sparse matrix" - https://libeigen.gitlab.io/eigen/docs-nightly/group__TutorialSparse.html
 Eigen::SparseMatrix<double> DiagonalSparseMatrix(MatrixXd const& block, size_t const stride, size_t const count);
 
+// Same as DiagonalSparseMatrix() but every position along the diagonal has its own block, all of the same size.
+Eigen::SparseMatrix<double> DiagonalSparseMatrix(std::vector<MatrixXd> const& blocks, size_t const stride);
+
 }  // namespace reprojection::spline
@@ -50,3 +50,24 @@ TEST(SplineSparseUtilities, TestDiagonalSparseMatrixErrorCondition) {
 
     EXPECT_THROW(spline::DiagonalSparseMatrix(non_square_block, 0, 0), std::runtime_error);
 }
+
+TEST(SplineSparseUtilities, TestDiagonalSparseMatrixPerBlock) {
+    std::vector<MatrixXd> const blocks{Matrix2d{{1, 1}, {1, 1}}, Matrix2d{{2, 2}, {2, 2}}, Matrix2d{{3, 3}, {3, 3}}};
+
+    // Partial overlap, the overlapped elements accumulate
+    auto const mat{spline::DiagonalSparseMatrix(blocks, 1)};
+    Matrix4d const gt_mat{{1, 1, 0, 0},  //
+                          {1, 3, 2, 0},
+                          {0, 2, 5, 3},
+                          {0, 0, 3, 3}};
+    EXPECT_TRUE(mat.isApprox(gt_mat)) << "Result:\n" << mat << "\nexpected result:\n" << gt_mat;
+
+    // With the same block everywhere it is the same as the single block version
+    std::vector<MatrixXd> const same_blocks(3, Matrix2d{{1, 1}, {1, 1}});
+    EXPECT_TRUE(
+        spline::DiagonalSparseMatrix(same_blocks, 1).isApprox(spline::DiagonalSparseMatrix(same_blocks[0], 1, 3)));
+
+    EXPECT_THROW(spline::DiagonalSparseMatrix(std::vector<MatrixXd>{}, 1), std::runtime_error);
+    EXPECT_THROW(spline::DiagonalSparseMatrix(std::vector<MatrixXd>{Matrix2d::Ones(), Matrix3d::Ones()}, 1),
+                 std::runtime_error);
+}
\ No newline at end of file
@@ -1,5 +1,11 @@
 #include "spline/spline_initialization.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+#include "geometry/lie.hpp"
 #include "spline/r3_spline.hpp"
 
 #include "cubic_spline_c3_init.hpp"
@@ -7,9 +13,9 @@
 
 namespace reprojection::spline {
 
-// TODO(Jack): Unit test!
-// TODO(Jack): Rename frequency to sample_rate_hz? And change type to double?
-std::pair<Matrix2NXd, TimeHandler> InitializeSe3SplineState(Frames const& frames, int const frequency) {
+namespace {
+
+std::pair<PositionMeasurements, PositionMeasurements> SplitFrames(Frames const& frames) {
     PositionMeasurements so3;
     PositionMeasurements r3;
     for (auto const& [timestamp_ns, frame_i] : frames) {
@@ -17,11 +23,13 @@ std::pair<Matrix2NXd, TimeHandler> InitializeSe3SplineState(Frames const& frames
         r3.insert({timestamp_ns, {frame_i.pose.bottomRows<N>()}});
     }
 
-    double const delta_t_s{(std::crbegin(frames)->first - std::cbegin(frames)->first) / 1e9};
-    int64_t const num_segments{static_cast<int64_t>(frequency * delta_t_s)};
+    return {so3, r3};
+}
 
-    auto const [so3_control_points, time_handler_a]{InitializeC3SplineState(so3, num_segments)};
-    auto const [r3_control_points, time_handler_b]{InitializeC3SplineState(r3, num_segments)};
+std::pair<Matrix2NXd, TimeHandler> MergeC3SplineStates(std::pair<MatrixNXd, TimeHandler> const& so3,
+                                                       std::pair<MatrixNXd, TimeHandler> const& r3) {
+    auto const& [so3_control_points, time_handler_a]{so3};
+    auto const& [r3_control_points, time_handler_b]{r3};
 
     if (time_handler_a != time_handler_b) {
         throw std::runtime_error                                                               // LCOV_EXCL_LINE
@@ -35,16 +43,144 @@ std::pair<Matrix2NXd, TimeHandler> InitializeSe3SplineState(Frames const& frames
     return {se3_control_points, time_handler_a};
 }
 
+// Normalizes the values by their 90th percentile and clamps them to [0, 1]. If the percentile is zero (ex. no motion at
+// all) everything is zero.
+std::vector<double> NormalizeByPercentile(std::vector<double> const& values) {
+    std::vector<double> sorted{values};
+    auto const percentile{std::begin(sorted) + (9 * (std::ssize(sorted) - 1)) / 10};
+    std::ranges::nth_element(sorted, percentile);
+
+    std::vector<double> normalized(std::size(values), 0.0);
+    if (*percentile > 0) {
+        double const reference{*percentile};
+        std::ranges::transform(values, std::begin(normalized),
+                               [reference](double const value) { return std::min(value / reference, 1.0); });
+    }
+
+    return normalized;
+}
+
+}  // namespace
+
+// TODO(Jack): Unit test!
+// TODO(Jack): Rename frequency to sample_rate_hz? And change type to double?
+std::pair<Matrix2NXd, TimeHandler> InitializeSe3SplineState(Frames const& frames, int const frequency) {
+    auto const [so3, r3]{SplitFrames(frames)};
+
+    double const delta_t_s{(std::crbegin(frames)->first - std::cbegin(frames)->first) / 1e9};
+    int64_t const num_segments{static_cast<int64_t>(frequency * delta_t_s)};
+
+    return MergeC3SplineStates(InitializeC3SplineState(so3, num_segments), InitializeC3SplineState(r3, num_segments));
+}
+
+std::pair<Matrix2NXd, TimeHandler> InitializeSe3SplineState(Frames const& frames,
+                                                            std::vector<std::uint64_t> const& knots_ns) {
+    if (std::size(knots_ns) < 2 or knots_ns.front() != std::cbegin(frames)->first or
+        knots_ns.back() != std::crbegin(frames)->first) {
+        throw std::invalid_argument("The knots must start at the first frame and end at the last frame.");
+    }
+
+    auto const [so3, r3]{SplitFrames(frames)};
+    TimeHandler const time_handler{knots_ns};
+    size_t const num_segments{std::size(knots_ns) - 1};
+
+    return MergeC3SplineStates(InitializeC3SplineState(so3, time_handler, num_segments),
+                               InitializeC3SplineState(r3, time_handler, num_segments));
+}
+
+std::vector<std::uint64_t> AdaptiveKnots(Frames const& frames, double const min_frequency_hz,
+                                         double const max_frequency_hz) {
+    if (std::size(frames) < 3) {
+        throw std::invalid_argument("Adaptive knot placement requires at least three frames.");
+    } else if (not(0 < min_frequency_hz and min_frequency_hz <= max_frequency_hz)) {
+        throw std::invalid_argument("Adaptive knot placement requires 0 < min_frequency_hz <= max_frequency_hz.");
+    }
+
+    std::vector<std::uint64_t> timestamps_ns;
+    std::vector<Vector6d> poses;
+    for (auto const& [timestamp_ns, frame_i] : frames) {
+        timestamps_ns.push_back(timestamp_ns);
+        poses.push_back(frame_i.pose.matrix());
+    }
+
+    // NOTE(Jack): Everything below is per interval between two consecutive frames. The angular velocity is the
+    // rotation between the two frames, the linear acceleration is estimated at each frame from the velocities of the
+    // intervals on either side of it and an interval gets the larger of the accelerations at its two ends.
+    int const num_intervals{static_cast<int>(std::ssize(timestamps_ns)) - 1};
+    std::vector<double> durations_s(num_intervals);
+    std::vector<double> angular_velocities(num_intervals);
+    std::vector<Vector3d> velocities(num_intervals);
+    for (int k{0}; k < num_intervals; ++k) {
+        durations_s[k] = (timestamps_ns[k + 1] - timestamps_ns[k]) / 1e9;
+
+        Matrix3d const R_k{geometry::Exp<double>(poses[k].topRows<N>())};
+        Matrix3d const R_k1{geometry::Exp<double>(poses[k + 1].topRows<N>())};
+        angular_velocities[k] = geometry::Log<double>(R_k.transpose() * R_k1).norm() / durations_s[k];
+        velocities[k] = (poses[k + 1].bottomRows<N>() - poses[k].bottomRows<N>()) / durations_s[k];
+    }
+
+    std::vector<double> linear_accelerations(num_intervals, 0.0);
+    for (int k{1}; k < num_intervals; ++k) {
+        double const acceleration_k{(velocities[k] - velocities[k - 1]).norm() /
+                                    ((durations_s[k - 1] + durations_s[k]) / 2)};
+        linear_accelerations[k - 1] = std::max(linear_accelerations[k - 1], acceleration_k);
+        linear_accelerations[k] = std::max(linear_accelerations[k], acceleration_k);
+    }
+
+    std::vector<double> const normalized_angular_velocities{NormalizeByPercentile(angular_velocities)};
+    std::vector<double> const normalized_linear_accelerations{NormalizeByPercentile(linear_accelerations)};
+
+    // The number of segments each interval should get, its sum is the total number of segments.
+    std::vector<double> num_interval_segments(num_intervals);
+    for (int k{0}; k < num_intervals; ++k) {
+        double const motion{std::max(normalized_angular_velocities[k], normalized_linear_accelerations[k])};
+        double const frequency_hz{min_frequency_hz + (max_frequency_hz - min_frequency_hz) * motion};
+        num_interval_segments[k] = frequency_hz * durations_s[k];
+    }
+
+    // NOTE(Jack): The total has to be a whole number of segments, we round it and scale all intervals to match.
+    double const total{std::accumulate(std::cbegin(num_interval_segments), std::cend(num_interval_segments), 0.0)};
+    int const num_segments{std::max(1, static_cast<int>(std::round(total)))};
+    double const scale{num_segments / total};
+
+    // NOTE(Jack): Knot j goes where the cumulative number of segments is j, within an interval we interpolate linearly.
+    // Rounding to whole nanoseconds could in theory produce duplicate knots, those are dropped.
+    std::vector<std::uint64_t> knots_ns{timestamps_ns.front()};
+    int next_knot{1};
+    double cumulative{0};
+    for (int k{0}; k < num_intervals; ++k) {
+        double const interval_segments{scale * num_interval_segments[k]};
+        std::uint64_t const interval_ns{timestamps_ns[k + 1] - timestamps_ns[k]};
+
+        for (; next_knot < num_segments and next_knot <= cumulative + interval_segments; ++next_knot) {
+            double const fraction{(next_knot - cumulative) / interval_segments};
+            std::uint64_t const knot_ns{timestamps_ns[k] +
+                                        static_cast<std::uint64_t>(std::round(fraction * interval_ns))};
+            if (knots_ns.back() < knot_ns and knot_ns < timestamps_ns.back()) {
+                knots_ns.push_back(knot_ns);
+            }
+        }
+        cumulative += interval_segments;
+    }
+    knots_ns.push_back(timestamps_ns.back());
+
+    return knots_ns;
+}
+
 // NOTE(Jack): Lambda could also be called "stiffness", as it constrains the spline to have minimum energy and fit the
 // points stiffly. This is critical for cases where we want to interpolate more poses than we have initial data points.
 CoefficientBlock BuildOmega(std::uint64_t const delta_t_ns, double const lambda) {
-    MatrixKd const derivative_op{DerivativeOperator(K) / delta_t_ns};
+    return BuildOmega(TimeHandler::UniformBlending(delta_t_ns), lambda);
+}
+
+CoefficientBlock BuildOmega(SegmentBlending const& blending, double const lambda) {
+    MatrixKd const derivative_op{DerivativeOperator(K) / blending.delta_t_ns};
     // NOTE(Jack): This is a hilbert matrix, but is it just coincidentally so? Or is there a better name that better
     // reflects its role in taking the matrix second derivative below?
     static MatrixKd const hilbert_matrix{HilbertMatrix(7)};
 
     // Take the second derivative
-    MatrixKd V_i{delta_t_ns * hilbert_matrix};
+    MatrixKd V_i{blending.delta_t_ns * hilbert_matrix};
     for (int i = 0; i < 2; i++) {
         V_i = derivative_op.transpose() * V_i * derivative_op;
     }
@@ -54,7 +190,7 @@ CoefficientBlock BuildOmega(std::uint64_t const delta_t_ns, double const lambda)
         V.block(i * K, i * K, K, K) = V_i;
     }
 
-    static CoefficientBlock const M{BlockifyBlendingMatrix(R3Spline::M_)};
+    CoefficientBlock const M{BlockifyBlendingMatrix(blending.r3)};
     CoefficientBlock const omega{M.transpose() * V * M};
 
     return lambda * omega;
@@ -1,11 +1,17 @@
 #include "spline/time_handler.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "spline/constants.hpp"
+#include "spline/utilities.hpp"
 
 // Prevent assertions from getting optimized out in the release build.
 #ifdef NDEBUG
@@ -15,15 +21,46 @@
 
 namespace reprojection::spline {
 
+namespace {
+
+// Knot j relative to knot i in nanoseconds. We go through a signed integer before converting to double, because the
+// absolute nanosecond timestamps are too large to be represented exactly by a double.
+double RelativeKnotNs(std::vector<std::uint64_t> const& knots_ns, int const i, int const j) {
+    auto const difference{[&knots_ns](int const a, int const b) {
+        return static_cast<double>(static_cast<std::int64_t>(knots_ns[a] - knots_ns[b]));
+    }};
+
+    int const last{static_cast<int>(std::ssize(knots_ns)) - 1};
+    if (j < 0) {
+        return difference(0, i) + j * difference(1, 0);
+    } else if (j > last) {
+        return difference(last, i) + (j - last) * difference(last, last - 1);
+    }
+
+    return difference(j, i);
+}
+
+}  // namespace
+
 // TODO(Jack): Instead of using an assertion here should we use a factory and return std::optional instead?
 TimeHandler::TimeHandler(std::uint64_t const t0_ns, std::uint64_t const delta_t_ns)
     : t0_ns_{t0_ns}, delta_t_ns_{delta_t_ns} {
     assert(delta_t_ns > 0);
 }
 
+TimeHandler::TimeHandler(std::vector<std::uint64_t> knots_ns)
+    : t0_ns_{knots_ns.empty() ? 0 : knots_ns.front()}, delta_t_ns_{1}, knots_ns_{std::move(knots_ns)} {
+    assert(std::size(knots_ns_) >= 2);
+    assert(std::ranges::adjacent_find(knots_ns_, std::greater_equal{}) == std::cend(knots_ns_));
+
+    delta_t_ns_ = (knots_ns_.back() - knots_ns_.front()) / (std::size(knots_ns_) - 1);
+}
+
 // TODO(Jack): Do we really need this? When do we need to actually construct an empty handler?
 TimeHandler::TimeHandler() : TimeHandler(0, 1) {}
 
+bool TimeHandler::IsUniform() const { return knots_ns_.empty(); }
+
 std::optional<std::pair<double, int>> TimeHandler::SplinePosition(std::uint64_t const t_ns,
                                                                   size_t const num_control_points) const {
     // TODO(Jack): Why did we never have this condition before and not have problems?
@@ -31,7 +68,21 @@ std::optional<std::pair<double, int>> TimeHandler::SplinePosition(std::uint64_t
         return std::nullopt;
     }
 
-    auto const [u_i, i]{NormalizedSegmentTime(t0_ns_, t_ns, delta_t_ns_)};
+    // NOTE(Jack): For non-uniform knots the end of the spline is given by the last knot and not only by the number of
+    // control points.
+    if (not IsUniform() and t_ns >= knots_ns_.back()) {
+        return std::nullopt;
+    }
+
+    auto const [u_i, i]{[this, t_ns]() -> std::pair<double, int> {
+        if (IsUniform()) {
+            return NormalizedSegmentTime(t0_ns_, t_ns, delta_t_ns_);
+        }
+
+        int const i{static_cast<int>(std::ranges::upper_bound(knots_ns_, t_ns) - std::cbegin(knots_ns_)) - 1};
+
+        return {static_cast<double>(t_ns - knots_ns_[i]) / SegmentDurationNs(i), i};
+    }()};
 
     // From reference [1] - "At time t in [t_i, t_i+1) the value of p(t) only depends on the control points p_i,
     // p_i+1, ..., p_i+k-1" - See the start of the second paragraph in section 4.2 Matrix Representation.
@@ -42,6 +93,65 @@ std::optional<std::pair<double, int>> TimeHandler::SplinePosition(std::uint64_t
     return std::pair{u_i, i};
 }
 
+std::uint64_t TimeHandler::SegmentStartNs(int const i) const {
+    assert(i >= 0);
+    if (IsUniform()) {
+        return t0_ns_ + i * delta_t_ns_;
+    }
+
+    assert(i < std::ssize(knots_ns_));
+    return knots_ns_[i];
+}
+
+std::uint64_t TimeHandler::SegmentDurationNs(int const i) const {
+    if (IsUniform()) {
+        return delta_t_ns_;
+    }
+
+    assert(0 <= i and i + 1 < std::ssize(knots_ns_));
+    return knots_ns_[i + 1] - knots_ns_[i];
+}
+
+SegmentBlending TimeHandler::Blending(int const i) const {
+    if (IsUniform()) {
+        return UniformBlending(delta_t_ns_);
+    }
+
+    std::uint64_t const delta_t_ns{SegmentDurationNs(i)};
+
+    // The knots t_i-2, ..., t_i+3 that the four basis functions which are non-zero on segment i depend on, normalized
+    // so that the segment itself is [0, 1).
+    std::array<double, 2 * D> knots;
+    for (int j{0}; j < 2 * D; ++j) {
+        knots[j] = RelativeKnotNs(knots_ns_, i, i - (D - 1) + j) / delta_t_ns;
+    }
+
+    MatrixKd const blending_matrix{NonUniformBlendingMatrix(knots)};
+
+    return {blending_matrix, CumulativeBlendingMatrix(blending_matrix), delta_t_ns};
+}
+
+SegmentBlending TimeHandler::UniformBlending(std::uint64_t const delta_t_ns) {
+    static MatrixKd const blending_matrix{BlendingMatrix(K)};
+    static MatrixKd const cumulative_blending_matrix{CumulativeBlendingMatrix(K)};
+
+    return {blending_matrix, cumulative_blending_matrix, delta_t_ns};
+}
+
+BlendingCache::BlendingCache(TimeHandler const& time_handler) : time_handler_{time_handler} {}
+
+SharedBlending BlendingCache::Blending(int const i) {
+    int const segment{time_handler_.IsUniform() ? 0 : i};
+    if (auto const cached{blendings_.find(segment)}; cached != std::cend(blendings_)) {
+        return cached->second;
+    }
+
+    SharedBlending const blending{std::make_shared<SegmentBlending const>(time_handler_.Blending(i))};
+    blendings_.emplace(segment, blending);
+
+    return blending;
+}
+
 std::pair<double, int> TimeHandler::NormalizedSegmentTime(std::uint64_t const t0_ns, std::uint64_t const t_ns,
                                                           std::uint64_t const delta_t_ns) {
     assert(t0_ns <= t_ns);
@@ -73,8 +73,10 @@ MatrixXd BlendingMatrix(int const k) {
     return result / Factorial(k - 1);
 }
 
-MatrixXd CumulativeBlendingMatrix(int const k) {
-    MatrixXd const blending_matrix{BlendingMatrix(k)};
+MatrixXd CumulativeBlendingMatrix(int const k) { return CumulativeBlendingMatrix(BlendingMatrix(k)); }
+
+MatrixXd CumulativeBlendingMatrix(MatrixXd const& blending_matrix) {
+    Eigen::Index const k{blending_matrix.rows()};
 
     auto result{MatrixXd::Zero(k, k).eval()};
     for (int s{0}; s < k; ++s) {
@@ -91,6 +93,42 @@ MatrixXd CumulativeBlendingMatrix(int const k) {
     return result;
 }
 
+// NOTE(Jack): We evaluate the basis functions with the Cox-de Boor recursion (algorithm A2.2 "BasisFuns" from The NURBS
+// Book) at four values of u and then recover the polynomial coefficients by inverting the Vandermonde matrix of those
+// four samples. The basis functions are cubic polynomials on the segment, so four samples determine them exactly.
+MatrixKd NonUniformBlendingMatrix(std::array<double, 2 * D> const& knots) {
+    assert(knots[D - 1] == 0 and knots[D] == 1);
+
+    MatrixKd weights;
+    MatrixKd vandermonde;
+    for (int m{0}; m < K; ++m) {
+        double const u{static_cast<double>(m) / D};
+
+        std::array<double, K> basis{1, 0, 0, 0};
+        std::array<double, K> left;
+        std::array<double, K> right;
+        for (int j{1}; j <= D; ++j) {
+            left[j] = u - knots[D - j];
+            right[j] = knots[D - 1 + j] - u;
+
+            double saved{0};
+            for (int r{0}; r < j; ++r) {
+                double const temp{basis[r] / (right[r + 1] + left[j - r])};
+                basis[r] = saved + right[r + 1] * temp;
+                saved = left[j - r] * temp;
+            }
+            basis[j] = saved;
+        }
+
+        for (int s{0}; s < K; ++s) {
+            weights(s, m) = basis[s];
+            vandermonde(s, m) = std::pow(u, s);
+        }
+    }
+
+    return weights * vandermonde.inverse();
+}
+
 // Factorial based implementation is not the fastest, but we are dealing with small values (?) so we can afford it for
 // the sake of clarity https://en.wikipedia.org/wiki/Binomial_coefficient#Computing_the_value_of_binomial_coefficients
 int BinomialCoefficient(int const n, int const k) {
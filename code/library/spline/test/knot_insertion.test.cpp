@@ -0,0 +1,70 @@
+#include "spline/knot_insertion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "spline/se3_spline.hpp"
+#include "types/eigen_types.hpp"
+
+using namespace reprojection;
+using namespace spline;
+using enum DerivativeOrder;
+
+namespace {
+
+// NOTE(Jack): All so3 control points rotate about the z-axis only, for which the so3 knot insertion is exact too.
+Se3Spline SingleAxisSpline(int const num_control_points, std::uint64_t const delta_t_ns) {
+    Matrix2NXd control_points{Matrix2NXd::Random(2 * N, num_control_points)};
+    control_points.topRows<2>().setZero();
+    control_points.row(2) *= 0.5;
+
+    return Se3Spline{control_points, {100, delta_t_ns}};
+}
+
+void ExpectSameCurve(Se3Spline const& a, Se3Spline const& b, double const tolerance) {
+    std::uint64_t const t_end_ns{a.GetTimeHandler().t0_ns_ + (a.Size() - D) * a.GetTimeHandler().delta_t_ns_};
+    for (std::uint64_t t_ns{a.GetTimeHandler().t0_ns_}; t_ns < t_end_ns; t_ns += 7'000'000) {
+        for (auto const derivative : {Null, First, Second}) {
+            auto const value_a{a.Evaluate(t_ns, derivative)};
+            auto const value_b{b.Evaluate(t_ns, derivative)};
+            ASSERT_TRUE(value_a.has_value());
+            ASSERT_TRUE(value_b.has_value());
+            EXPECT_TRUE(value_a->isApprox(*value_b, tolerance)) << "t_ns: " << t_ns;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(SplineKnotInsertion, TestUpsampleSe3Spline) {
+    Se3Spline const spline{SingleAxisSpline(10, 100'000'000)};
+
+    Se3Spline const upsampled{UpsampleSe3Spline(spline)};
+    EXPECT_EQ(upsampled.Size(), 2 * spline.Size() - D);
+    EXPECT_EQ(upsampled.GetTimeHandler(), (TimeHandler{100, 50'000'000}));
+    ExpectSameCurve(spline, upsampled, 1e-9);
+}
+
+TEST(SplineKnotInsertion, TestUpsampleSe3SplineOddDeltaT) {
+    Se3Spline const spline{SingleAxisSpline(10, 99)};
+
+    EXPECT_THROW(UpsampleSe3Spline(spline), std::invalid_argument);
+}
+
+TEST(SplineKnotInsertion, TestDownsampleSe3Spline) {
+    // An upsampled spline is exactly representable at the coarse knot spacing, so downsampling recovers the original.
+    Se3Spline const spline{SingleAxisSpline(10, 100'000'000)};
+
+    Se3Spline const downsampled{DownsampleSe3Spline(UpsampleSe3Spline(spline))};
+    EXPECT_EQ(downsampled.GetTimeHandler(), spline.GetTimeHandler());
+    EXPECT_TRUE(downsampled.ControlPoints().isApprox(spline.ControlPoints(), 1e-9));
+
+    // With an odd number of segments the coarse spline gets one segment more than needed, so it covers the whole range.
+    Se3Spline const odd_segments{SingleAxisSpline(10, 50'000'000)};
+    Se3Spline const coarse{DownsampleSe3Spline(odd_segments)};
+    EXPECT_EQ(coarse.Size(), 7);
+    EXPECT_EQ(coarse.GetTimeHandler(), (TimeHandler{100, 100'000'000}));
+
+    EXPECT_THROW(DownsampleSe3Spline(Se3Spline{Matrix2NXd::Zero(2 * N, K - 1), {100, 5}}), std::invalid_argument);
+}
\ No newline at end of file
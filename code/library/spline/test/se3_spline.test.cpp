@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include "geometry/lie.hpp"
 #include "types/eigen_types.hpp"
 
@@ -53,4 +56,87 @@ TEST(SplineSe3Spline, TestEvaluate) {
     EXPECT_FLOAT_EQ(geometry::Exp(p_0.value()).matrix().diagonal().sum(),
                     3.9593055);  // HEURISTIC! No theoretical testing strategy at this time - we have this here just so
     // that we can detect changes to the implementation quickly (hopefully. )
-}
\ No newline at end of file
+}
+
+TEST(SplineSe3Spline, TestEvaluateMany) {
+    // A spline with several segments and non-trivial rotations, so that the segment caching is actually exercised.
+    int const num_control_points{10};
+    Matrix2NXd control_points{2 * N, num_control_points};
+    for (int i{0}; i < num_control_points; ++i) {
+        double const t{0.3 * i};
+        control_points.col(i) << 0.2 * std::sin(t), 0.1 * std::cos(t), 0.05 * t, t, t * t, std::sin(t);
+    }
+    uint64_t const t0_ns{1'000};
+    uint64_t const delta_t_ns{50'000'000};
+    Se3Spline const spline{control_points, {t0_ns, delta_t_ns}};
+
+    // Sorted times covering all segments, including times before and after the valid range, and a few unsorted ones at
+    // the end.
+    std::vector<uint64_t> times;
+    for (uint64_t t_ns{0}; t_ns < t0_ns + (num_control_points - 2) * delta_t_ns; t_ns += 123'457) {
+        times.push_back(t_ns);
+    }
+    times.insert(std::cend(times), {t0_ns + 3 * delta_t_ns, t0_ns, t0_ns + delta_t_ns / 2});
+
+    for (auto const derivative : {Null, First, Second}) {
+        auto const results{spline.EvaluateMany(times, derivative)};
+        ASSERT_EQ(std::size(results), std::size(times));
+
+        for (size_t i{0}; i < std::size(times); ++i) {
+            auto const expected{spline.Evaluate(times[i], derivative)};
+            ASSERT_EQ(results[i].has_value(), expected.has_value()) << "t_ns: " << times[i];
+            if (expected) {
+                EXPECT_TRUE(results[i]->isApprox(*expected, 1e-8)) << "Result:\n"
+                                                                   << results[i]->transpose()
+                                                                   << "\nexpected result:\n"
+                                                                   << expected->transpose();
+            }
+        }
+    }
+
+    EXPECT_TRUE(spline.EvaluateMany({}, Null).empty());
+}
+
+TEST(SplineSe3Spline, TestNonUniformKnots) {
+    int const num_control_points{8};
+    Matrix2NXd control_points{2 * N, num_control_points};
+    for (int i{0}; i < num_control_points; ++i) {
+        double const t{0.3 * i};
+        control_points.col(i) << 0.2 * std::sin(t), 0.1 * std::cos(t), 0.05 * t, t, t * t, std::sin(t);
+    }
+    std::vector<uint64_t> const knots_ns{1'000, 21'001'000, 81'001'000, 91'001'000, 151'001'000, 171'001'000};
+    Se3Spline const spline{control_points, TimeHandler{knots_ns}};
+
+    EXPECT_FALSE(spline.Evaluate(knots_ns.front() - 1, Null));
+    EXPECT_TRUE(spline.Evaluate(knots_ns.front(), Null));
+    EXPECT_FALSE(spline.Evaluate(knots_ns.back(), Null));
+
+    // The r3 spline is C2 continuous across the knots, even though the segments on either side have different
+    // durations. We do not check the so3 spline here, see the WARN in knot_insertion.cpp about the order in which its
+    // deltas are applied, that holds for the uniform spline just the same.
+    for (size_t j{1}; j < std::size(knots_ns) - 1; ++j) {
+        for (auto const derivative : {Null, First, Second}) {
+            auto const before{spline.Evaluate(knots_ns[j] - 1, derivative)};
+            auto const after{spline.Evaluate(knots_ns[j], derivative)};
+            ASSERT_TRUE(before and after);
+            EXPECT_TRUE(before->tail<3>().isApprox(after->tail<3>(), 1e-5)) << "Knot: " << j << "\nBefore:\n"
+                                                                            << before->transpose() << "\nafter:\n"
+                                                                            << after->transpose();
+        }
+    }
+
+    std::vector<uint64_t> times;
+    for (uint64_t t_ns{0}; t_ns < knots_ns.back() + 10'000'000; t_ns += 123'457) {
+        times.push_back(t_ns);
+    }
+    for (auto const derivative : {Null, First, Second}) {
+        auto const results{spline.EvaluateMany(times, derivative)};
+        for (size_t i{0}; i < std::size(times); ++i) {
+            auto const expected{spline.Evaluate(times[i], derivative)};
+            ASSERT_EQ(results[i].has_value(), expected.has_value()) << "t_ns: " << times[i];
+            if (expected) {
+                EXPECT_TRUE(results[i]->isApprox(*expected, 1e-8)) << "t_ns: " << times[i];
+            }
+        }
+    }
+}
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
+#include "spline/se3_spline.hpp"
 #include "spline/spline_state.hpp"
 #include "spline/types.hpp"
 #include "types/eigen_types.hpp"
@@ -16,4 +19,41 @@ TEST(SplineSplineInitialization, TestBuildOmega) {
 
     MatrixXd const Q_100{spline::BuildOmega(100, 1)};
     EXPECT_FLOAT_EQ(Q_100.diagonal().sum(), 8e-6);
-}
\ No newline at end of file
+}
+
+TEST(SplineSplineInitialization, TestAdaptiveKnots) {
+    // One second of standing still followed by one second of fast rotation, sampled at 100 Hz.
+    Frames frames;
+    for (int i{0}; i <= 200; ++i) {
+        double const t{i / 100.0};
+        double const angle{t < 1 ? 0 : 2 * (t - 1) * (t - 1)};
+        frames.insert({static_cast<std::uint64_t>(i) * 10'000'000, {Array6d{angle, 0, 0, 0, 0, 0}}});
+    }
+
+    auto const knots_ns{spline::AdaptiveKnots(frames, 5, 50)};
+    EXPECT_EQ(knots_ns.front(), 0);
+    EXPECT_EQ(knots_ns.back(), 2'000'000'000);
+    EXPECT_TRUE(std::ranges::is_sorted(knots_ns));
+
+    auto const num_knots_in{[&knots_ns](std::uint64_t const start_ns, std::uint64_t const end_ns) {
+        return std::ranges::count_if(knots_ns,
+                                     [&](std::uint64_t const t_ns) { return start_ns < t_ns and t_ns < end_ns; });
+    }};
+    EXPECT_LE(num_knots_in(0, 900'000'000), 6);                 // About min_frequency_hz
+    EXPECT_GE(num_knots_in(1'500'000'000, 2'000'000'000), 15);  // Close to max_frequency_hz
+
+    // The spline initialized on the adaptive knots fits the frames.
+    spline::Se3Spline const spline{spline::InitializeSe3SplineState(frames, knots_ns)};
+    EXPECT_FALSE(spline.GetTimeHandler().IsUniform());
+    EXPECT_EQ(spline.Size(), static_cast<int>(std::size(knots_ns)) - 1 + spline::D);
+    for (auto const& [timestamp_ns, frame] : frames) {
+        if (auto const pose{spline.Evaluate(timestamp_ns, spline::DerivativeOrder::Null)}) {
+            EXPECT_NEAR((*pose)[0], frame.pose[0], 2e-2) << "t_ns: " << timestamp_ns;
+        }
+    }
+
+    EXPECT_THROW(spline::AdaptiveKnots(frames, 0, 50), std::invalid_argument);
+    EXPECT_THROW(spline::AdaptiveKnots(frames, 50, 5), std::invalid_argument);
+    EXPECT_THROW(spline::InitializeSe3SplineState(frames, std::vector<std::uint64_t>{1, 2'000'000'000}),
+                 std::invalid_argument);
+}
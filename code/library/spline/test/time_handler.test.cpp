@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include "spline/constants.hpp"
+#include "spline/r3_spline.hpp"
+#include "spline/so3_spline.hpp"
 
 using namespace reprojection;
 
@@ -53,3 +55,67 @@ TEST(SplineTimeHandler, TestNormalizedSegmentTime) {
     EXPECT_FLOAT_EQ(u4, 0.4);
     EXPECT_EQ(i4, 3);
 }
+
+TEST(SplineTimeHandler, TestNonUniformTimeHandler) {
+    spline::TimeHandler const time_handler{std::vector<std::uint64_t>{100, 105, 115, 118}};
+    EXPECT_FALSE(time_handler.IsUniform());
+    EXPECT_EQ(time_handler.t0_ns_, 100);
+    EXPECT_EQ(time_handler.delta_t_ns_, 6);  // Mean segment duration
+    EXPECT_TRUE(spline::TimeHandler(100, 5).IsUniform());
+
+    EXPECT_EQ(time_handler.SegmentStartNs(1), 105);
+    EXPECT_EQ(time_handler.SegmentDurationNs(1), 10);
+
+    // Three segments means K + 2 control points, the end is given by the last knot.
+    size_t const num_control_points{spline::K + 2};
+    EXPECT_FALSE(time_handler.SplinePosition(99, num_control_points));
+    EXPECT_EQ(time_handler.SplinePosition(100, num_control_points), std::pair(0.0, 0));
+    EXPECT_EQ(time_handler.SplinePosition(107, num_control_points), std::pair(0.2, 1));
+    EXPECT_EQ(time_handler.SplinePosition(115, num_control_points), std::pair(0.0, 2));
+    EXPECT_FALSE(time_handler.SplinePosition(118, num_control_points));
+    EXPECT_FALSE(time_handler.SplinePosition(118, num_control_points + 1));
+    EXPECT_FALSE(time_handler.SplinePosition(115, num_control_points - 1));
+
+    // Knots must be strictly increasing!
+    EXPECT_DEATH(spline::TimeHandler(std::vector<std::uint64_t>{100, 100, 105}), "");
+}
+
+TEST(SplineTimeHandler, TestBlending) {
+    // Evenly spaced non-uniform knots must reproduce the blending matrices of the uniform spline for every segment,
+    // including the ones at the ends where the missing knots are padded.
+    spline::TimeHandler const uniform_knots{std::vector<std::uint64_t>{100, 105, 110, 115, 120}};
+    for (int i{0}; i < 4; ++i) {
+        spline::SegmentBlending const blending{uniform_knots.Blending(i)};
+        EXPECT_TRUE(blending.r3.isApprox(spline::R3Spline::M_)) << "Segment: " << i;
+        EXPECT_TRUE(blending.so3.isApprox(spline::So3Spline::GetBlendingMatrix())) << "Segment: " << i;
+        EXPECT_EQ(blending.delta_t_ns, 5);
+    }
+
+    spline::SegmentBlending const uniform_blending{spline::TimeHandler(100, 5).Blending(7)};
+    EXPECT_TRUE(uniform_blending.r3.isApprox(spline::R3Spline::M_));
+    EXPECT_TRUE(uniform_blending.so3.isApprox(spline::So3Spline::GetBlendingMatrix()));
+    EXPECT_EQ(uniform_blending.delta_t_ns, 5);
+
+    spline::TimeHandler const non_uniform_knots{std::vector<std::uint64_t>{100, 105, 115, 118, 130}};
+    spline::SegmentBlending const blending{non_uniform_knots.Blending(1)};
+    EXPECT_EQ(blending.delta_t_ns, 10);
+    EXPECT_FALSE(blending.r3.isApprox(spline::R3Spline::M_));
+    // The first row of the cumulative blending matrix is always one at u^0, see Eqn. 20 from [1]
+    EXPECT_TRUE(blending.so3.row(0).isApprox(Eigen::RowVector4d{1, 0, 0, 0}));
+}
+TEST(SplineTimeHandler, TestBlendingCache) {
+    // All segments of a uniform spline share one blending.
+    spline::BlendingCache uniform_blendings{spline::TimeHandler(100, 5)};
+    spline::SharedBlending const uniform_blending{uniform_blendings.Blending(0)};
+    EXPECT_EQ(uniform_blendings.Blending(7), uniform_blending);
+    EXPECT_EQ(uniform_blending->delta_t_ns, 5);
+
+    // Non-uniform segments get their own blending, which is built once and then shared by all residuals of the segment.
+    spline::TimeHandler const non_uniform_knots{std::vector<std::uint64_t>{100, 105, 115, 118, 130}};
+    spline::BlendingCache non_uniform_blendings{non_uniform_knots};
+    spline::SharedBlending const blending{non_uniform_blendings.Blending(1)};
+    EXPECT_EQ(non_uniform_blendings.Blending(1), blending);
+    EXPECT_NE(non_uniform_blendings.Blending(2), blending);
+    EXPECT_EQ(blending->delta_t_ns, 10);
+    EXPECT_TRUE(blending->r3.isApprox(non_uniform_knots.Blending(1).r3));
+}
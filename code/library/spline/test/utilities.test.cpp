@@ -70,6 +70,23 @@ TEST(SplineUtilities, TestBlendingMatrix) {
     EXPECT_TRUE(cumulative_blender.isApprox(gt_cumulative_blender));
 }
 
+TEST(SplineUtilities, TestNonUniformBlendingMatrix) {
+    // Evenly spaced knots give the uniform blending matrix.
+    MatrixXd const uniform_blender{spline::NonUniformBlendingMatrix({-2, -1, 0, 1, 2, 3})};
+    EXPECT_TRUE(uniform_blender.isApprox(spline::BlendingMatrix(4)));
+
+    // For any knots the basis functions sum to one (partition of unity), which means the u^0 column sums to one and all
+    // other columns sum to zero.
+    MatrixXd const blender{spline::NonUniformBlendingMatrix({-3, -0.5, 0, 1, 1.2, 4})};
+    EXPECT_TRUE(blender.colwise().sum().isApprox(Eigen::RowVector4d{1, 0, 0, 0}));
+    EXPECT_FALSE(blender.isApprox(spline::BlendingMatrix(4)));
+
+    // The basis function of the first control point ends at the end of the segment (u=1) and the one of the last
+    // control point starts at the start of the segment (u=0).
+    EXPECT_NEAR(blender.row(0).sum(), 0, 1e-12);
+    EXPECT_NEAR(blender(3, 0), 0, 1e-12);
+}
+
 TEST(SplineUtilities, TestBinomialCoefficient) {
     // Wiki: "where it gives the number of ways, disregarding order, that k objects can be chosen from among n objects"
     EXPECT_EQ(spline::BinomialCoefficient(0, 0), 1);
@@ -1,29 +1,46 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+
 #include "types/calibration_types.hpp"
 #include "types/database_types.hpp"
 #include "types/io.hpp"
 
 namespace reprojection::steps {
 
+// NOTE(Jack): If warm_start is set the intrinsics and all frame poses that can be matched by timestamp are seeded from
+// the most recent bundle adjustment result for the same camera and camera model, if there is one. Frames without a
+// match keep their pose from the pose initialization (i.e. PnP). Because the seed changes the result the cache key of the
+// source is part of the cache key.
 struct BundleAdjustment {
-    BundleAdjustment(AssetId camera_id, StepId targets_id, int num_threads, StepId camera_info_id, StepId intrinsic_id,
-                     StepId camera_poses_id, SqlitePtr db);
+    BundleAdjustment(AssetId camera_id, StepId targets_id, int num_threads, std::optional<double> time_budget_s,
+                     bool warm_start, StepId camera_info_id, StepId intrinsic_id, StepId camera_poses_id,
+                     SqlitePtr db);
 
     static StepType Type() { return StepType::BundleAdjustment; }
 
     Hash CacheKey() const;
 
-    void Execute(StepId step_id, SqlitePtr db) const;
+    ExecuteStatus Execute(StepId step_id, SqlitePtr db) const;
 
    private:
     AssetId camera_id_;
     StepId targets_id_;
     int num_threads_;
-    CameraMeasurements targets_;
+    std::optional<double> time_budget_s_;
+    std::shared_ptr<CameraMeasurements const> targets_;
     CameraInfo camera_info_;
     CameraState intrinsics_;
     Frames camera_poses_;
+
+    struct WarmStart {
+        Hash input_key;  // The cache key the step would have without the warm start
+        StepId source_id;
+        Hash source_key;
+        int matched_frames;
+    };
+    std::optional<WarmStart> warm_start_;
 };
 
 }  // namespace reprojection::steps
@@ -18,10 +18,9 @@ struct CameraInfoStep {
    private:
     AssetId camera_id_;
     CameraModel camera_model_;
-    // TODO(Jack): It is way overkill to load all the images here just to get the size of the first one. We need a
-    // better iamge handling pipeline across the image loading/feature extraction/camera info. We need an entirely new
-    // concept.
-    std::shared_ptr<EncodedImages> images_;
+    // NOTE(Jack): Only the image sizes are needed for the cache key, Execute() then loads just the first image.
+    ImageSizes image_sizes_;
+    StepId image_loading_id_;
 };
 
 }  // namespace reprojection::steps
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "spline/se3_spline.hpp"
 #include "types/calibration_types.hpp"
 #include "types/database_types.hpp"
@@ -8,14 +10,15 @@
 namespace reprojection::steps {
 
 struct ExtrinsicInit {
+    // The time budget only applies with refine_rotation set, the closed form rotation alignment does not iterate.
     ExtrinsicInit(AssetId camera_id, StepId spline_id, AssetId imu_id, StepId imu_data_id, int num_threads,
-                  SqlitePtr db);
+                  std::optional<double> time_budget_s, bool refine_rotation, SqlitePtr db);
 
     static StepType Type() { return StepType::ExtrinsicInit; }
 
     Hash CacheKey() const;
 
-    void Execute(StepId step_id, SqlitePtr db) const;
+    ExecuteStatus Execute(StepId step_id, SqlitePtr db) const;
 
    private:
     AssetId camera_id_;
@@ -29,6 +32,8 @@ struct ExtrinsicInit {
     StepId imu_data_id_;
     ImuMeasurements imu_data_;
     int num_threads_;
+    std::optional<double> time_budget_s_;
+    bool refine_rotation_;
 };
 
 }  // namespace reprojection::steps
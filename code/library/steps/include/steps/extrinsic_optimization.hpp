@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+
 #include "spline/se3_spline.hpp"
 #include "types/calibration_types.hpp"
 #include "types/database_types.hpp"
@@ -9,23 +12,28 @@ namespace reprojection::steps {
 
 struct ExtrinsicOptimization {
     ExtrinsicOptimization(AssetId camera_id, AssetId imu_id, StepId targets_id, StepId imu_data_id, int num_threads,
-                          StepId camera_info_id, StepId intrinsic_id, StepId spline_id, StepId extrinsic_init_id,
-                          SqlitePtr db);
+                          std::optional<double> time_budget_s, std::optional<int> imu_samples_per_segment,
+                          std::optional<double> window_s, std::optional<int> spline_levels, StepId camera_info_id,
+                          StepId intrinsic_id, StepId spline_id, StepId extrinsic_init_id, SqlitePtr db);
 
     static StepType Type() { return StepType::ExtrinsicOptimization; }
 
     Hash CacheKey() const;
 
-    void Execute(StepId step_id, SqlitePtr db) const;
+    ExecuteStatus Execute(StepId step_id, SqlitePtr db) const;
 
    private:
     AssetId camera_id_;
     AssetId imu_id_;
     StepId targets_id_;
-    CameraMeasurements targets_;
+    std::shared_ptr<CameraMeasurements const> targets_;
     StepId imu_data_id_;
     ImuMeasurements imu_data_;
     int num_threads_;
+    std::optional<double> time_budget_s_;
+    std::optional<int> imu_samples_per_segment_;
+    std::optional<double> window_s_;
+    std::optional<int> spline_levels_;
     CameraInfo camera_info_;
     CameraState intrinsics_;
     std::unique_ptr<spline::Se3Spline> spline_;
@@ -14,13 +14,18 @@ struct FeatureExtraction {
 
     Hash CacheKey() const;
 
+    // The key of the per-frame extraction cache entries, see database::ExtractionCacheInsert().
+    static Hash ExtractionCacheKey(TargetInfo const& target_info);
+
     void Execute(StepId step_id, SqlitePtr db) const;
 
    private:
     AssetId camera_id_;
     StepId image_loading_id_;
     bool show_extraction_;
-    std::shared_ptr<EncodedImages> images_;
+    // NOTE(Jack): Only the image sizes are needed for the cache key, the images themselves are streamed from the
+    // database in Execute() so that they are never all in memory at once.
+    ImageSizes image_sizes_;
     TargetInfo target_info_;
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "types/calibration_types.hpp"
 #include "types/database_types.hpp"
 #include "types/io.hpp"
@@ -19,7 +21,7 @@ struct IntrinsicInitialization {
     AssetId camera_id_;
     int num_threads_;
     CameraInfo camera_info_;
-    CameraMeasurements targets_;
+    std::shared_ptr<CameraMeasurements const> targets_;
 };
 
 }  // namespace reprojection::steps
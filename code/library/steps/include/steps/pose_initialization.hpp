@@ -1,13 +1,17 @@
 #pragma once
 
+#include <memory>
+
 #include "types/calibration_types.hpp"
 #include "types/database_types.hpp"
 #include "types/io.hpp"
 
 namespace reprojection::steps {
 
+// NOTE(Jack): See calibration::PoseInitialization() for what sequential does.
 struct PoseInitialization {
-    PoseInitialization(AssetId camera_id, StepId targets_id, StepId camera_info_id, StepId intrinsics_id, SqlitePtr db);
+    PoseInitialization(AssetId camera_id, StepId targets_id, bool sequential, StepId camera_info_id,
+                       StepId intrinsics_id, SqlitePtr db);
 
     static StepType Type() { return StepType::PoseInit; }
 
@@ -18,7 +22,8 @@ struct PoseInitialization {
    private:
     AssetId camera_id_;
     StepId targets_id_;
-    CameraMeasurements targets_;
+    std::shared_ptr<CameraMeasurements const> targets_;
+    bool sequential_;
     CameraInfo camera_info_;
     CameraState intrinsics_;
 };
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "optimization/solver_progress.hpp"
+#include "types/calibration_types.hpp"
+#include "types/database_types.hpp"
+#include "types/io.hpp"
+
+namespace reprojection::steps {
+
+/**
+ * \brief Writes the progress of a running optimization to the database on a background thread.
+ *
+ * The Push() methods are meant to be used as the sinks of an optimization::SolverProgress. They only queue the data, so
+ * they are cheap to call from the solver thread. A background thread then writes the queue to the database every
+ * flush_interval. Every iteration is written, but of the snapshots only the newest one at the time of the flush is
+ * written, which throttles the (much larger) snapshots to one per flush_interval. Stop() writes whatever is still
+ * queued, including the final snapshot.
+ *
+ * WARN(Jack): The database connection is shared with the step that owns the writer. Sqlite serializes the individual
+ * calls, but a transaction on one thread would also pick up the statements of the other thread. Therefore call Stop()
+ * before the step writes its own results.
+ */
+class SolverProgressWriter {
+   public:
+    SolverProgressWriter(StepId const step_id, SqlitePtr const db,
+                         std::chrono::milliseconds const flush_interval = std::chrono::milliseconds{500});
+
+    ~SolverProgressWriter();
+
+    SolverProgressWriter(SolverProgressWriter const&) = delete;
+    SolverProgressWriter& operator=(SolverProgressWriter const&) = delete;
+    SolverProgressWriter(SolverProgressWriter&&) = delete;
+    SolverProgressWriter& operator=(SolverProgressWriter&&) = delete;
+
+    // Solver progress options which use this writer as their sinks.
+    optimization::SolverProgressOptions ProgressOptions(std::optional<double> const time_budget_s);
+
+    void Push(SolverIteration const& iteration);
+
+    void Push(SolverSnapshot const& snapshot);
+
+    void Stop();
+
+   private:
+    void Flush();
+
+    StepId step_id_;
+    SqlitePtr db_;
+    std::chrono::milliseconds flush_interval_;
+
+    std::mutex mutex_;
+    std::condition_variable_any condition_;
+    std::vector<SolverIteration> iterations_;
+    std::optional<SolverSnapshot> snapshot_;
+
+    // NOTE(Jack): Must be the last member so the thread is joined before anything it touches is destroyed.
+    std::jthread writer_;
+};
+
+}  // namespace reprojection::steps
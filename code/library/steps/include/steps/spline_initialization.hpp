@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+
 #include "types/calibration_types.hpp"
 #include "types/database_types.hpp"
 #include "types/io.hpp"
@@ -7,8 +10,12 @@
 namespace reprojection::steps {
 
 struct SplineInitialization {
+    // If knot_frequency_hz is not set the spline gets 100Hz knots. If min_knot_frequency_hz is set the knots are
+    // non-uniform, their frequency follows the motion of the camera between min_knot_frequency_hz and the
+    // knot_frequency_hz (see spline::AdaptiveKnots()).
     SplineInitialization(AssetId camera_id, StepId camera_poses_id, StepId targets_id, StepId camera_info_id,
-                         StepId intrinsics_id, SqlitePtr db);
+                         StepId intrinsics_id, std::optional<int> knot_frequency_hz,
+                         std::optional<int> min_knot_frequency_hz, SqlitePtr db);
 
     static StepType Type() { return StepType::SplineInit; }
 
@@ -19,11 +26,13 @@ struct SplineInitialization {
    private:
     AssetId camera_id_;
     Frames camera_poses_;
+    std::optional<int> knot_frequency_hz_;
+    std::optional<int> min_knot_frequency_hz_;
     // NOTE(Jack): These are only needed for the reprojection error calculation. They are not needed for the spline
     // initialization at all. But we do the diagnostic calculations in the spline init/other steps directly to avoid
     // creating dedicated diagnostic calculation steps - even if it means passing some unexpected information in.
     StepId targets_id_;
-    CameraMeasurements targets_;
+    std::shared_ptr<CameraMeasurements const> targets_;
     CameraInfo camera_info_;
     CameraState intrinsics_;
 };
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "types/database_types.hpp"
+
+namespace reprojection::steps {
+
+/**
+ * \brief Measures the resources used by the process between construction and Stop().
+ *
+ * The wall time, cpu time (summed over all threads) and the peak resident memory come from the operating system at the
+ * start and stop time. The number of threads has no "high water mark" like the memory does, therefore a background
+ * thread samples the current thread count every few milliseconds and the maximum is reported (minus the sampling
+ * thread itself). Very short-lived threads can therefore be missed.
+ *
+ * WARN(Jack): The operating system only tracks the peak memory of the entire process lifetime. This means that the
+ * reported peak RSS delta is zero if a step did not use more memory than the process already used at some earlier
+ * point, even if the step itself allocated a lot of memory.
+ */
+class StepMetricsRecorder {
+   public:
+    StepMetricsRecorder();
+
+    StepMetrics Stop(CacheStatus const cache_status);
+
+   private:
+    std::chrono::steady_clock::time_point wall_start_;
+    double cpu_start_s_;
+    int64_t peak_rss_start_kb_;
+
+    std::atomic<int> peak_num_threads_;
+
+    // NOTE(Jack): Must be the last member so the thread is joined before anything it touches is destroyed.
+    std::jthread sampler_;
+};
+
+}  // namespace reprojection::steps
@@ -2,6 +2,7 @@
 
 #include "database/calibration_database.hpp"
 #include "logging/logging.hpp"
+#include "steps/step_metrics.hpp"
 #include "types/database_types.hpp"
 #include "types/io.hpp"
 
@@ -17,12 +18,17 @@ template <typename T>
 concept IsRunnableStep = requires(T const& step, StepId const id, SqlitePtr const db) {
     { step.Type() } -> std::same_as<StepType>;
     { step.CacheKey() } -> std::same_as<Hash>;
-    { step.Execute(id, db) } -> std::same_as<void>;
+    requires std::same_as<decltype(step.Execute(id, db)), void> or
+                 std::same_as<decltype(step.Execute(id, db)), ExecuteStatus>;
 };
 
 template <typename T>
     requires IsRunnableStep<T>
 StepId RunStep(WorkflowId const workflow_id, T const& step, SqlitePtr const db) {
+    // NOTE(Jack): We start recording before the cache key calculation because hashing the inputs of a step is not free,
+    // and is a cost we pay even when there is a cache hit.
+    StepMetricsRecorder recorder;
+
     Hash const cache_key{step.CacheKey()};
     auto const [step_id, cache_status]{database::GetOrCreateStep(db.get(), step.Type(), cache_key)};
 
@@ -33,14 +39,37 @@ StepId RunStep(WorkflowId const workflow_id, T const& step, SqlitePtr const db)
               ToString(step.Type()));
 
     if (cache_status == CacheStatus::CacheHit) {
+        database::StepMetricsInsert(db.get(), step_id, recorder.Stop(cache_status));
         return step_id;
     }
 
     // TODO(Jack): Put this inside a database transaction so in case of failure everything rolls back!
     // TODO(Jack): Not just rollback, but if this throw then we get left with a step with a null cache key, how to
     // solve!?
-    step.Execute(step_id, db);
-    database::StepCacheKeyUpdate(db.get(), step_id, cache_key);
+    ExecuteStatus status{ExecuteStatus::Complete};
+    if constexpr (std::same_as<decltype(step.Execute(step_id, db)), ExecuteStatus>) {
+        status = step.Execute(step_id, db);
+    } else {
+        step.Execute(step_id, db);
+    }
+
+    // NOTE(Jack): A step that stopped early keeps its result for this workflow, but without a cache key no later run
+    // can get a cache hit on it. Otherwise a result cut short by the time budget would be reused as if it were final.
+    if (status == ExecuteStatus::Complete) {
+        database::StepCacheKeyUpdate(db.get(), step_id, cache_key);
+    } else {
+        log->warn("{{'step_id': {:2}, 'step_type': '{}', 'cache_key': 'not stored, the step stopped early'}}",
+                  step_id.value, ToString(step.Type()));
+    }
+
+    StepMetrics const metrics{recorder.Stop(cache_status)};
+    database::StepMetricsInsert(db.get(), step_id, metrics);
+
+    log->info(
+        "{{'step_id': {:2}, 'step_type': '{}', 'wall_time_s': {:.3f}, 'cpu_time_s': {:.3f}, 'peak_rss_delta_kb': {}, "
+        "'peak_num_threads': {}}}",
+        step_id.value, ToString(step.Type()), metrics.wall_time_s, metrics.cpu_time_s, metrics.peak_rss_delta_kb,
+        metrics.peak_num_threads);
 
     return step_id;
 }
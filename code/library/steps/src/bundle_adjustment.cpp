@@ -3,11 +3,15 @@
 #include <ranges>
 
 #include "calibration/calibration_utils.hpp"
+#include "database/artifact_cache.hpp"
 #include "database/calibration_database.hpp"
 #include "hashing/hashing.hpp"
 #include "logging/fmt.hpp"
 #include "logging/logging.hpp"
+#include "optimization/solver_strategy.hpp"
 #include "steps/bundle_adjustment.hpp"
+#include "steps/solver_progress_writer.hpp"
+#include "types/ceres_types.hpp"
 
 namespace reprojection::steps {
 
@@ -18,38 +22,101 @@ auto const log{logging::Get("steps")};
 }
 
 BundleAdjustment::BundleAdjustment(AssetId const camera_id, StepId const targets_id, int const num_threads,
-                                   StepId const camera_info_id, StepId const intrinsic_id, StepId const camera_poses_id,
-                                   SqlitePtr const db)
+                                   std::optional<double> const time_budget_s, bool const warm_start,
+                                   StepId const camera_info_id, StepId const intrinsic_id,
+                                   StepId const camera_poses_id, SqlitePtr const db)
     : camera_id_{camera_id},
       targets_id_{targets_id},
       num_threads_{num_threads},
-      targets_{database::ExtractedTargetsSelect(db.get(), targets_id, camera_id)},
+      time_budget_s_{time_budget_s},
+      targets_{database::CachedExtractedTargetsSelect(db.get(), targets_id, camera_id)},
       camera_poses_{database::CameraPosesSelect(db.get(), camera_poses_id, camera_id)} {
-    if (auto const camera_info{database::CameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
+    if (auto const camera_info{database::CachedCameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
         camera_info_ = *camera_info;
     } else {
         log->error("{}", camera_info.error());  // LCOV_EXCL_LINE
         std::exit(1);                           // LCOV_EXCL_LINE
     }  // LCOV_EXCL_LINE
 
-    if (auto const intrinsics{database::IntrinsicSelect(db.get(), intrinsic_id, camera_id)}) {
+    if (auto const intrinsics{database::CachedIntrinsicSelect(db.get(), intrinsic_id, camera_id)}) {
         intrinsics_ = *intrinsics;
     } else {
         log->error("{}", intrinsics.error());  // LCOV_EXCL_LINE
         std::exit(1);                          // LCOV_EXCL_LINE
     }
+
+    if (not warm_start) {
+        return;
+    }
+
+    auto const source{database::WarmStartSourceSelect(db.get(), camera_id, camera_info_.camera_model)};
+    if (not source) {
+        log->info("{{'asset_id': {}, 'warm_start': 'No previous bundle adjustment found, starting cold.'}}",
+                  camera_id.value);
+        return;
+    }
+
+    auto const& [source_id, source_key]{*source};
+    Hash const input_key{CacheKey()};
+
+    // NOTE(Jack): The source query only returns steps which have intrinsics for this camera, so this cannot fail.
+    intrinsics_ = *database::CachedIntrinsicSelect(db.get(), source_id, camera_id);
+
+    Frames const source_poses{database::CameraPosesSelect(db.get(), source_id, camera_id)};
+    int matched_frames{0};
+    for (auto& [timestamp_ns, frame] : camera_poses_) {
+        if (auto const source_pose{source_poses.find(timestamp_ns)}; source_pose != std::cend(source_poses)) {
+            frame = source_pose->second;
+            ++matched_frames;
+        }
+    }
+
+    // NOTE(Jack): The source is "the most recent result", which after running this step is this step itself. If the
+    // source was itself warm started for these exact inputs it counts as the source it was warm started from.
+    // Otherwise every repeated run would have a new cache key and never find its own result in the cache again. Such
+    // a source always has exactly the cache key we compute here, so it is found in the cache and not solved again.
+    Hash seed_key{source_key};
+    if (auto const previous{database::WarmStartSelect(db.get(), source_id, input_key)}) {
+        seed_key = *previous;
+    }
+
+    warm_start_ = WarmStart{input_key, source_id, seed_key, matched_frames};
 }
 
 Hash BundleAdjustment::CacheKey() const {
-    return hashing::HashArguments(camera_info_, targets_, intrinsics_, camera_poses_);
+    if (warm_start_) {
+        return hashing::HashArguments(std::string_view{warm_start_->input_key.value},
+                                      std::string_view{"warm_start="}, std::string_view{warm_start_->source_key.value});
+    }
+
+    optimization::SolverOverride const solver_override{
+        optimization::GetSolverOverride(optimization::SolverProblem::BundleAdjustment)};
+
+    return hashing::HashArguments(camera_info_, *targets_, intrinsics_, camera_poses_,
+                                  optimization::solver_strategy_key,
+                                  hashing::OptionalKeyPart(solver_override.linear_solver, "linear_solver"),
+                                  hashing::OptionalKeyPart(solver_override.preconditioner, "preconditioner"));
 }
 
-void BundleAdjustment::Execute(StepId step_id, SqlitePtr const db) const {
+ExecuteStatus BundleAdjustment::Execute(StepId step_id, SqlitePtr const db) const {
+    if (warm_start_) {
+        log->info("{{'step_id': {}, 'asset_id': {}, 'warm_start': {{'source_step_id': {}, 'matched_frames': {}, "
+                  "'pnp_frames': {}}}}}",
+                  step_id.value, camera_id_.value, warm_start_->source_id.value, warm_start_->matched_frames,
+                  std::ssize(camera_poses_) - warm_start_->matched_frames);
+    }
+
     auto const aligned_camera_poses{calibration::AlignRotations(camera_poses_)};
     OptimizationState const initial_state{intrinsics_, aligned_camera_poses};
 
-    auto const [optimized_state,
-                debug]{optimization::BundleAdjustment(camera_info_, targets_, initial_state, num_threads_)};
+    SolverProgressWriter progress_writer{step_id, db};
+    optimization::SolverProgress progress{progress_writer.ProgressOptions(time_budget_s_)};
+    auto const [optimized_state, debug]{
+        optimization::BundleAdjustment(camera_info_, *targets_, initial_state, num_threads_, false, &progress)};
+    progress_writer.Stop();
+    if (auto const early_stop{progress.StoppedEarly()}) {
+        log->warn("{{'step_id': {}, 'early_stop': '{}'}}", step_id.value, ToString(*early_stop));  // LCOV_EXCL_LINE
+    }
 
     log->info(
         "{{'step_id': {}, 'asset_id': {}, 'camera_model': '{}', 'intrinsic: {}, 'solver_summary': {{'intial_cost': "
@@ -60,10 +127,17 @@ void BundleAdjustment::Execute(StepId step_id, SqlitePtr const db) const {
 
     database::CameraPosesInsert(db.get(), step_id, targets_id_, camera_id_, optimized_state.frames);
     database::IntrinsicInsert(db.get(), step_id, camera_id_, camera_info_.camera_model, optimized_state.camera_state);
+    database::SolverMetricsInsert(db.get(), step_id, ToSolverMetrics(debug.solver_summary));
+    if (warm_start_) {
+        database::WarmStartInsert(db.get(), step_id, camera_id_, warm_start_->input_key, warm_start_->source_id,
+                                  warm_start_->source_key, warm_start_->matched_frames);
+    }
 
     // Diagnostic output
-    ReprojectionErrors const errors{optimization::ReprojectionError(camera_info_, targets_, optimized_state)};
+    ReprojectionErrors const errors{optimization::ReprojectionError(camera_info_, *targets_, optimized_state)};
     database::ReprojectionErrorsInsert(db.get(), step_id, targets_id_, camera_id_, errors);
+
+    return progress.StoppedEarly() ? ExecuteStatus::StoppedEarly : ExecuteStatus::Complete;
 }
 
 }  // namespace reprojection::steps
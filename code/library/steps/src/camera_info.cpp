@@ -16,25 +16,28 @@ CameraInfoStep::CameraInfoStep(AssetId const camera_id, StepId const image_loadi
                                SqlitePtr const db)
     : camera_id_{camera_id},
       camera_model_{camera_model},
-      images_{std::make_shared<EncodedImages>(database::ImagesSelect(db.get(), image_loading_id, camera_id))} {}
+      image_sizes_{database::ImageSizesSelect(db.get(), image_loading_id, camera_id)},
+      image_loading_id_{image_loading_id} {}
 
 Hash CameraInfoStep::CacheKey() const {
     // NOTE(Jack): See FeatureExtraction::CacheKey() comment as to why we need the camera asset id.
-    return hashing::HashArguments(camera_id_.value, camera_model_, *images_);
+    return hashing::HashArguments(camera_id_.value, camera_model_, image_sizes_);
 }
 
 void CameraInfoStep::Execute(StepId const step_id, SqlitePtr const db) const {
     // TODO(Jack): Should this be checked in the constructor? Problem with that is that we cant artificially trigger a
     // cache hit then. But it seems like if we can already know this is a problem then that we should not let
     // construction finish.
-    if (std::size(*images_) == 0) {
+    if (std::size(image_sizes_) == 0) {
         log->error("{{'step_id': {}, 'asset_id': {}, 'msg': 'No images loaded.'}}", step_id.value,  // LCOV_EXCL_LINE
                    camera_id_.value, ToString(camera_model_));                                      // LCOV_EXCL_LINE
         std::exit(1);                                                                               // LCOV_EXCL_LINE
     }
 
     // Check the size of the first image to get the image dimensions.
-    cv::Mat const img{cv::imdecode(images_->begin()->second.data, cv::IMREAD_COLOR)};
+    EncodedImages const first_image{
+        database::ImagesSelect(db.get(), image_loading_id_, camera_id_, std::cbegin(image_sizes_)->first, 1)};
+    cv::Mat const img{cv::imdecode(std::cbegin(first_image)->second.data, cv::IMREAD_COLOR)};
     if (img.empty()) {
         log->error(  // LCOV_EXCL_LINE
             "{{'step_id': {}, 'asset_id': {}, 'msg': 'Attempted to decode image but result was empty.'}}",
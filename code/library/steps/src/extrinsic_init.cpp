@@ -6,6 +6,9 @@
 #include "logging/fmt.hpp"
 #include "logging/logging.hpp"
 #include "optimization/extrinsic_optimization.hpp"
+#include "optimization/solver_strategy.hpp"
+#include "steps/solver_progress_writer.hpp"
+#include "types/ceres_types.hpp"
 
 namespace reprojection::steps {
 
@@ -16,12 +19,15 @@ auto const log{logging::Get("steps")};
 }
 
 ExtrinsicInit::ExtrinsicInit(AssetId const camera_id, StepId const spline_id, AssetId const imu_id,
-                             StepId const imu_data_id, int num_threads, SqlitePtr const db)
+                             StepId const imu_data_id, int num_threads, std::optional<double> const time_budget_s,
+                             bool const refine_rotation, SqlitePtr const db)
     : camera_id_{camera_id},
       imu_id_{imu_id},
       imu_data_id_{imu_data_id},
       imu_data_{database::ImuDataSelect(db.get(), imu_data_id, imu_id)},
-      num_threads_{num_threads} {
+      num_threads_{num_threads},
+      time_budget_s_{time_budget_s},
+      refine_rotation_{refine_rotation} {
     if (auto const time_handler{database::SplineInfoSelect(db.get(), spline_id, camera_id)}) {
         auto const control_points{database::ControlPointsSelect(db.get(), spline_id, camera_id)};
 
@@ -33,15 +39,38 @@ ExtrinsicInit::ExtrinsicInit(AssetId const camera_id, StepId const spline_id, As
 }
 
 Hash ExtrinsicInit::CacheKey() const {
-    return hashing::HashArguments(imu_data_, spline_->ControlPoints(), spline_->GetTimeHandler().t0_ns_,
-                                  spline_->GetTimeHandler().delta_t_ns_);
+    spline::TimeHandler const& time_handler{spline_->GetTimeHandler()};
+    std::optional<std::vector<std::uint64_t>> const knots_ns{
+        time_handler.IsUniform() ? std::nullopt : std::optional{time_handler.knots_ns_}};
+
+    // NOTE(Jack): Only the refinement of the rotation is a ceres optimization, the closed form solution does not depend
+    // on the solver override.
+    optimization::SolverOverride const solver_override{
+        refine_rotation_ ? optimization::GetSolverOverride(optimization::SolverProblem::AngularVelocityAlignment)
+                         : optimization::SolverOverride{}};
+
+    // NOTE(Jack): The rotation used to be the result of an optimization and is now solved in closed form, which does
+    // not give exactly the same rotation. The results cached before that change must therefore not be reused.
+    return hashing::HashArguments(imu_data_, spline_->ControlPoints(), time_handler.t0_ns_, time_handler.delta_t_ns_,
+                                  std::string_view{"rotation=closed_form;"},
+                                  hashing::OptionalKeyPart(knots_ns, "knots_ns"),
+                                  hashing::OptionalKeyPart(refine_rotation_, "refine_rotation"),
+                                  hashing::OptionalKeyPart(solver_override.linear_solver, "linear_solver"),
+                                  hashing::OptionalKeyPart(solver_override.preconditioner, "preconditioner"));
 }
 
-void ExtrinsicInit::Execute(StepId const step_id, SqlitePtr const db) const {
-    auto const [rotation_result, gravity_w]{calibration::EstimateCameraImuAlignment(*spline_, imu_data_, num_threads_)};
+ExecuteStatus ExtrinsicInit::Execute(StepId const step_id, SqlitePtr const db) const {
+    SolverProgressWriter progress_writer{step_id, db};
+    optimization::SolverProgress progress{progress_writer.ProgressOptions(time_budget_s_)};
+    auto const [rotation_result, gravity_w]{
+        calibration::EstimateCameraImuAlignment(*spline_, imu_data_, num_threads_, refine_rotation_, &progress)};
+    progress_writer.Stop();
+    if (auto const early_stop{progress.StoppedEarly()}) {
+        log->warn("{{'step_id': {}, 'early_stop': '{}'}}", step_id.value, ToString(*early_stop));  // LCOV_EXCL_LINE
+    }
 
     // TODO(Jack): We should log these diagnostics like we did for the bundle adjustment!
-    auto const [aa_imu_co, _]{rotation_result};
+    auto const [aa_imu_co, debug]{rotation_result};
     // NOTE(Jack): In the cam-imu extrinsic initialization process we can only initialize the rotation so we just set
     // the translation to zero. If someone has an idea how to initialize the translation do tell!
     Array6d const tf_imu_co{aa_imu_co(0), aa_imu_co(1), aa_imu_co(2), 0, 0, 0};
@@ -55,10 +84,15 @@ void ExtrinsicInit::Execute(StepId const step_id, SqlitePtr const db) const {
 
     database::ExtrinsicInsert(db.get(), step_id, extrinsic);
     database::GravityInsert(db.get(), step_id, gravity_w);
+    if (debug) {
+        database::SolverMetricsInsert(db.get(), step_id, ToSolverMetrics(debug->solver_summary));
+    }
 
     // Diagnostic output.
     ImuErrors const errors{optimization::EvaluateImuError(imu_data_, extrinsic, gravity_w, *spline_)};
     database::ImuErrorsInsert(db.get(), step_id, imu_data_id_, imu_id_, errors);
+
+    return progress.StoppedEarly() ? ExecuteStatus::StoppedEarly : ExecuteStatus::Complete;
 }
 
 }  // namespace reprojection::steps
@@ -1,10 +1,19 @@
 #include "optimization/extrinsic_optimization.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "database/artifact_cache.hpp"
 #include "database/calibration_database.hpp"
 #include "hashing/hashing.hpp"
 #include "logging/fmt.hpp"
 #include "logging/logging.hpp"
+#include "optimization/solver_strategy.hpp"
 #include "steps/extrinsic_optimization.hpp"
+#include "steps/solver_progress_writer.hpp"
+#include "types/ceres_types.hpp"
 
 // ERROR(Jack): We really really need to test this step! It is just so complicated and I got lazy during a the huge
 // workflow refactor.
@@ -21,26 +30,34 @@ auto const log{logging::Get("steps")};
 
 ExtrinsicOptimization::ExtrinsicOptimization(AssetId const camera_id, AssetId const imu_id, StepId const targets_id,
                                              StepId const imu_data_id, int const num_threads,
-                                             StepId const camera_info_id, StepId const intrinsic_id,
-                                             StepId const spline_id, StepId const extrinsic_init_id, SqlitePtr const db)
+                                             std::optional<double> const time_budget_s,
+                                             std::optional<int> const imu_samples_per_segment,
+                                             std::optional<double> const window_s,
+                                             std::optional<int> const spline_levels, StepId const camera_info_id,
+                                             StepId const intrinsic_id, StepId const spline_id,
+                                             StepId const extrinsic_init_id, SqlitePtr const db)
     : camera_id_{camera_id},
       imu_id_{imu_id},
       targets_id_{targets_id},
-      targets_{database::ExtractedTargetsSelect(db.get(), targets_id, camera_id)},
+      targets_{database::CachedExtractedTargetsSelect(db.get(), targets_id, camera_id)},
       imu_data_id_{imu_data_id},
       imu_data_{database::ImuDataSelect(db.get(), imu_data_id, imu_id)},
-      num_threads_{num_threads} {
+      num_threads_{num_threads},
+      time_budget_s_{time_budget_s},
+      imu_samples_per_segment_{imu_samples_per_segment},
+      window_s_{window_s},
+      spline_levels_{spline_levels} {
     // TODO(Jack): Is there not a better "looking" way to load values from the databases? Nothing technically wrong
     // here, I think the higher level problem is that the extrinsic optimization depends on so much information that we
     // need load so many things regardless of how it looks/works.
-    if (auto const camera_info{database::CameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
+    if (auto const camera_info{database::CachedCameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
         camera_info_ = *camera_info;
     } else {
         log->error("{}", camera_info.error());
         std::exit(1);  // LCOV_EXCL_LINE
     }
 
-    if (auto const intrinsics{database::IntrinsicSelect(db.get(), intrinsic_id, camera_id)}) {
+    if (auto const intrinsics{database::CachedIntrinsicSelect(db.get(), intrinsic_id, camera_id)}) {
         intrinsics_ = *intrinsics;
     } else {
         log->error("{}", intrinsics.error());
@@ -72,14 +89,57 @@ ExtrinsicOptimization::ExtrinsicOptimization(AssetId const camera_id, AssetId co
 }
 
 Hash ExtrinsicOptimization::CacheKey() const {
-    return hashing::HashArguments(camera_info_, targets_, intrinsics_, imu_data_, spline_->ControlPoints(),
-                                  spline_->GetTimeHandler().t0_ns_, spline_->GetTimeHandler().delta_t_ns_, extrinsic_,
-                                  gravity_);
+    spline::TimeHandler const& time_handler{spline_->GetTimeHandler()};
+    std::optional<std::vector<std::uint64_t>> const knots_ns{
+        time_handler.IsUniform() ? std::nullopt : std::optional{time_handler.knots_ns_}};
+
+    optimization::SolverOverride const solver_override{
+        optimization::GetSolverOverride(optimization::SolverProblem::ExtrinsicOptimization)};
+
+    return hashing::HashArguments(camera_info_, *targets_, intrinsics_, imu_data_, spline_->ControlPoints(),
+                                  time_handler.t0_ns_, time_handler.delta_t_ns_, extrinsic_, gravity_,
+                                  hashing::OptionalKeyPart(imu_samples_per_segment_, "imu_samples_per_segment"),
+                                  hashing::OptionalKeyPart(window_s_, "window_s"),
+                                  hashing::OptionalKeyPart(spline_levels_, "spline_levels"),
+                                  hashing::OptionalKeyPart(knots_ns, "knots_ns"), optimization::solver_strategy_key,
+                                  hashing::OptionalKeyPart(solver_override.linear_solver, "linear_solver"),
+                                  hashing::OptionalKeyPart(solver_override.preconditioner, "preconditioner"));
 }
 
-void ExtrinsicOptimization::Execute(StepId step_id, SqlitePtr const db) const {
-    auto const [optimized_spline, optimized_extrinsic, optimized_gravity]{optimization::ExtrinsicOptimization(
-        imu_data_, *spline_, extrinsic_, gravity_, camera_info_, targets_, intrinsics_, num_threads_)};
+ExecuteStatus ExtrinsicOptimization::Execute(StepId step_id, SqlitePtr const db) const {
+    SolverProgressWriter progress_writer{step_id, db};
+    optimization::SolverProgress progress{progress_writer.ProgressOptions(time_budget_s_)};
+    auto const [optimized_spline, optimized_extrinsic, optimized_gravity, debug]{[&]() {
+        if (window_s_) {
+            if (spline_levels_) {
+                log->warn("{{'step_id': {}, 'spline_levels': 'ignored, the sliding window is used'}}", step_id.value);
+            }
+            // NOTE(Jack): Rounded to whole control points, and never smaller than the minimum window.
+            double const delta_t_s{spline_->GetTimeHandler().delta_t_ns_ / 1e9};
+            int const window_size{std::max(2 * spline::K, static_cast<int>(std::lround(*window_s_ / delta_t_s)))};
+            return optimization::SlidingWindowExtrinsicOptimization(imu_data_, *spline_, extrinsic_, gravity_,
+                                                                    camera_info_, *targets_, intrinsics_,
+                                                                    imu_samples_per_segment_, window_size,
+                                                                    num_threads_, &progress);
+        }
+
+        // NOTE(Jack): The knot insertion behind the coarse-to-fine refinement only works on uniform knots.
+        if (spline_levels_ and not spline_->GetTimeHandler().IsUniform()) {
+            log->warn("{{'step_id': {}, 'spline_levels': 'ignored, the spline has non-uniform knots'}}", step_id.value);
+        } else if (spline_levels_) {
+            return optimization::CoarseToFineExtrinsicOptimization(imu_data_, *spline_, extrinsic_, gravity_,
+                                                                   camera_info_, *targets_, intrinsics_,
+                                                                   imu_samples_per_segment_, *spline_levels_,
+                                                                   num_threads_, &progress);
+        }
+
+        return optimization::ExtrinsicOptimization(imu_data_, *spline_, extrinsic_, gravity_, camera_info_, *targets_,
+                                                   intrinsics_, imu_samples_per_segment_, num_threads_, &progress);
+    }()};
+    progress_writer.Stop();
+    if (auto const early_stop{progress.StoppedEarly()}) {
+        log->warn("{{'step_id': {}, 'early_stop': '{}'}}", step_id.value, ToString(*early_stop));
+    }
 
     // TODO(Jack): We also need a way to log the final and initial costs!
     Array3d const optimized_gravity_fmt{optimized_gravity[0], optimized_gravity[1], optimized_gravity[2]};
@@ -91,10 +151,11 @@ void ExtrinsicOptimization::Execute(StepId step_id, SqlitePtr const db) const {
     database::ControlPointsInsert(db.get(), step_id, camera_id_, optimized_spline.ControlPoints());
     database::ExtrinsicInsert(db.get(), step_id, optimized_extrinsic);
     database::GravityInsert(db.get(), step_id, optimized_gravity);
+    database::SolverMetricsInsert(db.get(), step_id, ToSolverMetrics(debug.solver_summary));
 
     // Diagnostic output - reprojection errors
     auto const [spline_poses, reprojection_errors]{
-        optimization::ReprojectionErrorSpline(camera_info_, targets_, intrinsics_, optimized_spline)};
+        optimization::ReprojectionErrorSpline(camera_info_, *targets_, intrinsics_, optimized_spline)};
     database::CameraPosesInsert(db.get(), step_id, targets_id_, camera_id_, spline_poses);
     database::ReprojectionErrorsInsert(db.get(), step_id, targets_id_, camera_id_, reprojection_errors);
 
@@ -102,6 +163,8 @@ void ExtrinsicOptimization::Execute(StepId step_id, SqlitePtr const db) const {
     ImuErrors const imu_errors{
         optimization::EvaluateImuError(imu_data_, optimized_extrinsic, optimized_gravity, optimized_spline)};
     database::ImuErrorsInsert(db.get(), step_id, imu_data_id_, imu_id_, imu_errors);
+
+    return progress.StoppedEarly() ? ExecuteStatus::StoppedEarly : ExecuteStatus::Complete;
 }
 
 // LCOV_EXCL_STOP
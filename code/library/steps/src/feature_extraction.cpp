@@ -1,5 +1,12 @@
 #include "steps/feature_extraction.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "concurrency/thread_budget.hpp"
 #include "database/calibration_database.hpp"
 #include "feature_extraction/target_extraction.hpp"
 #include "hashing/hashing.hpp"
@@ -12,14 +19,30 @@ namespace {
 
 auto const log{logging::Get("steps")};
 
+// NOTE(Jack): The number of images which are loaded from the database and extracted at once. This bounds the memory
+// use independent of the dataset size, while still giving every thread several frames to work on per batch.
+constexpr std::size_t image_batch_size{128};
+
+cv::Mat Decode(ImageBuffer const& buffer, StepId const step_id, AssetId const camera_id) {
+    cv::Mat const img{cv::imdecode(buffer.data, cv::IMREAD_UNCHANGED)};
+    if (img.empty()) {
+        // LCOV_EXCL_START
+        log->error("{{'step_id': {}, 'asset_id': {}, 'msg': 'Attempted to decode image but result was empty.'}}",
+                   step_id.value, camera_id.value);
+        // LCOV_EXCL_STOP
+    }
+
+    return img;
 }
 
+}  // namespace
+
 FeatureExtraction::FeatureExtraction(AssetId const camera_id, StepId const image_loading_id, bool const show_extraction,
                                      StepId const target_info_id, AssetId const target_id, SqlitePtr const db)
     : camera_id_{camera_id},
       image_loading_id_{image_loading_id},
       show_extraction_{show_extraction},
-      images_{std::make_shared<EncodedImages>(database::ImagesSelect(db.get(), image_loading_id, camera_id))} {
+      image_sizes_{database::ImageSizesSelect(db.get(), image_loading_id, camera_id)} {
     if (auto const target_info{database::TargetInfoSelect(db.get(), target_info_id, target_id)}) {
         target_info_ = *target_info;
     } else {
@@ -30,42 +53,99 @@ FeatureExtraction::FeatureExtraction(AssetId const camera_id, StepId const image
 
 Hash FeatureExtraction::CacheKey() const {
     // TODO(Jack): We should not strictly need the camera_id_ here as part of they key because the target info and
-    // images_ should uniquely identify the feature extraction. However a problem arises when we have artifically
-    // triggered cache hits (for example in the benchmark testing) Where the images_ are empty and that causes the
+    // images should uniquely identify the feature extraction. However a problem arises when we have artifically
+    // triggered cache hits (for example in the benchmark testing) Where the images are empty and that causes the
     // cache key to no longer be unique across different cameras. To prevent this we added the asset id. If this is
     // really a good way to solve this is unclear. The problem I see is that the asset id is not some universal
     // "forever" identifier, and therefore its use here seems like it might causes problems down the line.
-    return hashing::HashArguments(camera_id_.value, show_extraction_, target_info_, *images_);
+    return hashing::HashArguments(camera_id_.value, show_extraction_, target_info_, image_sizes_,
+                                  feature_extraction::extractor_version_key);
+}
+
+Hash FeatureExtraction::ExtractionCacheKey(TargetInfo const& target_info) {
+    return hashing::HashArguments(target_info, feature_extraction::extractor_version_key);
 }
 
-// TODO(Jack): We really need to split the visualization logic from the core computation!
 // NOTE(Jack): The unit tests and CI pipeline run headless which means that we cannot get the GUI show feature
 // extraction code path unit tested and covered.
 void FeatureExtraction::Execute(StepId const step_id, SqlitePtr const db) const {
-    auto const extractor{feature_extraction::CreateTargetExtractor(target_info_)};
-
-    CameraMeasurements extracted_targets;
-    for (auto const& [timestamp_ns, buffer] : *images_) {
-        cv::Mat const img{cv::imdecode(buffer.data, cv::IMREAD_UNCHANGED)};
-        if (img.empty()) {
-            log->error(  // LCOV_EXCL_LINE
-                "{{'step_id': {}, 'asset_id': {}, 'msg': 'Attempted to decode image but result was empty.'}}",  // LCOV_EXCL_LINE
-                step_id.value, camera_id_.value);  // LCOV_EXCL_LINE
+    // NOTE(Jack): The per-frame cache is independent of the step cache key. When a dataset is appended to or some of
+    // its images are edited the step cache key changes, but we only need to run the extraction for the images we have
+    // not seen before with this target. The cache holds the targets of every dataset still processed with this target,
+    // so we only look up the images of the current batch.
+    Hash const target_key{ExtractionCacheKey(target_info_)};
+
+    struct FrameExtraction {
+        uint64_t timestamp_ns;
+        ImageBuffer const* buffer;
+        Hash image_key;
+        std::optional<ExtractedTarget> target;
+    };
+
+    // NOTE(Jack): The images are processed one batch at a time and the results of each batch are written before the
+    // next batch is loaded, therefore only one batch of images is in memory at any time.
+    bool show_extraction{show_extraction_};
+    std::size_t num_extracted{0};
+    std::size_t num_cached{0};
+    int num_threads{0};
+    database::SelectCursor<EncodedImages> cursor{db.get(), &database::ImagesSelect, image_loading_id_, camera_id_,
+                                                 image_batch_size};
+    for (EncodedImages images{cursor.Next()}; not images.empty(); images = cursor.Next()) {
+        std::vector<Hash> image_keys;
+        image_keys.reserve(std::size(images));
+        for (auto const& [_, buffer] : images) {
+            image_keys.push_back(hashing::HashContent(buffer));
         }
+        auto const cache{database::ExtractionCacheSelect(db.get(), target_key, image_keys)};
 
-        std::optional<ExtractedTarget> const target{extractor->Extract(img)};
-        if (target.has_value()) {
-            extracted_targets.insert({timestamp_ns, *target});  // LCOV_EXCL_LINE
+        std::vector<FrameExtraction> frames;
+        std::vector<std::size_t> cache_misses;
+        frames.reserve(std::size(images));
+        for (auto const& [timestamp_ns, buffer] : images) {
+            Hash const& image_key{image_keys[std::size(frames)]};
+            if (auto const cached{cache.find(image_key.value)}; cached != std::cend(cache)) {
+                frames.push_back({timestamp_ns, &buffer, image_key, cached->second});
+            } else {
+                cache_misses.push_back(std::size(frames));
+                frames.push_back({timestamp_ns, &buffer, image_key, std::nullopt});
+            }
         }
 
-        // LCOV_EXCL_START
-        if (show_extraction_) {
-            if (target.has_value()) {
-                feature_extraction::DrawTarget(*target, img);
+        // NOTE(Jack): The extractors are not thread safe (the apriltag detector for example keeps state between
+        // calls), therefore every chunk gets its own extractor. The chunks interleave so that a run of hard frames (ex.
+        // the target is partially out of view for a while) is spread over all threads. Every result is written to its
+        // own frame, so the result does not depend on the order the chunks run in.
+        int const num_chunks{std::min(static_cast<int>(std::size(cache_misses)), concurrency::ThreadLimit())};
+        concurrency::SharedThreadPool().ParallelFor(num_chunks, [&](int const chunk) {
+            auto const extractor{feature_extraction::CreateTargetExtractor(target_info_)};
+            for (std::size_t i{static_cast<std::size_t>(chunk)}; i < std::size(cache_misses); i += num_chunks) {
+                FrameExtraction& frame{frames[cache_misses[i]]};
+                frame.target = extractor->Extract(Decode(*frame.buffer, step_id, camera_id_));
+            }
+        });
+
+        CameraMeasurements extracted_targets;
+        for (auto const& frame : frames) {
+            if (frame.target.has_value()) {
+                extracted_targets.insert({frame.timestamp_ns, *frame.target});
             }
+        }
+
+        std::vector<std::pair<Hash, std::optional<ExtractedTarget>>> new_cache_entries;
+        for (auto const i : cache_misses) {
+            new_cache_entries.push_back({frames[i].image_key, frames[i].target});
+        }
 
-            // TODO(Jack): Here we are giving the GUI image displayer the possibility to end the feature extraction, is
-            // that really an interaction/power we want this code to have?
+        database::ExtractionCacheInsert(db.get(), target_key, new_cache_entries);
+        database::ExtractionCacheUsesInsert(db.get(), step_id, target_key, image_keys);
+        database::ExtractedTargetsInsert(db.get(), step_id, image_loading_id_, camera_id_, extracted_targets);
+
+        num_extracted += std::size(cache_misses);
+        num_cached += std::size(frames) - std::size(cache_misses);
+        num_threads = std::max(num_threads, num_chunks);
+
+        // LCOV_EXCL_START
+        if (show_extraction) {
             // TODO(Jack): Right now if the user requests showing the extraction but there is no available GUI we will
             // just crash here. We might want to wrap the window visualizer in a little class with a factory function,
             // and then log to the user a warning if they requested visualization but here is no gui device.
@@ -73,15 +153,29 @@ void FeatureExtraction::Execute(StepId const step_id, SqlitePtr const db) const
                 std::make_unique<image_viewer::OpenCvGuiInterface>("Target Feature Extraction"),
                 std::make_unique<image_viewer::OpenCvKeyboardInput>());
 
-            viewer.Show(img);
-            if (viewer.ShouldQuit()) {
-                break;
+            for (auto const& frame : frames) {
+                cv::Mat const img{Decode(*frame.buffer, step_id, camera_id_)};
+                if (frame.target.has_value()) {
+                    feature_extraction::DrawTarget(*frame.target, img);
+                }
+
+                viewer.Show(img);
+                if (viewer.ShouldQuit()) {
+                    show_extraction = false;
+                    break;
+                }
             }
         }
         // LCOV_EXCL_STOP
     }
 
-    database::ExtractedTargetsInsert(db.get(), step_id, image_loading_id_, camera_id_, extracted_targets);
+    // NOTE(Jack): The previous extraction step of this workflow was already deleted when this step replaced it, so the
+    // entries of images which are no longer part of the dataset are now unused. The entries of the other datasets stay,
+    // they are used by the extraction steps of their own workflows.
+    database::DeleteUnusedExtractionCache(db.get());
+
+    log->info("{{'step_id': {}, 'asset_id': {}, 'extracted_frames': {}, 'cached_frames': {}, 'num_threads': {}}}",
+              step_id.value, camera_id_.value, num_extracted, num_cached, num_threads);
 }
 
 }  // namespace reprojection::steps
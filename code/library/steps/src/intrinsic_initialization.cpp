@@ -1,10 +1,12 @@
 #include "steps/intrinsic_initialization.hpp"
 
 #include "calibration/initialization_methods.hpp"
+#include "database/artifact_cache.hpp"
 #include "database/calibration_database.hpp"
 #include "hashing/hashing.hpp"
 #include "logging/fmt.hpp"
 #include "logging/logging.hpp"
+#include "optimization/solver_strategy.hpp"
 
 namespace reprojection::steps {
 
@@ -18,21 +20,30 @@ IntrinsicInitialization::IntrinsicInitialization(AssetId const camera_id, int co
                                                  StepId const camera_info_id, StepId const targets_id,
                                                  SqlitePtr const db)
     : camera_id_{camera_id}, num_threads_{num_threads} {
-    if (auto const camera_info{database::CameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
+    if (auto const camera_info{database::CachedCameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
         camera_info_ = *camera_info;
     } else {
         log->error("{}", camera_info.error());  // LCOV_EXCL_LINE
         std::exit(1);                           // LCOV_EXCL_LINE
     }  // LCOV_EXCL_LINE
 
-    targets_ = database::ExtractedTargetsSelect(db.get(), targets_id, camera_id);
+    targets_ = database::CachedExtractedTargetsSelect(db.get(), targets_id, camera_id);
 }
 
-Hash IntrinsicInitialization::CacheKey() const { return hashing::HashArguments(camera_info_, targets_); }
+// NOTE(Jack): The intrinsic candidates are compared with bundle adjustments, so the bundle adjustment solver override
+// is part of the key.
+Hash IntrinsicInitialization::CacheKey() const {
+    optimization::SolverOverride const solver_override{
+        optimization::GetSolverOverride(optimization::SolverProblem::BundleAdjustment)};
+
+    return hashing::HashArguments(camera_info_, *targets_, optimization::solver_strategy_key,
+                                  hashing::OptionalKeyPart(solver_override.linear_solver, "linear_solver"),
+                                  hashing::OptionalKeyPart(solver_override.preconditioner, "preconditioner"));
+}
 
 void IntrinsicInitialization::Execute(StepId const step_id, SqlitePtr const db) const {
     auto const intrinsics{calibration::InitializeIntrinsics(camera_info_.camera_model, camera_info_.bounds.v_max,
-                                                            camera_info_.bounds.u_max, targets_, num_threads_)};
+                                                            camera_info_.bounds.u_max, *targets_, num_threads_)};
     if (not intrinsics.has_value()) {
         log->error("{{'step_id': {}, 'asset_id': {}, 'msg': 'Failed to initialize intrinsics.'}}",  // LCOV_EXCL_LINE
                    step_id.value, camera_id_.value);                                                // LCOV_EXCL_LINE
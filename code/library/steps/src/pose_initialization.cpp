@@ -2,6 +2,7 @@
 #include "steps/pose_initialization.hpp"
 
 #include "calibration/initialization_methods.hpp"
+#include "database/artifact_cache.hpp"
 #include "database/calibration_database.hpp"
 #include "hashing/hashing.hpp"
 #include "logging/logging.hpp"
@@ -15,19 +16,20 @@ auto const log{logging::Get("steps")};
 
 }
 
-PoseInitialization::PoseInitialization(AssetId camera_id, StepId targets_id, StepId camera_info_id,
-                                       StepId intrinsics_id, SqlitePtr const db)
+PoseInitialization::PoseInitialization(AssetId camera_id, StepId targets_id, bool const sequential,
+                                       StepId camera_info_id, StepId intrinsics_id, SqlitePtr const db)
     : camera_id_{camera_id},
       targets_id_{targets_id},
-      targets_{database::ExtractedTargetsSelect(db.get(), targets_id, camera_id)} {
-    if (auto const camera_info{database::CameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
+      targets_{database::CachedExtractedTargetsSelect(db.get(), targets_id, camera_id)},
+      sequential_{sequential} {
+    if (auto const camera_info{database::CachedCameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
         camera_info_ = *camera_info;
     } else {
         log->error("{}", camera_info.error());  // LCOV_EXCL_LINE
         std::exit(1);                           // LCOV_EXCL_LINE
     }  // LCOV_EXCL_LINE
 
-    if (auto const intrinsics{database::IntrinsicSelect(db.get(), intrinsics_id, camera_id)}) {
+    if (auto const intrinsics{database::CachedIntrinsicSelect(db.get(), intrinsics_id, camera_id)}) {
         intrinsics_ = *intrinsics;
     } else {
         log->error("{}", intrinsics.error());  // LCOV_EXCL_LINE
@@ -35,19 +37,28 @@ PoseInitialization::PoseInitialization(AssetId camera_id, StepId targets_id, Ste
     }
 }
 
-Hash PoseInitialization::CacheKey() const { return hashing::HashArguments(targets_, camera_info_, intrinsics_); }
+Hash PoseInitialization::CacheKey() const {
+    return hashing::HashArguments(*targets_, camera_info_, intrinsics_,
+                                  hashing::OptionalKeyPart(sequential_, "sequential"));
+}
 
 void PoseInitialization::Execute(StepId step_id, SqlitePtr const db) const {
-    Frames const camera_poses{calibration::PoseInitialization(camera_info_, targets_, intrinsics_)};
+    auto const [camera_poses, num_dlt_fallbacks]{
+        calibration::PoseInitialization(camera_info_, *targets_, intrinsics_, sequential_)};
 
     log->info("{{'step_id': {}, 'asset_id': {}, 'num_targets': '{}', 'num_poses: {}}}}}", step_id.value,
-              camera_id_.value, std::size(targets_), std::size(camera_poses));
+              camera_id_.value, std::size(*targets_), std::size(camera_poses));
+    if (sequential_) {
+        // NOTE(Jack): Many fallbacks mean that the camera does not move smoothly enough between the frames for the
+        // sequential mode to pay off.
+        log->info("{{'step_id': {}, 'sequential': true, 'num_dlt_fallbacks': {}}}", step_id.value, num_dlt_fallbacks);
+    }
 
     database::CameraPosesInsert(db.get(), step_id, targets_id_, camera_id_, camera_poses);
 
     // Diagnostic output
     OptimizationState const state{intrinsics_, camera_poses};
-    ReprojectionErrors const errors{optimization::ReprojectionError(camera_info_, targets_, state)};
+    ReprojectionErrors const errors{optimization::ReprojectionError(camera_info_, *targets_, state)};
     database::ReprojectionErrorsInsert(db.get(), step_id, targets_id_, camera_id_, errors);
 }
 
@@ -0,0 +1,83 @@
+#include "steps/solver_progress_writer.hpp"
+
+#include <exception>
+#include <utility>
+
+#include "database/calibration_database.hpp"
+#include "logging/logging.hpp"
+
+namespace reprojection::steps {
+
+namespace {
+
+auto const log{logging::Get("steps")};
+
+}
+
+SolverProgressWriter::SolverProgressWriter(StepId const step_id, SqlitePtr const db,
+                                           std::chrono::milliseconds const flush_interval)
+    : step_id_{step_id},
+      db_{db},
+      flush_interval_{flush_interval},
+      writer_{[this](std::stop_token const stop_token) {
+          while (not stop_token.stop_requested()) {
+              {
+                  std::unique_lock lock{mutex_};
+                  condition_.wait_for(lock, stop_token, flush_interval_, [] { return false; });
+              }
+              Flush();
+          }
+      }} {}
+
+SolverProgressWriter::~SolverProgressWriter() { Stop(); }
+
+optimization::SolverProgressOptions SolverProgressWriter::ProgressOptions(std::optional<double> const time_budget_s) {
+    return {{},
+            time_budget_s,
+            [this](SolverIteration const& iteration) { Push(iteration); },
+            [this](SolverSnapshot const& snapshot) { Push(snapshot); }};
+}
+
+void SolverProgressWriter::Push(SolverIteration const& iteration) {
+    std::lock_guard const lock{mutex_};
+    iterations_.push_back(iteration);
+}
+
+void SolverProgressWriter::Push(SolverSnapshot const& snapshot) {
+    std::lock_guard const lock{mutex_};
+    snapshot_ = snapshot;
+}
+
+void SolverProgressWriter::Stop() {
+    if (writer_.joinable()) {
+        writer_.request_stop();
+        writer_.join();
+    }
+
+    // Whatever was pushed after the last flush of the writer thread.
+    Flush();
+}
+
+void SolverProgressWriter::Flush() {
+    std::vector<SolverIteration> iterations;
+    std::optional<SolverSnapshot> snapshot;
+    {
+        std::lock_guard const lock{mutex_};
+        std::swap(iterations, iterations_);
+        std::swap(snapshot, snapshot_);
+    }
+
+    // NOTE(Jack): The progress is only a diagnostic, therefore a failed write should not take down the optimization.
+    try {
+        if (not iterations.empty()) {
+            database::SolverIterationsInsert(db_.get(), step_id_, iterations);
+        }
+        if (snapshot) {
+            database::SolverSnapshotInsert(db_.get(), step_id_, *snapshot);
+        }
+    } catch (std::exception const& e) {                                                     // LCOV_EXCL_LINE
+        log->warn("{{'step_id': {}, 'solver_progress_error': '{}'}}", step_id_.value, e.what());  // LCOV_EXCL_LINE
+    }  // LCOV_EXCL_LINE
+}
+
+}  // namespace reprojection::steps
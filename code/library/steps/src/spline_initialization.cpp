@@ -1,11 +1,13 @@
 #include "spline/spline_initialization.hpp"
 
 #include "calibration/calibration_utils.hpp"
+#include "database/artifact_cache.hpp"
 #include "database/calibration_database.hpp"
 #include "geometry/lie.hpp"
 #include "hashing/hashing.hpp"
 #include "logging/logging.hpp"
 #include "optimization/extrinsic_optimization.hpp"
+#include "optimization/solver_strategy.hpp"
 #include "spline/se3_spline.hpp"
 #include "steps/spline_initialization.hpp"
 
@@ -15,23 +17,28 @@ namespace {
 
 auto const log{logging::Get("steps")};
 
+int constexpr default_knot_frequency_hz{100};
+
 }
 
 SplineInitialization::SplineInitialization(AssetId const camera_id, StepId const camera_poses_id,
                                            StepId const targets_id, StepId const camera_info_id,
-                                           StepId const intrinsics_id, SqlitePtr const db)
+                                           StepId const intrinsics_id, std::optional<int> const knot_frequency_hz,
+                                           std::optional<int> const min_knot_frequency_hz, SqlitePtr const db)
     : camera_id_{camera_id},
       camera_poses_{database::CameraPosesSelect(db.get(), camera_poses_id, camera_id)},
+      knot_frequency_hz_{knot_frequency_hz},
+      min_knot_frequency_hz_{min_knot_frequency_hz},
       targets_id_{targets_id},
-      targets_{database::ExtractedTargetsSelect(db.get(), targets_id, camera_id)} {
-    if (auto const camera_info{database::CameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
+      targets_{database::CachedExtractedTargetsSelect(db.get(), targets_id, camera_id)} {
+    if (auto const camera_info{database::CachedCameraInfoSelect(db.get(), camera_info_id, camera_id)}) {
         camera_info_ = *camera_info;
     } else {
         log->error("{}", camera_info.error());  // LCOV_EXCL_LINE
         std::exit(1);                           // LCOV_EXCL_LINE
     }  // LCOV_EXCL_LINE
 
-    if (auto const intrinsics{database::IntrinsicSelect(db.get(), intrinsics_id, camera_id)}) {
+    if (auto const intrinsics{database::CachedIntrinsicSelect(db.get(), intrinsics_id, camera_id)}) {
         intrinsics_ = *intrinsics;
     } else {
         log->error("{}", intrinsics.error());  // LCOV_EXCL_LINE
@@ -40,7 +47,14 @@ SplineInitialization::SplineInitialization(AssetId const camera_id, StepId const
 }
 
 Hash SplineInitialization::CacheKey() const {
-    return hashing::HashArguments(camera_poses_, targets_, camera_info_, intrinsics_);
+    // NOTE(Jack): The knot frequency has no name in the key, so that the keys of uniform splines stay the same as before
+    // the minimum knot frequency was added. The minimum is named, otherwise for example 12 and 5 would give the same key
+    // as a uniform spline at 125 hz. The spline initialization itself does not solve anything, but the solver strategy
+    // is part of its key so that the whole spline chain is recomputed when the automatic selection changes.
+    return hashing::HashArguments(camera_poses_, *targets_, camera_info_, intrinsics_,
+                                  hashing::OptionalKeyPart(knot_frequency_hz_),
+                                  hashing::OptionalKeyPart(min_knot_frequency_hz_, "min_knot_frequency_hz"),
+                                  optimization::solver_strategy_key);
 }
 
 void SplineInitialization::Execute(StepId const step_id, SqlitePtr const db) const {
@@ -54,22 +68,29 @@ void SplineInitialization::Execute(StepId const step_id, SqlitePtr const db) con
         invert_frames.insert({timestamp_ns, {geometry::Log(geometry::Exp(frame_i.pose).inverse())}});
     }
 
-    // TODO(Jack): Parameterize frequency! Add to cache key probably?
-    spline::Se3Spline const spline{spline::InitializeSe3SplineState(invert_frames, 100)};
+    int const knot_frequency_hz{knot_frequency_hz_.value_or(default_knot_frequency_hz)};
+    spline::Se3Spline const spline{[&]() {
+        if (min_knot_frequency_hz_) {
+            return spline::InitializeSe3SplineState(
+                invert_frames, spline::AdaptiveKnots(invert_frames, *min_knot_frequency_hz_, knot_frequency_hz));
+        }
+
+        return spline::InitializeSe3SplineState(invert_frames, knot_frequency_hz);
+    }()};
 
     // TODO(Jack): Should we print out the time handler in more practical units than nanoseconds?
     log->info(
         "{{'step_id': {}, 'asset_id': {}, 'num_control_points': {}, 'time_handler': {{'t0_ns': {}, 'delta_t_ns': "
-        "{}}}}}",
+        "{}, 'uniform': {}}}}}",
         step_id.value, camera_id_.value, spline.Size(), spline.GetTimeHandler().t0_ns_,
-        spline.GetTimeHandler().delta_t_ns_);
+        spline.GetTimeHandler().delta_t_ns_, spline.GetTimeHandler().IsUniform());
 
     database::ControlPointsInsert(db.get(), step_id, camera_id_, spline.ControlPoints());
     database::SplineInfoInsert(db.get(), step_id, camera_id_, spline.GetTimeHandler());
 
     // Diagnostic output
     auto const [spline_poses,
-                errors]{optimization::ReprojectionErrorSpline(camera_info_, targets_, intrinsics_, spline)};
+                errors]{optimization::ReprojectionErrorSpline(camera_info_, *targets_, intrinsics_, spline)};
     database::CameraPosesInsert(db.get(), step_id, targets_id_, camera_id_, spline_poses);
     database::ReprojectionErrorsInsert(db.get(), step_id, targets_id_, camera_id_, errors);
 }
@@ -0,0 +1,81 @@
+#include "steps/step_metrics.hpp"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace reprojection::steps {
+
+namespace {
+
+double CpuTimeS(rusage const& usage) {
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+rusage ResourceUsage() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage;
+}
+
+// Returns zero if the thread count is not available, for example if we are not on linux and there is no /proc.
+int CurrentNumThreads() {
+    std::ifstream status{"/proc/self/status"};
+    std::string key;
+    while (status >> key) {
+        if (key == "Threads:") {
+            int num_threads{0};
+            status >> num_threads;
+
+            return num_threads;
+        }
+    }
+
+    return 0;  // LCOV_EXCL_LINE
+}
+
+}  // namespace
+
+StepMetricsRecorder::StepMetricsRecorder()
+    : wall_start_{std::chrono::steady_clock::now()},
+      cpu_start_s_{CpuTimeS(ResourceUsage())},
+      peak_rss_start_kb_{ResourceUsage().ru_maxrss},
+      peak_num_threads_{CurrentNumThreads()},
+      sampler_{[this](std::stop_token const stop_token) {
+          std::mutex mutex;
+          std::condition_variable_any condition;
+
+          std::unique_lock lock{mutex};
+          while (not stop_token.stop_requested()) {
+              // The sampler thread itself is also counted, so we remove it here.
+              // NOTE(Jack): This thread is the only writer, so there is no race between the load and the store.
+              int const num_threads{CurrentNumThreads() - 1};
+              if (num_threads > peak_num_threads_.load()) {
+                  peak_num_threads_.store(num_threads);
+              }
+
+              condition.wait_for(lock, stop_token, std::chrono::milliseconds(5), [] { return false; });
+          }
+      }} {}
+
+StepMetrics StepMetricsRecorder::Stop(CacheStatus const cache_status) {
+    if (sampler_.joinable()) {
+        sampler_.request_stop();
+        sampler_.join();
+    }
+
+    rusage const usage{ResourceUsage()};
+    double const wall_time_s{std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start_).count()};
+
+    // NOTE(Jack): On linux ru_maxrss is in kilobytes (on macos it is in bytes, but we do not support that anyway).
+    return {cache_status, wall_time_s, CpuTimeS(usage) - cpu_start_s_, usage.ru_maxrss - peak_rss_start_kb_,
+            std::max(peak_num_threads_.load(), CurrentNumThreads())};
+}
+
+}  // namespace reprojection::steps
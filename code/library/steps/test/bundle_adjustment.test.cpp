@@ -4,6 +4,7 @@
 
 #include <ranges>
 
+#include "optimization/solver_strategy.hpp"
 #include "steps/step_runner.hpp"
 #include "testing_mocks/data_generators.hpp"
 #include "testing_utilities/constants.hpp"
@@ -37,7 +38,8 @@ class BundleAdjustmentFixture : public StepTestFixture {
 };
 
 TEST_F(BundleAdjustmentFixture, TestBundleAdjustmentStepRunner) {
-    steps::BundleAdjustment const step{camera_id_, targets_id_, 1, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    steps::BundleAdjustment const step{
+        camera_id_, targets_id_, 1, std::nullopt, false, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
     StepId const step_id{RunStep<steps::BundleAdjustment>(workflow_id_, step, db_)};
 
     auto const result{database::CameraPosesSelect(db_.get(), step_id, camera_id_)};
@@ -46,12 +48,33 @@ TEST_F(BundleAdjustmentFixture, TestBundleAdjustmentStepRunner) {
     auto const result2{database::IntrinsicSelect(db_.get(), step_id, camera_id_)};
     ASSERT_TRUE(result2.has_value());
     EXPECT_TRUE(result2->intrinsics.isApprox(testing_utilities::double_sphere_intrinsics));
+
+    auto const result3{database::SolverMetricsSelect(db_.get(), step_id)};
+    ASSERT_TRUE(result3.has_value());
+    EXPECT_LE(result3->final_cost, result3->initial_cost);
+    EXPECT_GT(result3->total_time_s, 0);
+
+    // The progress is written while the optimization runs, iteration zero is the initial state.
+    auto const iterations{database::SolverIterationsSelect(db_.get(), step_id)};
+    ASSERT_FALSE(iterations.empty());
+    EXPECT_EQ(iterations.front().cost, result3->initial_cost);
+
+    auto const snapshots{database::SolverSnapshotsSelect(db_.get(), step_id)};
+    ASSERT_FALSE(snapshots.empty());
+    ASSERT_TRUE(snapshots.back().intrinsics.has_value());
+    EXPECT_TRUE(snapshots.back().intrinsics->second.isApprox(result2->intrinsics));
 }
 
 TEST_F(BundleAdjustmentFixture, TestBundleAdjustmentStep) {
-    steps::BundleAdjustment const step{camera_id_, targets_id_, 1, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    steps::BundleAdjustment const step{
+        camera_id_, targets_id_, 1, std::nullopt, false, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
     EXPECT_EQ(step.Type(), StepType::BundleAdjustment);
-    EXPECT_EQ(step.CacheKey().value, "0dae470cd3c711a1692153ee4ccf969c5e4ccb5da30dbb0df40e2fdac600dc8e");
+
+    // The same inputs give the same key, and it is not the key from before the solver strategy was part of it.
+    steps::BundleAdjustment const same_step{
+        camera_id_, targets_id_, 1, std::nullopt, false, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    EXPECT_EQ(step.CacheKey(), same_step.CacheKey());
+    EXPECT_NE(step.CacheKey().value, "0dae470cd3c711a1692153ee4ccf969c5e4ccb5da30dbb0df40e2fdac600dc8e");
 
     auto const [step_id, _]{database::GetOrCreateStep(db_.get(), StepType::BundleAdjustment, "")};
     EXPECT_NO_THROW(step.Execute(step_id, db_));
@@ -63,3 +86,68 @@ TEST_F(BundleAdjustmentFixture, TestBundleAdjustmentStep) {
     ASSERT_TRUE(result2.has_value());
     EXPECT_TRUE(result2->intrinsics.isApprox(testing_utilities::double_sphere_intrinsics));
 }
+
+TEST_F(BundleAdjustmentFixture, TestBundleAdjustmentWarmStart) {
+    // Without a previous bundle adjustment in the database the warm start changes nothing.
+    steps::BundleAdjustment const cold_step{
+        camera_id_, targets_id_, 1, std::nullopt, true, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    steps::BundleAdjustment const no_warm_start_step{
+        camera_id_, targets_id_, 1, std::nullopt, false, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    EXPECT_EQ(cold_step.CacheKey(), no_warm_start_step.CacheKey());
+
+    // A previous result which only overlaps with the first three frames.
+    StepId const previous_id{database::GetOrCreateStep(db_.get(), StepType::BundleAdjustment, "").first};
+    database::StepCacheKeyUpdate(db_.get(), previous_id, "previous");
+    database::IntrinsicInsert(db_.get(), previous_id, camera_id_, CameraModel::DoubleSphere,
+                              CameraState{1.01 * testing_utilities::double_sphere_intrinsics});
+    Frames const poses{database::CameraPosesSelect(db_.get(), pose_init_id_, camera_id_)};
+    database::CameraPosesInsert(db_.get(), previous_id, targets_id_, camera_id_,
+                                Frames{std::cbegin(poses), std::next(std::cbegin(poses), 3)});
+
+    steps::BundleAdjustment const warm_step{
+        camera_id_, targets_id_, 1, std::nullopt, true, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    EXPECT_NE(warm_step.CacheKey(), cold_step.CacheKey());
+
+    StepId const step_id{RunStep<steps::BundleAdjustment>(workflow_id_, warm_step, db_)};
+    auto const result{database::IntrinsicSelect(db_.get(), step_id, camera_id_)};
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->intrinsics.isApprox(testing_utilities::double_sphere_intrinsics, 1e-3));
+
+    // Running with the same inputs again is a cache hit, even though the most recent result is now the warm started
+    // result itself and not the previous one.
+    steps::BundleAdjustment const repeated_step{
+        camera_id_, targets_id_, 1, std::nullopt, true, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    EXPECT_EQ(repeated_step.CacheKey(), warm_step.CacheKey());
+    EXPECT_EQ(RunStep<steps::BundleAdjustment>(workflow_id_, repeated_step, db_), step_id);
+
+    // A newer result from other inputs seeds the next run differently, so the result above must not be reused.
+    StepId const newer_id{database::GetOrCreateStep(db_.get(), StepType::BundleAdjustment, "").first};
+    database::StepCacheKeyUpdate(db_.get(), newer_id, "newer");
+    database::IntrinsicInsert(db_.get(), newer_id, camera_id_, CameraModel::DoubleSphere,
+                              CameraState{0.99 * testing_utilities::double_sphere_intrinsics});
+    database::CameraPosesInsert(db_.get(), newer_id, targets_id_, camera_id_, poses);
+
+    steps::BundleAdjustment const reseeded_step{
+        camera_id_, targets_id_, 1, std::nullopt, true, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    EXPECT_NE(reseeded_step.CacheKey(), warm_step.CacheKey());
+    EXPECT_NE(RunStep<steps::BundleAdjustment>(workflow_id_, reseeded_step, db_), step_id);
+}
+
+TEST_F(BundleAdjustmentFixture, TestBundleAdjustmentSolverOverride) {
+    steps::BundleAdjustment const step{
+        camera_id_, targets_id_, 1, std::nullopt, false, camera_info_id_, intrinsics_id_, pose_init_id_, db_};
+    Hash const automatic_key{step.CacheKey()};
+
+    // The override is read when the key is calculated, not when the step is constructed.
+    optimization::SetSolverOverride(optimization::SolverProblem::BundleAdjustment, {"DENSE_QR", std::nullopt});
+    Hash const override_key{step.CacheKey()};
+    optimization::SetSolverOverride(optimization::SolverProblem::ExtrinsicOptimization, {"DENSE_QR", std::nullopt});
+    EXPECT_EQ(step.CacheKey(), override_key);
+
+    // Reset so the other tests in this process are not affected.
+    optimization::SetSolverOverride(optimization::SolverProblem::BundleAdjustment, {});
+    optimization::SetSolverOverride(optimization::SolverProblem::ExtrinsicOptimization, {});
+
+    EXPECT_NE(override_key, automatic_key);
+    EXPECT_EQ(step.CacheKey(), automatic_key);
+}
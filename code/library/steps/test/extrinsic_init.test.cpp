@@ -29,7 +29,7 @@ class ExtrinsicInitFixture : public ::testing::Test {
 
 TEST_F(ExtrinsicInitFixture, TestExtrinsicInitStepRunner) {
     WorkflowId const workflow_id{database::GetOrCreateWorkflow(db_.get(), WorkflowType::CamImu, {camera_id_, imu_id_})};
-    steps::ExtrinsicInit const step{camera_id_, spline_id_, imu_id_, imu_data_id_, 1, db_};
+    steps::ExtrinsicInit const step{camera_id_, spline_id_, imu_id_, imu_data_id_, 1, std::nullopt, false, db_};
     StepId const step_id{RunStep<steps::ExtrinsicInit>(workflow_id, step, db_)};
 
     auto const result{database::ExtrinsicSelect(db_.get(), step_id, imu_id_, camera_id_)};
@@ -42,9 +42,14 @@ TEST_F(ExtrinsicInitFixture, TestExtrinsicInitStepRunner) {
 }
 
 TEST_F(ExtrinsicInitFixture, TestExtrinsicInitStep) {
-    steps::ExtrinsicInit const step{camera_id_, spline_id_, imu_id_, imu_data_id_, 1, db_};
+    steps::ExtrinsicInit const step{camera_id_, spline_id_, imu_id_, imu_data_id_, 1, std::nullopt, false, db_};
     EXPECT_EQ(step.Type(), StepType::ExtrinsicInit);
-    EXPECT_EQ(step.CacheKey().value, "d78f7d0b3bf9ef156ed4b8c9c31eaf1fcefb3174b239d1b5e471de80c488bc05");
+
+    // The same inputs give the same key. The closed form rotation has a different key than the old ceres optimization,
+    // so it does not reuse its results.
+    steps::ExtrinsicInit const same_step{camera_id_, spline_id_, imu_id_, imu_data_id_, 1, std::nullopt, false, db_};
+    EXPECT_EQ(step.CacheKey(), same_step.CacheKey());
+    EXPECT_NE(step.CacheKey().value, "d78f7d0b3bf9ef156ed4b8c9c31eaf1fcefb3174b239d1b5e471de80c488bc05");
 
     // Build the actual database step id and execute the step.
     StepId const step_id{database::GetOrCreateStep(db_.get(), StepType::ExtrinsicInit, "").first};
@@ -57,4 +62,23 @@ TEST_F(ExtrinsicInitFixture, TestExtrinsicInitStep) {
     auto const result2{database::GravitySelect(db_.get(), step_id)};
     ASSERT_TRUE(result2.has_value());
     EXPECT_NEAR(result2->norm(), kGravity, 1e-3);  // Heuristic!
+
+    // The closed form rotation alignment is not a ceres optimization.
+    EXPECT_FALSE(database::SolverMetricsSelect(db_.get(), step_id).has_value());
+}
+
+TEST_F(ExtrinsicInitFixture, TestExtrinsicInitStepRefineRotation) {
+    steps::ExtrinsicInit const step{camera_id_, spline_id_, imu_id_, imu_data_id_, 1, std::nullopt, true, db_};
+    steps::ExtrinsicInit const closed_form{camera_id_, spline_id_, imu_id_, imu_data_id_, 1, std::nullopt, false, db_};
+    EXPECT_NE(step.CacheKey(), closed_form.CacheKey());
+
+    StepId const step_id{database::GetOrCreateStep(db_.get(), StepType::ExtrinsicInit, "").first};
+    EXPECT_NO_THROW(step.Execute(step_id, db_));
+
+    auto const result{database::ExtrinsicSelect(db_.get(), step_id, imu_id_, camera_id_)};
+    ASSERT_TRUE(result.has_value());
+    EXPECT_LT(result->se3_a_b.sum(), 0.001);  // Heuristic!
+
+    // Only the refinement is a ceres optimization that has solver metrics.
+    EXPECT_TRUE(database::SolverMetricsSelect(db_.get(), step_id).has_value());
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "hashing/hashing.hpp"
 #include "steps/step_runner.hpp"
 
 #include "test_fixture.hpp"
@@ -44,7 +45,11 @@ TEST_F(FeatureExtractionTestFixture, TestFeatureExtractionStep) {
     // Build the step and check that the type and hash function are correct.
     steps::FeatureExtraction const step{camera_id_, image_loading_id_, false, target_info_id_, target_id_, db_};
     EXPECT_EQ(step.Type(), StepType::FeatureExtraction);
-    EXPECT_EQ(step.CacheKey().value, "cebb7a03270d515c4a1fe8be46ce42e546b3958e655f3af29197303d055e5b1a");
+
+    // The same inputs give the same key, and it is not the key from before the extractor version was part of it.
+    steps::FeatureExtraction const same_step{camera_id_, image_loading_id_, false, target_info_id_, target_id_, db_};
+    EXPECT_EQ(step.CacheKey(), same_step.CacheKey());
+    EXPECT_NE(step.CacheKey().value, "cebb7a03270d515c4a1fe8be46ce42e546b3958e655f3af29197303d055e5b1a");
 
     // Build the actual database step id and execute the step.
     StepId const step_id{database::GetOrCreateStep(db_.get(), StepType::FeatureExtraction, "").first};
@@ -52,4 +57,53 @@ TEST_F(FeatureExtractionTestFixture, TestFeatureExtractionStep) {
 
     auto const result{database::ExtractedTargetsSelect(db_.get(), step_id, camera_id_)};
     EXPECT_EQ(std::size(result), 0);
-}
\ No newline at end of file
+
+    // Both images are identical, therefore there is one cache entry which remembers that there was no target.
+    TargetInfo const target_info{*database::TargetInfoSelect(db_.get(), target_info_id_, target_id_)};
+    auto const cache{
+        database::ExtractionCacheSelect(db_.get(), steps::FeatureExtraction::ExtractionCacheKey(target_info))};
+    ASSERT_EQ(std::size(cache), 1);
+    EXPECT_FALSE(std::cbegin(cache)->second.has_value());
+}
+
+TEST_F(FeatureExtractionTestFixture, TestFeatureExtractionCache) {
+    // Seed the cache with a fake target for the image. If the step really uses the cache instead of running the
+    // extraction then we get the fake target back for both images.
+    TargetInfo const target_info{*database::TargetInfoSelect(db_.get(), target_info_id_, target_id_)};
+    EncodedImages const images{database::ImagesSelect(db_.get(), image_loading_id_, camera_id_)};
+    ExtractedTarget const fake_target{Bundle{MatrixX2d{{1, 2}}, MatrixX3d{{3, 4, 5}}}, {{6, 7}}};
+    database::ExtractionCacheInsert(db_.get(), steps::FeatureExtraction::ExtractionCacheKey(target_info),
+                                    {{hashing::HashContent(std::cbegin(images)->second), fake_target}});
+
+    steps::FeatureExtraction const step{camera_id_, image_loading_id_, false, target_info_id_, target_id_, db_};
+    StepId const step_id{database::GetOrCreateStep(db_.get(), StepType::FeatureExtraction, "").first};
+    EXPECT_NO_THROW(step.Execute(step_id, db_));
+
+    auto const result{database::ExtractedTargetsSelect(db_.get(), step_id, camera_id_)};
+    ASSERT_EQ(std::size(result), 2);
+    EXPECT_TRUE(result.at(1).bundle.pixels.isApprox(fake_target.bundle.pixels));
+    EXPECT_TRUE(result.at(2).bundle.pixels.isApprox(fake_target.bundle.pixels));
+}
+TEST_F(FeatureExtractionTestFixture, TestFeatureExtractionCachePruning) {
+    TargetInfo const target_info{*database::TargetInfoSelect(db_.get(), target_info_id_, target_id_)};
+    Hash const target_key{steps::FeatureExtraction::ExtractionCacheKey(target_info)};
+    EncodedImages const images{database::ImagesSelect(db_.get(), image_loading_id_, camera_id_)};
+    Hash const image_key{hashing::HashContent(std::cbegin(images)->second)};
+
+    // An image which is not part of the dataset anymore, and a result of an older extractor version.
+    database::ExtractionCacheInsert(db_.get(), target_key, {{"removed_image", std::nullopt}});
+    database::ExtractionCacheInsert(db_.get(), hashing::HashArguments(target_info), {{image_key, std::nullopt}});
+
+    steps::FeatureExtraction const step{camera_id_, image_loading_id_, false, target_info_id_, target_id_, db_};
+    RunStep<steps::FeatureExtraction>(workflow_id_, step, db_);
+
+    // Only the entry of the image that the step used is left.
+    auto const cache{database::ExtractionCacheSelect(db_.get(), target_key)};
+    ASSERT_EQ(std::size(cache), 1);
+    EXPECT_TRUE(cache.contains(image_key.value));
+    EXPECT_TRUE(database::ExtractionCacheSelect(db_.get(), hashing::HashArguments(target_info)).empty());
+
+    // The entry is used by a step of a workflow, so it is kept until that step is deleted.
+    database::DeleteUnusedExtractionCache(db_.get());
+    EXPECT_EQ(std::size(database::ExtractionCacheSelect(db_.get(), target_key)), 1);
+}
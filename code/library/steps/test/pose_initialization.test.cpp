@@ -32,7 +32,7 @@ class PoseInitializationFixture : public StepTestFixture {
 };
 
 TEST_F(PoseInitializationFixture, TestPoseInitializationStepRunner) {
-    steps::PoseInitialization const step{camera_id_, targets_id_, camera_info_id_, intrinsics_id_, db_};
+    steps::PoseInitialization const step{camera_id_, targets_id_, false, camera_info_id_, intrinsics_id_, db_};
     StepId const step_id{RunStep<steps::PoseInitialization>(workflow_id_, step, db_)};
 
     auto const result{database::CameraPosesSelect(db_.get(), step_id, camera_id_)};
@@ -40,13 +40,24 @@ TEST_F(PoseInitializationFixture, TestPoseInitializationStepRunner) {
 }
 
 TEST_F(PoseInitializationFixture, TestPoseInitializationStep) {
-    steps::PoseInitialization const step{camera_id_, targets_id_, camera_info_id_, intrinsics_id_, db_};
+    steps::PoseInitialization const step{camera_id_, targets_id_, false, camera_info_id_, intrinsics_id_, db_};
     EXPECT_EQ(step.Type(), StepType::PoseInit);
     EXPECT_EQ(step.CacheKey().value, "723245d956786cad6abadb69629b5bccc8db6596c0864a6c77380c9f818351a1");
 
     auto const [step_id, _]{database::GetOrCreateStep(db_.get(), StepType::PoseInit, "")};
     EXPECT_NO_THROW(step.Execute(step_id, db_));
 
+    auto const result{database::CameraPosesSelect(db_.get(), step_id, camera_id_)};
+    EXPECT_EQ(std::size(result), 7);
+}
+
+TEST_F(PoseInitializationFixture, TestSequentialPoseInitializationStep) {
+    steps::PoseInitialization const step{camera_id_, targets_id_, true, camera_info_id_, intrinsics_id_, db_};
+    EXPECT_NE(step.CacheKey().value, "723245d956786cad6abadb69629b5bccc8db6596c0864a6c77380c9f818351a1");
+
+    auto const [step_id, _]{database::GetOrCreateStep(db_.get(), StepType::PoseInit, "")};
+    EXPECT_NO_THROW(step.Execute(step_id, db_));
+
     auto const result{database::CameraPosesSelect(db_.get(), step_id, camera_id_)};
     EXPECT_EQ(std::size(result), 7);
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "steps/solver_progress_writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "database/calibration_database.hpp"
+
+using namespace reprojection;
+using namespace std::chrono_literals;
+
+TEST(StepsSolverProgressWriter, TestWriteWhileRunning) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+    StepId const step_id{database::GetOrCreateStep(db.get(), StepType::BundleAdjustment, "").first};
+
+    steps::SolverProgressWriter writer{step_id, db, 1ms};
+    writer.Push(SolverIteration{0, 100, 10, 0, 0.1, 0.1, true});
+    writer.Push(SolverSnapshot{0, std::nullopt, Array6d::Zero()});
+
+    // The data shows up in the database without stopping the writer.
+    auto const deadline{std::chrono::steady_clock::now() + 5s};
+    while (database::SolverSnapshotsSelect(db.get(), step_id).empty() and std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(std::size(database::SolverIterationsSelect(db.get(), step_id)), 1);
+    EXPECT_EQ(std::size(database::SolverSnapshotsSelect(db.get(), step_id)), 1);
+
+    writer.Push(SolverIteration{1, 50, 5, 1, 0.1, 0.2, true});
+    writer.Stop();
+    EXPECT_EQ(std::size(database::SolverIterationsSelect(db.get(), step_id)), 2);
+
+    // Calling stop again is no problem, there is just nothing left to write.
+    EXPECT_NO_THROW(writer.Stop());
+}
+
+TEST(StepsSolverProgressWriter, TestThrottleSnapshots) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+    StepId const step_id{database::GetOrCreateStep(db.get(), StepType::BundleAdjustment, "").first};
+
+    {
+        // NOTE(Jack): The flush interval is so long that the only flush happens when the writer is destroyed.
+        steps::SolverProgressWriter writer{step_id, db, 1h};
+        optimization::SolverProgressOptions const options{writer.ProgressOptions(std::nullopt)};
+        for (int i{0}; i < 10; ++i) {
+            options.on_iteration(SolverIteration{i, 100.0 - i, 10, 1, 0.1, 0.1 * i, true});
+            options.on_snapshot(SolverSnapshot{i, std::nullopt, Array6d::Constant(i)});
+        }
+    }
+
+    // All iterations are kept, but only the newest snapshot.
+    auto const iterations{database::SolverIterationsSelect(db.get(), step_id)};
+    ASSERT_EQ(std::size(iterations), 10);
+    EXPECT_EQ(iterations.back().iteration, 9);
+
+    auto const snapshots{database::SolverSnapshotsSelect(db.get(), step_id)};
+    ASSERT_EQ(std::size(snapshots), 1);
+    EXPECT_EQ(snapshots[0].iteration, 9);
+    EXPECT_TRUE(snapshots[0].se3_a_b->isApprox(Array6d::Constant(9)));
+}
@@ -23,6 +23,10 @@ class SplineInitFixture : public StepTestFixture {
         database::CameraPosesInsert(db_.get(), pose_init_id_, targets_id_, camera_id_, poses);
     }
 
+    steps::SplineInitialization DefaultStep() const {
+        return {camera_id_, pose_init_id_, targets_id_, camera_info_id_, intrinsics_id_, std::nullopt, std::nullopt, db_};
+    }
+
     StepId camera_info_id_;
     StepId pose_init_id_{database::GetOrCreateStep(db_.get(), StepType::PoseInit, "").first};
     StepId targets_id_;
@@ -33,7 +37,8 @@ class SplineInitFixture : public StepTestFixture {
 
 TEST_F(SplineInitFixture, TestSplineInitStepRunner) {
     steps::SplineInitialization const step{camera_id_,      pose_init_id_,  targets_id_,
-                                           camera_info_id_, intrinsics_id_, db_};
+                                           camera_info_id_, intrinsics_id_, std::nullopt,
+                                           std::nullopt,    db_};
     StepId const step_id{RunStep<steps::SplineInitialization>(workflow_id_, step, db_)};
 
     auto const result{database::ControlPointsSelect(db_.get(), step_id, camera_id_)};
@@ -47,9 +52,13 @@ TEST_F(SplineInitFixture, TestSplineInitStepRunner) {
 
 TEST_F(SplineInitFixture, TestSplineInitStep) {
     steps::SplineInitialization const step{camera_id_,      pose_init_id_,  targets_id_,
-                                           camera_info_id_, intrinsics_id_, db_};
+                                           camera_info_id_, intrinsics_id_, std::nullopt,
+                                           std::nullopt,    db_};
     EXPECT_EQ(step.Type(), StepType::SplineInit);
-    EXPECT_EQ(step.CacheKey().value, "46d20a41437bc2c70b8497e5d0cebef0fcfb8bed7854b6e4ac1f1664ef006d02");
+
+    // The same inputs give the same key, and it is not the key from before the solver strategy was part of it.
+    EXPECT_EQ(step.CacheKey(), DefaultStep().CacheKey());
+    EXPECT_NE(step.CacheKey().value, "46d20a41437bc2c70b8497e5d0cebef0fcfb8bed7854b6e4ac1f1664ef006d02");
 
     auto const [step_id, _]{database::GetOrCreateStep(db_.get(), StepType::SplineInit, "")};
     EXPECT_NO_THROW(step.Execute(step_id, db_));
@@ -62,3 +71,38 @@ TEST_F(SplineInitFixture, TestSplineInitStep) {
     EXPECT_EQ(result2->t0_ns_, 2200000000);
     EXPECT_EQ(result2->delta_t_ns_, 10000000);
 }
+
+TEST_F(SplineInitFixture, TestSplineInitStepKnotFrequency) {
+    steps::SplineInitialization const step{camera_id_,      pose_init_id_,  targets_id_,
+                                           camera_info_id_, intrinsics_id_, 50,
+                                           std::nullopt,    db_};
+    EXPECT_NE(step.CacheKey(), DefaultStep().CacheKey());
+
+    auto const [step_id, _]{database::GetOrCreateStep(db_.get(), StepType::SplineInit, "")};
+    EXPECT_NO_THROW(step.Execute(step_id, db_));
+
+    auto const result{database::SplineInfoSelect(db_.get(), step_id, camera_id_)};
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->delta_t_ns_, 20000000);
+}
+
+TEST_F(SplineInitFixture, TestSplineInitStepAdaptiveKnots) {
+    steps::SplineInitialization const step{camera_id_,      pose_init_id_,  targets_id_, camera_info_id_,
+                                           intrinsics_id_, 100,            20,          db_};
+    EXPECT_NE(step.CacheKey(), DefaultStep().CacheKey());
+
+    auto const [step_id, _]{database::GetOrCreateStep(db_.get(), StepType::SplineInit, "")};
+    EXPECT_NO_THROW(step.Execute(step_id, db_));
+
+    auto const result{database::SplineInfoSelect(db_.get(), step_id, camera_id_)};
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result->IsUniform());
+    EXPECT_EQ(result->t0_ns_, 2200000000);
+
+    // Between the minimum and maximum knot frequency.
+    EXPECT_GE(result->delta_t_ns_, 10000000);
+    EXPECT_LE(result->delta_t_ns_, 50000000);
+
+    auto const control_points{database::ControlPointsSelect(db_.get(), step_id, camera_id_)};
+    EXPECT_EQ(std::size(control_points), std::size(result->knots_ns_) - 1 + spline::D);
+}
\ No newline at end of file
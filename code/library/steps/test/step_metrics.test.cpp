@@ -0,0 +1,30 @@
+#include "steps/step_metrics.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+using namespace reprojection;
+
+TEST(StepsStepMetrics, TestStepMetricsRecorder) {
+    steps::StepMetricsRecorder recorder;
+
+    // Hold three extra threads alive long enough that the sampler is guaranteed to see them.
+    {
+        std::vector<std::jthread> threads;
+        for (int i{0}; i < 3; ++i) {
+            threads.emplace_back([]() { std::this_thread::sleep_for(std::chrono::milliseconds(50)); });
+        }
+    }
+
+    StepMetrics const metrics{recorder.Stop(CacheStatus::CacheMiss)};
+    EXPECT_EQ(metrics.cache_status, CacheStatus::CacheMiss);
+    EXPECT_GE(metrics.wall_time_s, 0.05);
+    EXPECT_GE(metrics.cpu_time_s, 0);
+    EXPECT_GE(metrics.peak_rss_delta_kb, 0);
+    EXPECT_GE(metrics.peak_num_threads, 4);  // Main thread plus three
+
+    // Calling stop again is no problem, the sampler is just not running anymore.
+    EXPECT_NO_THROW(recorder.Stop(CacheStatus::CacheMiss));
+}
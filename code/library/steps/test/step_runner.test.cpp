@@ -30,12 +30,52 @@ TEST(StepsStepRunner, TestExampleStep) {
     StepId result{steps::RunStep<ExampleStep>(workflow_id, step, db)};
     EXPECT_EQ(result.value, 1);
 
-    // Rerunning the step should be a cache hit (but we can't see that here) and should return the same step ID
+    // Rerunning the step should be a cache hit and should return the same step ID
     result = steps::RunStep<ExampleStep>(workflow_id, step, db);
     EXPECT_EQ(result.value, 1);
 
+    // Both runs are recorded in the step metrics, which is how we can see the cache hit.
+    auto const metrics{database::StepMetricsSelect(db.get(), result)};
+    ASSERT_EQ(std::size(metrics), 2);
+    EXPECT_EQ(metrics[0].cache_status, CacheStatus::CacheMiss);
+    EXPECT_EQ(metrics[1].cache_status, CacheStatus::CacheHit);
+    EXPECT_GE(metrics[0].wall_time_s, 0);
+    EXPECT_GE(metrics[0].peak_num_threads, 1);
+
     // Change the cache key so we get a cache miss and a new step is created.
     step.cache_key_ = Hash{"1"};
     result = steps::RunStep<ExampleStep>(workflow_id, step, db);
     EXPECT_EQ(result.value, 2);
-}
\ No newline at end of file
+}
+
+// A step which reports that it stopped early, like an optimization that ran out of its time budget.
+struct StoppedEarlyStep {
+    static StepType Type() { return StepType::BundleAdjustment; }
+
+    static Hash CacheKey() { return Hash{"stopped_early"}; }
+
+    static ExecuteStatus Execute(StepId const step_id, SqlitePtr const db) {
+        (void)db;
+        (void)step_id;
+
+        return ExecuteStatus::StoppedEarly;
+    }
+};
+
+TEST(StepsStepRunner, TestStoppedEarlyStep) {
+    auto db{database::OpenCalibrationDatabase(":memory:", true)};
+
+    AssetId const asset_id{database::GetOrCreateAsset(db.get(), AssetType::Camera, 0, "")};
+    WorkflowId const workflow_id{database::GetOrCreateWorkflow(db.get(), WorkflowType::Cam, {asset_id})};
+
+    StoppedEarlyStep const step;
+    StepId result{steps::RunStep<StoppedEarlyStep>(workflow_id, step, db)};
+    EXPECT_EQ(result.value, 1);
+
+    // The cache key of the first run was not stored, so the rerun is a cache miss and executes again as a new step.
+    result = steps::RunStep<StoppedEarlyStep>(workflow_id, step, db);
+    EXPECT_EQ(result.value, 2);
+    auto const metrics{database::StepMetricsSelect(db.get(), result)};
+    ASSERT_EQ(std::size(metrics), 1);
+    EXPECT_EQ(metrics[0].cache_status, CacheStatus::CacheMiss);
+}
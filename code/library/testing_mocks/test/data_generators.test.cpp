@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "geometry/lie.hpp"
 #include "testing_utilities/constants.hpp"
 #include "types/eigen_types.hpp"
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <map>
+#include <optional>
+#include <utility>
 
 #include "types/enums.hpp"
 #include "types/sensor_data_types.hpp"
@@ -85,4 +87,12 @@ struct Extrinsic {
     Array6d se3_a_b;
 };
 
+// NOTE(Jack): The intermediate parameters of a running optimization. Each optimization only fills out what it actually
+// optimizes, for example the extrinsic optimization holds the intrinsics constant and therefore does not snapshot them.
+struct SolverSnapshot {
+    int iteration;
+    std::optional<std::pair<CameraModel, ArrayXd>> intrinsics;
+    std::optional<Array6d> se3_a_b;
+};
+
 }  // namespace reprojection
\ No newline at end of file
@@ -3,11 +3,16 @@
 #include <ceres/problem.h>
 #include <ceres/solver.h>
 
+#include "types/database_types.hpp"
+
 namespace reprojection {
 
 struct CeresState {
     CeresState() = default;
 
+    // NOTE(Jack): Leaves the linear solver to optimization::ApplySolverStrategy().
+    explicit CeresState(ceres::Ownership const ownership) { problem_options.cost_function_ownership = ownership; }
+
     CeresState(ceres::Ownership const ownership, ceres::LinearSolverType const linear_solver) {
         problem_options.cost_function_ownership = ownership;
         solver_options.linear_solver_type = linear_solver;
@@ -18,4 +23,18 @@ struct CeresState {
     ceres::Solver::Summary solver_summary;
 };
 
+inline SolverMetrics ToSolverMetrics(ceres::Solver::Summary const& summary) {
+    return {summary.initial_cost,
+            summary.final_cost,
+            summary.num_successful_steps,
+            summary.num_unsuccessful_steps,
+            summary.preprocessor_time_in_seconds,
+            summary.minimizer_time_in_seconds,
+            summary.linear_solver_time_in_seconds,
+            summary.jacobian_evaluation_time_in_seconds,
+            summary.residual_evaluation_time_in_seconds,
+            summary.postprocessor_time_in_seconds,
+            summary.total_time_in_seconds};
+}
+
 }  // namespace reprojection
\ No newline at end of file
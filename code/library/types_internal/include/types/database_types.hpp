@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 
+#include "types/enums.hpp"
+
 namespace reprojection {
 
 struct AssetId {
@@ -55,6 +58,44 @@ struct Name {
     friend constexpr bool operator==(Name const&, Name const&) = default;
 };
 
+// NOTE(Jack): The resources used by one single steps::RunStep() call. A step that is a cache hit also gets an entry
+// (with a very small wall time hopefully) so that we can see how much the cache saved us.
+struct StepMetrics {
+    CacheStatus cache_status;
+    double wall_time_s;
+    double cpu_time_s;  // Summed over all threads, therefore it can be larger than the wall time
+    int64_t peak_rss_delta_kb;
+    int peak_num_threads;
+};
+
+// NOTE(Jack): A copy of the most interesting ceres::Solver::Summary fields, so that we do not need to depend on ceres
+// everywhere the metrics are used.
+struct SolverMetrics {
+    double initial_cost;
+    double final_cost;
+    int num_successful_steps;
+    int num_unsuccessful_steps;
+    double preprocessor_time_s;
+    double minimizer_time_s;
+    double linear_solver_time_s;
+    double jacobian_evaluation_time_s;
+    double residual_evaluation_time_s;
+    double postprocessor_time_s;
+    double total_time_s;
+};
+
+// NOTE(Jack): The progress of one single ceres minimizer iteration. Iteration zero is the state before the first step,
+// which means the step norm is zero and the iteration time is the time spent before the minimizer started.
+struct SolverIteration {
+    int iteration;
+    double cost;
+    double gradient_norm;
+    double step_norm;
+    double iteration_time_s;
+    double cumulative_time_s;
+    bool step_is_successful;
+};
+
 enum class AssetType { Camera, Imu, Target };
 
 inline std::string ToString(AssetType const data) {
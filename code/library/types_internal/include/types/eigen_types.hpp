@@ -59,5 +59,7 @@ using VectorXd = Eigen::VectorXd;
 
 // Miscellaneous types
 using Isometry3d = Eigen::Isometry3d;
+template <typename T>
+using Quaternion = Eigen::Quaternion<T>;
 
 };  // namespace reprojection
@@ -108,6 +108,13 @@ enum class CacheStatus {
     CacheMiss,
 };
 
+// NOTE(Jack): Returned by the Execute() of a step that can stop before it is done (ex. an optimization with a time
+// budget). The result of such a step is still written, but steps::RunStep() does not store its cache key.
+enum class ExecuteStatus {
+    Complete,
+    StoppedEarly,
+};
+
 inline std::string ToString(CacheStatus const status) {
     if (status == CacheStatus::CacheHit) {
         return "cache_hit";
@@ -117,6 +124,17 @@ inline std::string ToString(CacheStatus const status) {
         throw std::runtime_error{"LIBRARY IMPLEMENTATION ERROR - ToString(CacheStatus)"};
     }
 }
+
+inline CacheStatus ToCacheStatus(std::string const& enum_string) {
+    if (enum_string == "cache_hit") {
+        return CacheStatus::CacheHit;
+    } else if (enum_string == "cache_miss") {
+        return CacheStatus::CacheMiss;
+    } else {
+        throw std::runtime_error("LIBRARY IMPLEMENTATION ERROR - Unrecognized argument passed to ToCacheStatus(): " +
+                                 enum_string);
+    }
+}
 // LCOV_EXCL_STOP
 
 }  // namespace reprojection
\ No newline at end of file
@@ -19,4 +19,9 @@ using Image = StampedData<cv::Mat>;
 using EncodedImage = StampedData<ImageBuffer>;
 using EncodedImages = StampedMap<EncodedImage>;
 
+// NOTE(Jack): The size in bytes of each encoded image, which is all the step cache keys need to know about the images
+// (see hashing::Serialize(EncodedImages)). Unlike the images themselves this is cheap to keep in memory.
+using ImageSize = StampedData<std::size_t>;
+using ImageSizes = StampedMap<ImageSize>;
+
 }  // namespace reprojection
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+namespace reprojection::video_capture {
+
+/**
+ * \brief Offline frame source which decodes frames on multiple threads and returns them in their original order.
+ *
+ * Supports two kinds of input:
+ *      1. A directory containing image files (ex. "dataset/cam0/"). The files are sorted by name and decoded in
+ *         parallel, num_workers files at a time.
+ *      2. Anything cv::VideoCapture can open (ex. "video.mp4" or an image sequence pattern like "folder/%02d.png"). The
+ *         video is split into num_workers segments and each segment is decoded by its own cv::VideoCapture which seeks
+ *         to the segment start.
+ *
+ * Every frame_stride-th frame is returned, with the frame index as the pseudo timestamp. With num_workers=1 and
+ * frame_stride=1 the output for a video file is exactly the same as calling VideoCapture::GetImage() until it returns an
+ * empty image.
+ *
+ * The decoded frames wait in one in memory reorder buffer until they are returned in order. Once capacity frames are
+ * buffered the workers wait for the consumer, except a worker that has no frame in the buffer at all, which is the only
+ * way the frame the consumer waits for can always be decoded. The buffer therefore never holds more than capacity plus
+ * num_workers frames. For image directories the workers interleave, so a small capacity is enough to keep all threads
+ * busy. For video segments only the segment currently being consumed is drained, the later segments decode ahead only
+ * until the buffer is full. Choose the capacity according to how many frames you can afford to keep in memory.
+ *
+ * WARN(Jack): Segment decoding depends on accurate frame seeking (cv::CAP_PROP_POS_FRAMES) and an accurate frame count
+ * (cv::CAP_PROP_FRAME_COUNT). OpenCV says the behavior of both "depends on the backend", therefore if the seek does not
+ * land exactly where we asked for we throw instead of silently returning the wrong frames.
+ */
+class FrameSource {
+   public:
+    FrameSource(std::string const& path, int const num_workers, int const frame_stride, std::size_t const capacity);
+
+    ~FrameSource();
+
+    FrameSource(FrameSource const&) = delete;
+    FrameSource& operator=(FrameSource const&) = delete;
+    FrameSource(FrameSource&&) = delete;
+    FrameSource& operator=(FrameSource&&) = delete;
+
+    /**
+     * \brief Returns the next frame with its frame index, or std::nullopt once all frames have been returned. Rethrows
+     * any error that happened on the worker threads.
+     */
+    std::optional<std::pair<uint64_t, cv::Mat>> GetImage();
+
+    /**
+     * \brief For video files and image sequence patterns this is identical to VideoCapture::GetSignature() as long as
+     * frame_stride is one, so that already cached image loading steps stay valid.
+     */
+    std::string GetSignature() const;
+
+    /**
+     * \brief Number of frames which were decoded but not yet returned by GetImage().
+     */
+    std::size_t NumBufferedFrames();
+
+   private:
+    struct WorkerQueue {
+        std::deque<std::pair<uint64_t, cv::Mat>> frames;
+        bool done{false};
+    };
+
+    void Start();
+
+    void DirectoryWorker(int const worker_id);
+
+    void VideoSegmentWorker(int const worker_id, uint64_t const start, std::optional<uint64_t> const end);
+
+    // Returns false if the source was stopped while waiting for space in the queue.
+    bool Push(int const worker_id, uint64_t const frame_index, cv::Mat const& frame);
+
+    void Finish(int const worker_id, std::exception_ptr const error);
+
+    std::string path_;
+    int num_workers_;
+    int frame_stride_;
+    std::size_t capacity_;
+
+    bool is_directory_;
+    std::vector<std::filesystem::path> files_;  // Only filled for the directory case
+    std::string video_signature_;               // Only filled for the video case
+    uint64_t frame_count_{0};                   // Only filled for the video case, 0 if unknown
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<WorkerQueue> queues_;
+    std::size_t num_returned_{0};
+    std::size_t current_segment_{0};
+    std::size_t num_buffered_{0};
+    bool stop_{false};
+    std::exception_ptr error_;
+
+    // NOTE(Jack): Must be the last member so the threads are joined before anything they touch is destroyed.
+    std::vector<std::jthread> threads_;
+};
+
+}  // namespace reprojection::video_capture
@@ -0,0 +1,262 @@
+#include "video_capture/frame_source.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+#include "video_capture/video_capture.hpp"
+
+namespace reprojection::video_capture {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// NOTE(Jack): The files are sorted by name, not by "natural" order. This means that "10.png" comes before "2.png", so
+// please zero pad your file names!
+std::vector<fs::path> ListImageFiles(fs::path const& directory) {
+    // NOTE(Jack): This is a subset of the formats that cv::imread() supports, namely the ones we actually expect to see.
+    static std::set<std::string> const extensions{".bmp", ".jpeg", ".jpg", ".pgm", ".png", ".ppm", ".tif", ".tiff"};
+
+    std::vector<fs::path> files;
+    for (auto const& entry : fs::directory_iterator(directory)) {
+        if (not entry.is_regular_file()) {
+            continue;
+        }
+
+        std::string extension{entry.path().extension().string()};
+        std::ranges::transform(extension, std::begin(extension), [](unsigned char const c) { return std::tolower(c); });
+        if (extensions.contains(extension)) {
+            files.push_back(entry.path());
+        }
+    }
+    std::ranges::sort(files);
+
+    return files;
+}
+
+}  // namespace
+
+FrameSource::FrameSource(std::string const& path, int const num_workers, int const frame_stride,
+                         std::size_t const capacity)
+    : path_{path},
+      num_workers_{std::max(1, num_workers)},
+      frame_stride_{std::max(1, frame_stride)},
+      capacity_{std::max<std::size_t>(1, capacity)},
+      is_directory_{fs::is_directory(path)} {
+    if (is_directory_) {
+        files_ = ListImageFiles(path_);
+        if (files_.empty()) {
+            throw std::runtime_error("Image directory " + path_ + " does not contain any images!");
+        }
+    } else {
+        // NOTE(Jack): We use the VideoCapture class here so that the signature is generated exactly like it was before
+        // the frame source existed, and so we get the same error handling if the video cannot be opened.
+        video_signature_ = VideoCapture{path_}.GetSignature();
+
+        cv::VideoCapture const cap{path_};
+        double const frame_count{cap.get(cv::CAP_PROP_FRAME_COUNT)};
+        frame_count_ = frame_count > 0 ? static_cast<uint64_t>(frame_count) : 0;
+
+        // Without a known frame count we cannot split the video into segments.
+        if (frame_count_ == 0) {
+            num_workers_ = 1;
+        } else {
+            num_workers_ = static_cast<int>(std::min<uint64_t>(num_workers_, frame_count_));
+        }
+    }
+
+    queues_.resize(num_workers_);
+}
+
+FrameSource::~FrameSource() {
+    {
+        std::lock_guard const lock{mutex_};
+        stop_ = true;
+    }
+    condition_.notify_all();
+}
+
+std::optional<std::pair<uint64_t, cv::Mat>> FrameSource::GetImage() {
+    if (threads_.empty()) {
+        Start();
+    }
+
+    std::unique_lock lock{mutex_};
+    while (current_segment_ < std::size(queues_)) {
+        // NOTE(Jack): For the directory the workers interleave (i.e. worker zero has frames 0, n, 2n...), for the video
+        // each worker has one continuous segment which we consume one after the other.
+        std::size_t const worker_id{is_directory_ ? num_returned_ % std::size(queues_) : current_segment_};
+        WorkerQueue& queue{queues_[worker_id]};
+
+        condition_.wait(lock, [this, &queue]() { return error_ or not queue.frames.empty() or queue.done; });
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+
+        if (not queue.frames.empty()) {
+            std::pair<uint64_t, cv::Mat> frame{std::move(queue.frames.front())};
+            queue.frames.pop_front();
+            --num_buffered_;
+            ++num_returned_;
+
+            lock.unlock();
+            condition_.notify_all();  // There is now space in the buffer for the workers to fill
+
+            return frame;
+        }
+
+        // The worker is done and its queue is empty. In the directory case this means there are no frames left at all.
+        if (is_directory_) {
+            current_segment_ = std::size(queues_);
+        } else {
+            ++current_segment_;
+        }
+    }
+
+    return std::nullopt;
+}
+
+std::size_t FrameSource::NumBufferedFrames() {
+    std::lock_guard const lock{mutex_};
+
+    return num_buffered_;
+}
+
+std::string FrameSource::GetSignature() const {
+    std::ostringstream oss;
+    if (is_directory_) {
+        // NOTE(Jack): The size alone does not change when a frame is edited in place (ex. a fixed exposure), the last
+        // write time does.
+        for (auto const& file : files_) {
+            oss << file.filename().string() << ":" << fs::file_size(file) << ":"
+                << fs::last_write_time(file).time_since_epoch().count() << ";";
+        }
+        oss << "|";
+    } else {
+        oss << video_signature_;
+    }
+
+    // NOTE(Jack): Only add the stride when it is actually used. This keeps the signature of the default case the same
+    // as VideoCapture::GetSignature(), which means already existing cached steps stay valid.
+    if (frame_stride_ != 1) {
+        oss << "stride:" << frame_stride_ << "|";
+    }
+
+    return oss.str();
+}
+
+void FrameSource::Start() {
+    for (int worker_id{0}; worker_id < num_workers_; ++worker_id) {
+        if (is_directory_) {
+            threads_.emplace_back(&FrameSource::DirectoryWorker, this, worker_id);
+        } else {
+            uint64_t const start{worker_id * frame_count_ / num_workers_};
+            // NOTE(Jack): The last segment reads until the video ends instead of trusting the frame count. This also
+            // covers the single segment case where we might not know the frame count at all.
+            std::optional<uint64_t> end{std::nullopt};
+            if (worker_id < num_workers_ - 1) {
+                end = (worker_id + 1) * frame_count_ / num_workers_;
+            }
+
+            threads_.emplace_back(&FrameSource::VideoSegmentWorker, this, worker_id, start, end);
+        }
+    }
+}
+
+void FrameSource::DirectoryWorker(int const worker_id) {
+    try {
+        uint64_t const num_files{std::size(files_)};
+        for (uint64_t i{static_cast<uint64_t>(worker_id)}; i * frame_stride_ < num_files; i += num_workers_) {
+            uint64_t const frame_index{i * frame_stride_};
+
+            cv::Mat const frame{cv::imread(files_[frame_index].string())};
+            if (frame.empty()) {
+                throw std::runtime_error("Failed to read image: " + files_[frame_index].string());
+            }
+
+            if (not Push(worker_id, frame_index, frame)) {
+                return;
+            }
+        }
+        Finish(worker_id, nullptr);
+    } catch (...) {
+        Finish(worker_id, std::current_exception());
+    }
+}
+
+void FrameSource::VideoSegmentWorker(int const worker_id, uint64_t const start, std::optional<uint64_t> const end) {
+    try {
+        cv::VideoCapture cap{path_};
+        if (not cap.isOpened()) {
+            throw std::runtime_error("Video capture device is not open!");  // LCOV_EXCL_LINE
+        }
+
+        if (start > 0) {
+            cap.set(cv::CAP_PROP_POS_FRAMES, static_cast<double>(start));
+            if (static_cast<uint64_t>(cap.get(cv::CAP_PROP_POS_FRAMES)) != start) {
+                throw std::runtime_error("Frame accurate seeking is not supported for " + path_ +  // LCOV_EXCL_LINE
+                                         ", please use a single video segment.");                  // LCOV_EXCL_LINE
+            }
+        }
+
+        for (uint64_t frame_index{start}; not end or frame_index < *end; ++frame_index) {
+            if (frame_index % frame_stride_ != 0) {
+                // NOTE(Jack): grab() without retrieve() skips the conversion and copy of frames that we do not want.
+                if (not cap.grab()) {
+                    break;
+                }
+                continue;
+            }
+
+            // WARN(Jack): The frame must be a new cv::Mat every iteration! If we reuse it then read() writes into the
+            // same memory which is still referenced by the frames waiting in the queue.
+            cv::Mat frame;
+            if (not cap.read(frame) or frame.empty()) {
+                break;
+            }
+
+            if (not Push(worker_id, frame_index, frame)) {
+                return;
+            }
+        }
+        Finish(worker_id, nullptr);
+    } catch (...) {
+        Finish(worker_id, std::current_exception());
+    }
+}
+
+bool FrameSource::Push(int const worker_id, uint64_t const frame_index, cv::Mat const& frame) {
+    std::unique_lock lock{mutex_};
+    WorkerQueue& queue{queues_[worker_id]};
+
+    // NOTE(Jack): The consumer always waits for the oldest frame of one worker. If that worker also had to wait for
+    // space, a buffer full of later frames would never drain. A worker with an empty queue may therefore always push.
+    condition_.wait(lock, [this, &queue]() { return stop_ or num_buffered_ < capacity_ or queue.frames.empty(); });
+    if (stop_) {
+        return false;
+    }
+
+    queue.frames.emplace_back(frame_index, frame);
+    ++num_buffered_;
+    lock.unlock();
+    condition_.notify_all();
+
+    return true;
+}
+
+void FrameSource::Finish(int const worker_id, std::exception_ptr const error) {
+    {
+        std::lock_guard const lock{mutex_};
+        queues_[worker_id].done = true;
+        if (error and not error_) {
+            error_ = error;
+            stop_ = true;
+        }
+    }
+    condition_.notify_all();
+}
+
+}  // namespace reprojection::video_capture
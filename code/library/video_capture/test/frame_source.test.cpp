@@ -0,0 +1,164 @@
+#include "video_capture/frame_source.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <opencv2/opencv.hpp>
+
+#include "video_capture/video_capture.hpp"
+
+using namespace reprojection;
+
+TEST(VideoCaptureFrameSource, TestDirectory) {
+    std::string const folder{"test/frame_source/directory/"};
+    std::filesystem::create_directories(folder);
+
+    // Each image gets a unique intensity so that we can check that they come back in the right order.
+    for (int i{0}; i < 5; ++i) {
+        cv::imwrite(folder + "0" + std::to_string(i) + ".png", cv::Mat(10, 10, CV_8UC1, cv::Scalar(i * 10)));
+    }
+    std::ofstream{folder + "not_an_image.txt"} << "Should be ignored";
+
+    video_capture::FrameSource frame_source{folder, 3, 1, 1};
+    std::string const signature{frame_source.GetSignature()};
+    EXPECT_TRUE(signature.starts_with("00.png:"));
+    EXPECT_TRUE(signature.ends_with(";|"));
+    EXPECT_EQ(signature.find("not_an_image.txt"), std::string::npos);
+
+    for (uint64_t i{0}; i < 5; ++i) {
+        auto const frame{frame_source.GetImage()};
+        ASSERT_TRUE(frame.has_value());
+        EXPECT_EQ(frame->first, i);
+        EXPECT_EQ(frame->second.rows * frame->second.cols, 100);
+        EXPECT_EQ(cv::mean(frame->second)[0], i * 10);
+    }
+    EXPECT_FALSE(frame_source.GetImage().has_value());
+
+    std::filesystem::remove_all(folder);
+}
+
+TEST(VideoCaptureFrameSource, TestDirectorySignatureEditedInPlace) {
+    std::string const folder{"test/frame_source/edited/"};
+    std::filesystem::create_directories(folder);
+
+    std::string const file{folder + "00.png"};
+    cv::imwrite(file, cv::Mat(10, 10, CV_8UC1, cv::Scalar(10)));
+    std::string const signature{video_capture::FrameSource{folder, 1, 1, 1}.GetSignature()};
+
+    // Same file name and size, only the content changed.
+    auto const size{std::filesystem::file_size(file)};
+    auto const write_time{std::filesystem::last_write_time(file)};
+    cv::imwrite(file, cv::Mat(10, 10, CV_8UC1, cv::Scalar(20)));
+    std::filesystem::last_write_time(file, write_time + std::chrono::seconds(1));
+    ASSERT_EQ(std::filesystem::file_size(file), size);
+
+    EXPECT_NE(video_capture::FrameSource(folder, 1, 1, 1).GetSignature(), signature);
+
+    std::filesystem::remove_all(folder);
+}
+
+TEST(VideoCaptureFrameSource, TestDirectoryStride) {
+    std::string const folder{"test/frame_source/stride/"};
+    std::filesystem::create_directories(folder);
+
+    for (int i{0}; i < 5; ++i) {
+        cv::imwrite(folder + "0" + std::to_string(i) + ".png", cv::Mat(10, 10, CV_8UC1, cv::Scalar(i * 10)));
+    }
+
+    video_capture::FrameSource frame_source{folder, 2, 2, 4};
+    EXPECT_TRUE(frame_source.GetSignature().ends_with("stride:2|"));
+
+    for (uint64_t const i : {0, 2, 4}) {
+        auto const frame{frame_source.GetImage()};
+        ASSERT_TRUE(frame.has_value());
+        EXPECT_EQ(frame->first, i);
+        EXPECT_EQ(cv::mean(frame->second)[0], i * 10);
+    }
+    EXPECT_FALSE(frame_source.GetImage().has_value());
+
+    std::filesystem::remove_all(folder);
+}
+
+TEST(VideoCaptureFrameSource, TestVideoSegments) {
+    std::string const folder{"test/frame_source/video/"};
+    std::filesystem::create_directories(folder);
+
+    cv::VideoWriter writer;
+    ASSERT_TRUE(writer.open(folder + "video.mp4", cv::VideoWriter::fourcc('m', 'p', '4', 'v'), 30.0, cv::Size{16, 16},
+                            false));
+    for (int i{0}; i < 6; ++i) {
+        writer.write(cv::Mat(16, 16, CV_8UC1, cv::Scalar(i * 40)));
+    }
+    writer.release();
+
+    std::string const video_signature{video_capture::VideoCapture{folder + "video.mp4"}.GetSignature()};
+
+    // The single segment case is the reference, and the multi segment case must produce the exact same frames.
+    for (int const num_segments : {1, 3}) {
+        video_capture::FrameSource frame_source{folder + "video.mp4", num_segments, 1, 2};
+        EXPECT_EQ(frame_source.GetSignature(), video_signature);
+
+        for (uint64_t i{0}; i < 6; ++i) {
+            auto const frame{frame_source.GetImage()};
+            ASSERT_TRUE(frame.has_value());
+            EXPECT_EQ(frame->first, i);
+            // The mp4 compression is lossy, therefore we only check that the intensity is roughly right.
+            EXPECT_NEAR(cv::mean(frame->second)[0], i * 40, 5);
+        }
+        EXPECT_FALSE(frame_source.GetImage().has_value());
+    }
+
+    std::filesystem::remove_all(folder);
+}
+
+TEST(VideoCaptureFrameSource, TestVideoSegmentsBoundedBuffer) {
+    std::string const folder{"test/frame_source/bounded/"};
+    std::filesystem::create_directories(folder);
+
+    cv::VideoWriter writer;
+    ASSERT_TRUE(writer.open(folder + "video.mp4", cv::VideoWriter::fourcc('m', 'p', '4', 'v'), 30.0, cv::Size{16, 16},
+                            false));
+    for (int i{0}; i < 30; ++i) {
+        writer.write(cv::Mat(16, 16, CV_8UC1, cv::Scalar(i * 8)));
+    }
+    writer.release();
+
+    // Nobody consumes after the first frame, so the workers fill the buffer and then wait. Each worker may go over the
+    // capacity by at most the one frame it is allowed to push into its empty queue.
+    video_capture::FrameSource frame_source{folder + "video.mp4", 3, 1, 6};
+    auto const first_frame{frame_source.GetImage()};
+    ASSERT_TRUE(first_frame.has_value());
+    EXPECT_EQ(first_frame->first, 0);
+
+    auto const deadline{std::chrono::steady_clock::now() + std::chrono::seconds(10)};
+    while (frame_source.NumBufferedFrames() < 6 and std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_GE(frame_source.NumBufferedFrames(), 6);
+    EXPECT_LE(frame_source.NumBufferedFrames(), 6 + 3);
+
+    for (uint64_t i{1}; i < 30; ++i) {
+        auto const frame{frame_source.GetImage()};
+        ASSERT_TRUE(frame.has_value());
+        EXPECT_EQ(frame->first, i);
+        EXPECT_NEAR(cv::mean(frame->second)[0], i * 8, 5);
+    }
+    EXPECT_FALSE(frame_source.GetImage().has_value());
+
+    std::filesystem::remove_all(folder);
+}
+
+TEST(VideoCaptureFrameSource, TestErrors) {
+    std::string const folder{"test/frame_source/empty/"};
+    std::filesystem::create_directories(folder);
+
+    EXPECT_THROW(video_capture::FrameSource(folder, 2, 1, 1), std::runtime_error);
+    EXPECT_THROW(video_capture::FrameSource("non_existent_video.mp4", 2, 1, 1), std::runtime_error);
+
+    std::filesystem::remove_all(folder);
+}
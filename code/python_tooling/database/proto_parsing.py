@@ -1,6 +1,10 @@
 import numpy as np
 
-from generated.extracted_target_pb2 import ArrayX2dProto, ExtractedTargetProto
+from generated.extracted_target_pb2 import (
+    ArrayX2dProto,
+    ExtractedTargetProto,
+    ImuChunkProto,
+)
 
 
 def build_pixels(msg_data):
@@ -66,3 +70,15 @@ def parse_array_x2d_proto(blob):
     msg.ParseFromString(blob)
 
     return build_array_x2d(msg).tolist()
+
+
+# NOTE(Jack): The imu data and imu errors are stored in chunks of many samples, see calibration_database.hpp in the
+# library. Returns the timestamps and an (N, 6) array with the angular velocity followed by the linear acceleration.
+def parse_imu_chunk_proto(blob):
+    msg = ImuChunkProto()
+    msg.ParseFromString(blob)
+
+    timestamps_ns = np.array(msg.timestamps_ns, dtype=np.uint64)
+    data = np.array(msg.data, dtype=np.float64).reshape(len(timestamps_ns), 6)
+
+    return timestamps_ns, data
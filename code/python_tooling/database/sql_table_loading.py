@@ -2,11 +2,25 @@ import logging
 import os
 import sqlite3
 
+import numpy as np
 import pandas as pd
 
-from database.proto_parsing import parse_array_x2d_proto, parse_extracted_target_proto
+from database.proto_parsing import (
+    parse_array_x2d_proto,
+    parse_extracted_target_proto,
+    parse_imu_chunk_proto,
+)
 from database.sql_statement_loading import load_sql
 
+# NOTE(Jack): The native loader reads and decodes the blob tables in c++ (see database/src/python_bindings.cpp in the
+# library) which is more than an order of magnitude faster than parsing the protobufs row by row in python. It is only
+# available where the python bindings are installed, everywhere else we fall back to pandas and the python protobuf
+# parsing.
+try:
+    import database_python_binding
+except ImportError:
+    database_python_binding = None
+
 log = logging.getLogger("reprojection")
 
 
@@ -39,6 +53,68 @@ def load_table_blob(db_path, sql_query_file, parser, blob_column_id="data"):
     return table
 
 
+def object_column(values):
+    # NOTE(Jack): Fill the column element by element, otherwise numpy stacks equally shaped arrays into one array.
+    column = np.empty(len(values), dtype=object)
+    for i, value in enumerate(values):
+        column[i] = value
+
+    return column
+
+
+# NOTE(Jack): Produces the same table as load_table_blob(), but the blob column holds numpy arrays instead of lists.
+# The select is called once per (step_id, asset_id) pair and must return the timestamps and the parsed blobs.
+def load_table_native(db_path, table_name, select):
+    ids = load_table(db_path, f"{table_name}_select_ids.sql")
+    if ids is None:
+        return None
+
+    columns = ["step_id", "asset_id", "timestamp_ns", "data"]
+    tables = []
+    for step_id, asset_id in ids.itertuples(index=False):
+        timestamps_ns, data = select(db_path, int(step_id), int(asset_id))
+        table = pd.DataFrame(
+            {
+                "step_id": np.full(len(timestamps_ns), step_id),
+                "asset_id": np.full(len(timestamps_ns), asset_id),
+                "timestamp_ns": timestamps_ns.astype(np.int64),
+                "data": object_column(data),
+            }
+        )
+        tables.append(table)
+
+    if not tables:
+        return pd.DataFrame(columns=columns)
+
+    return pd.concat(tables, ignore_index=True)
+
+
+imu_columns = ["omega_x", "omega_y", "omega_z", "ax", "ay", "az"]
+
+
+# NOTE(Jack): Expands the imu chunk table (one blob per chunk of samples) back into one row per sample, so that the
+# rest of the tooling sees the same table as it would for any other multi row table.
+def load_table_imu_chunks(db_path, sql_query_file, parser=parse_imu_chunk_proto):
+    table = load_table(db_path, sql_query_file)
+    if table is None:
+        return None
+
+    columns = ["step_id", "asset_id", "timestamp_ns"] + imu_columns
+    tables = []
+    for step_id, asset_id, blob in table.itertuples(index=False):
+        timestamps_ns, data = parser(blob)
+        chunk = pd.DataFrame(data, columns=imu_columns)
+        chunk.insert(0, "timestamp_ns", timestamps_ns.astype(np.int64))
+        chunk.insert(0, "asset_id", np.full(len(timestamps_ns), asset_id))
+        chunk.insert(0, "step_id", np.full(len(timestamps_ns), step_id))
+        tables.append(chunk)
+
+    if not tables:
+        return pd.DataFrame(columns=columns)
+
+    return pd.concat(tables, ignore_index=True)
+
+
 def load_calibration_database(db_path):
     db = {}
 
@@ -49,10 +125,13 @@ def load_calibration_database(db_path):
         "camera_poses",
         "extrinsics",
         "images_timestamps",
-        "imu_data",
-        "imu_errors",
         "intrinsics",
+        "solver_iterations",
+        "solver_metrics",
+        "solver_snapshots",
+        "step_metrics",
         "target_info",
+        "warm_starts",
         "workflow_assets",
         "workflow_steps",
         "workflows",
@@ -60,16 +139,30 @@ def load_calibration_database(db_path):
         if (table := load_table(db_path, table_name + "_select_all.sql")) is not None:
             db[table_name] = table
 
-    # Tables that do require blob parsing.
+    # Tables that do require blob parsing, with the python parser and the native select that replaces it.
     blob_tables = {
-        "extracted_targets": parse_extracted_target_proto,
-        "reprojection_errors": parse_array_x2d_proto,
+        "extracted_targets": (parse_extracted_target_proto, "ExtractedTargetsSelect"),
+        "reprojection_errors": (parse_array_x2d_proto, "ReprojectionErrorsSelect"),
     }
-    for table_name, parser in blob_tables.items():
-        table = load_table_blob(db_path, f"{table_name}_select_all.sql", parser)
+    for table_name, (parser, native_select) in blob_tables.items():
+        if database_python_binding is not None:
+            select = getattr(database_python_binding, native_select)
+            table = load_table_native(db_path, table_name, select)
+        else:
+            table = load_table_blob(db_path, f"{table_name}_select_all.sql", parser)
+
         if table is not None:
             db[table_name] = table
 
+    # Tables that are stored in chunks of many samples per row.
+    for table_name in (
+        "imu_data",
+        "imu_errors",
+    ):
+        sql_query_file = f"{table_name}_chunks_select_all.sql"
+        if (table := load_table_imu_chunks(db_path, sql_query_file)) is not None:
+            db[table_name] = table
+
     # Explicitly keep the IDs as columns in the "single row" tables.
     for table_name in (
         "camera_info",
@@ -2,11 +2,15 @@ import sqlite3
 import unittest
 from tempfile import NamedTemporaryFile
 
+import numpy as np
+
 from database.sql_statement_loading import load_sql
 from database.sql_table_loading import (
     load_calibration_database,
     load_table,
     load_table_blob,
+    load_table_imu_chunks,
+    load_table_native,
 )
 
 
@@ -65,6 +69,77 @@ class TestDatabaseSqlTableLoading(unittest.TestCase):
                 list(table.columns), ["step_id", "asset_id", "timestamp_ns", "data"]
             )
 
+    def test_load_table_native(self):
+        with NamedTemporaryFile(suffix=".db3") as tmp:
+            execute_sql(tmp.name, load_sql("extracted_targets_table.sql"))
+
+            # Stand-in for the native select so that this test does not need the python bindings.
+            def select(db_path, step_id, asset_id):
+                self.assertEqual(db_path, tmp.name)
+                timestamps_ns = np.array([100, 200], dtype=np.uint64) + asset_id
+                data = [np.zeros((step_id, 2)), np.ones((step_id, 2))]
+
+                return timestamps_ns, data
+
+            # An empty table still has the expected columns.
+            table = load_table_native(tmp.name, "extracted_targets", select)
+            self.assertTrue(table.empty)
+            self.assertEqual(
+                list(table.columns), ["step_id", "asset_id", "timestamp_ns", "data"]
+            )
+
+            execute_sql(
+                tmp.name, "INSERT INTO extracted_targets VALUES (1, 1, 2, 0, x'')"
+            )
+            execute_sql(
+                tmp.name, "INSERT INTO extracted_targets VALUES (3, 1, 4, 0, x'')"
+            )
+
+            table = load_table_native(tmp.name, "extracted_targets", select)
+            self.assertEqual(len(table), 4)
+            self.assertEqual(list(table["step_id"]), [1, 1, 3, 3])
+            self.assertEqual(list(table["timestamp_ns"]), [102, 202, 104, 204])
+            self.assertEqual(table["data"].iloc[2].shape, (3, 2))
+
+    def test_load_table_imu_chunks(self):
+        with NamedTemporaryFile(suffix=".db3") as tmp:
+            execute_sql(tmp.name, load_sql("imu_data_chunks_table.sql"))
+
+            # Stand-in for the protobuf parsing, the blob holds the number of samples in the chunk.
+            def parser(blob):
+                size = int(blob)
+                timestamps_ns = np.arange(size, dtype=np.uint64)
+                data = np.ones((size, 6))
+
+                return timestamps_ns, data
+
+            # An empty table still has the expected columns.
+            table = load_table_imu_chunks(
+                tmp.name, "imu_data_chunks_select_all.sql", parser
+            )
+            self.assertTrue(table.empty)
+            self.assertEqual(
+                list(table.columns),
+                ["step_id", "asset_id", "timestamp_ns"]
+                + ["omega_x", "omega_y", "omega_z", "ax", "ay", "az"],
+            )
+
+            execute_sql(
+                tmp.name, "INSERT INTO imu_data_chunks VALUES (1, 2, 0, 1, '2')"
+            )
+            execute_sql(
+                tmp.name, "INSERT INTO imu_data_chunks VALUES (1, 2, 5, 7, '3')"
+            )
+
+            # Every chunk is expanded into one row per sample.
+            table = load_table_imu_chunks(
+                tmp.name, "imu_data_chunks_select_all.sql", parser
+            )
+            self.assertEqual(len(table), 5)
+            self.assertEqual(list(table["asset_id"]), [2, 2, 2, 2, 2])
+            self.assertEqual(list(table["timestamp_ns"]), [0, 1, 0, 1, 2])
+            self.assertEqual(table["az"].sum(), 5)
+
     def test_load_calibration_database(self):
         with NamedTemporaryFile(suffix=".db3") as tmp:
             execute_sql(tmp.name, load_sql("workflow_assets_table.sql"))
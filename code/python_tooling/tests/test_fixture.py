@@ -1,6 +1,7 @@
 import sqlite3
 
 from database.sql_statement_loading import load_sql
+from generated.extracted_target_pb2 import ImuChunkProto
 
 
 def execute_sql(db_path, sql_query, params=()):
@@ -75,15 +76,16 @@ def construct_test_db(db_path):
     )
 
     # Calibration artifact tables (only use a subset here to keep things simple).
-    execute_sql(db_path, load_sql("imu_data_table.sql"))
+    execute_sql(db_path, load_sql("imu_data_chunks_table.sql"))
     execute_sql(db_path, load_sql("images_table.sql"))
 
     # Add one piece of data into each table.
     execute_sql(
         db_path, load_sql("images_insert.sql"), (image_loading_id, camera_id, 0, None)
     )
+    imu_chunk = ImuChunkProto(timestamps_ns=[0], data=[1, 1, 1, 2, 2, 2])
     execute_sql(
         db_path,
-        load_sql("imu_data_insert.sql"),
-        (imu_data_loading_id, imu_id, 0, 1, 1, 1, 2, 2, 2),
+        load_sql("imu_data_chunks_insert.sql"),
+        (imu_data_loading_id, imu_id, 0, 0, imu_chunk.SerializeToString()),
     )
@@ -0,0 +1,7 @@
+SELECT camera_poses.step_id, camera_poses.asset_id, camera_poses.timestamp_ns, rx, ry, rz, x, y, z
+FROM camera_poses
+         JOIN workflow_steps ON workflow_steps.step_id = camera_poses.step_id
+         JOIN workflow_assets ON workflow_assets.workflow_id = workflow_steps.workflow_id
+    AND workflow_assets.asset_id = camera_poses.asset_id
+WHERE workflow_steps.workflow_id = ?
+ORDER BY camera_poses.step_id, camera_poses.asset_id, camera_poses.timestamp_ns;
\ No newline at end of file
@@ -0,0 +1,7 @@
+SELECT timestamp_ns, data
+FROM extracted_targets
+WHERE step_id = ?
+  AND asset_id = ?
+  AND timestamp_ns >= ?
+ORDER BY timestamp_ns
+LIMIT ?;
\ No newline at end of file
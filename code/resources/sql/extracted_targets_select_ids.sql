@@ -0,0 +1,3 @@
+SELECT DISTINCT step_id, asset_id
+FROM extracted_targets
+ORDER BY step_id, asset_id;
\ No newline at end of file
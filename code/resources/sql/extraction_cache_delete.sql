@@ -0,0 +1,7 @@
+DELETE FROM extraction_cache
+WHERE NOT EXISTS (
+    SELECT 1
+    FROM extraction_cache_uses
+    WHERE extraction_cache_uses.target_hash = extraction_cache.target_hash
+      AND extraction_cache_uses.image_hash = extraction_cache.image_hash
+);
\ No newline at end of file
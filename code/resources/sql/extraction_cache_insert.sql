@@ -0,0 +1,2 @@
+INSERT OR IGNORE INTO extraction_cache (target_hash, image_hash, data)
+VALUES (?, ?, ?);
\ No newline at end of file
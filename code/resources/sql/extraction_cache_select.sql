@@ -0,0 +1,3 @@
+SELECT image_hash, data
+FROM extraction_cache
+WHERE target_hash = ?;
\ No newline at end of file
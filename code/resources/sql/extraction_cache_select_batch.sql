@@ -0,0 +1,4 @@
+SELECT image_hash, data
+FROM extraction_cache
+WHERE target_hash = ?
+  AND image_hash IN (SELECT value FROM json_each(?));
\ No newline at end of file
@@ -0,0 +1,9 @@
+CREATE TABLE IF NOT EXISTS extraction_cache
+(
+    target_hash TEXT     NOT NULL,
+    image_hash  TEXT     NOT NULL,
+    data        BLOB,
+    created_at  DATETIME NOT NULL DEFAULT CURRENT_TIMESTAMP,
+
+    PRIMARY KEY (target_hash, image_hash)
+);
\ No newline at end of file
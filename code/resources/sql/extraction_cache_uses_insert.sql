@@ -0,0 +1,2 @@
+INSERT OR IGNORE INTO extraction_cache_uses (step_id, target_hash, image_hash)
+VALUES (?, ?, ?);
\ No newline at end of file
@@ -0,0 +1,10 @@
+CREATE TABLE IF NOT EXISTS extraction_cache_uses
+(
+    step_id     INTEGER NOT NULL,
+    target_hash TEXT    NOT NULL,
+    image_hash  TEXT    NOT NULL,
+
+    FOREIGN KEY (step_id) REFERENCES steps (id) ON DELETE CASCADE,
+    FOREIGN KEY (target_hash, image_hash) REFERENCES extraction_cache (target_hash, image_hash) ON DELETE CASCADE,
+    PRIMARY KEY (step_id, target_hash, image_hash)
+);
\ No newline at end of file
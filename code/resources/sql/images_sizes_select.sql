@@ -0,0 +1,4 @@
+SELECT timestamp_ns, length(data)
+FROM images
+WHERE step_id = ?
+  AND asset_id = ?;
\ No newline at end of file
@@ -0,0 +1,2 @@
+INSERT INTO imu_data_chunks (step_id, asset_id, start_ns, end_ns, data)
+VALUES (?, ?, ?, ?, ?);
\ No newline at end of file
@@ -0,0 +1,2 @@
+SELECT step_id, asset_id, data
+FROM imu_data_chunks;
\ No newline at end of file
@@ -1,3 +0,0 @@
-INSERT INTO imu_data (step_id, asset_id, timestamp_ns, omega_x, omega_y, omega_z, ax, ay, az)
-VALUES (?, ?, ?, ?, ?,?,?,?,?);
-
@@ -0,0 +1 @@
+DROP TABLE imu_data;
\ No newline at end of file
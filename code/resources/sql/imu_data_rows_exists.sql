@@ -0,0 +1,4 @@
+SELECT EXISTS(SELECT 1
+              FROM sqlite_master
+              WHERE type = 'table'
+                AND name = 'imu_data');
\ No newline at end of file
@@ -1,2 +1,3 @@
 SELECT step_id, asset_id, timestamp_ns, omega_x, omega_y, omega_z, ax, ay, az
-FROM imu_errors;
\ No newline at end of file
+FROM imu_data
+ORDER BY step_id, asset_id, timestamp_ns;
\ No newline at end of file
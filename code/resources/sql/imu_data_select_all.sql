@@ -1,2 +0,0 @@
-SELECT step_id, asset_id, timestamp_ns, omega_x, omega_y, omega_z, ax, ay, az
-FROM imu_data;
\ No newline at end of file
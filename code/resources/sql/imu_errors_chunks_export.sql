@@ -0,0 +1,7 @@
+SELECT imu_errors_chunks.step_id, imu_errors_chunks.asset_id, data
+FROM imu_errors_chunks
+         JOIN workflow_steps ON workflow_steps.step_id = imu_errors_chunks.step_id
+         JOIN workflow_assets ON workflow_assets.workflow_id = workflow_steps.workflow_id
+    AND workflow_assets.asset_id = imu_errors_chunks.asset_id
+WHERE workflow_steps.workflow_id = ?
+ORDER BY imu_errors_chunks.step_id, imu_errors_chunks.asset_id, imu_errors_chunks.start_ns;
\ No newline at end of file
@@ -0,0 +1,7 @@
+SELECT data
+FROM imu_errors_chunks
+WHERE step_id = ?
+  AND asset_id = ?
+  AND start_ns <= ?
+  AND end_ns >= ?
+ORDER BY start_ns;
\ No newline at end of file
@@ -0,0 +1,14 @@
+CREATE TABLE IF NOT EXISTS imu_errors_chunks
+(
+    step_id        INTEGER NOT NULL,
+    source_step_id INTEGER NOT NULL,
+    asset_id       INTEGER NOT NULL,
+    start_ns       INTEGER NOT NULL,
+    end_ns         INTEGER NOT NULL,
+    data           BLOB    NOT NULL,
+
+    FOREIGN KEY (step_id) REFERENCES steps (id) ON DELETE CASCADE,
+    FOREIGN KEY (source_step_id) REFERENCES steps (id) ON DELETE CASCADE,
+    FOREIGN KEY (asset_id) REFERENCES assets (id) ON DELETE CASCADE,
+    PRIMARY KEY (step_id, asset_id, start_ns)
+);
\ No newline at end of file
@@ -1,2 +0,0 @@
-INSERT INTO imu_errors (step_id, source_step_id, asset_id, timestamp_ns, omega_x, omega_y, omega_z, ax, ay, az)
-VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);
\ No newline at end of file
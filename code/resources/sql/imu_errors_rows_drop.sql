@@ -0,0 +1 @@
+DROP TABLE imu_errors;
\ No newline at end of file
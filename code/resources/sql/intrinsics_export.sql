@@ -0,0 +1,7 @@
+SELECT intrinsics.step_id, intrinsics.asset_id, camera_model, data
+FROM intrinsics
+         JOIN workflow_steps ON workflow_steps.step_id = intrinsics.step_id
+         JOIN workflow_assets ON workflow_assets.workflow_id = workflow_steps.workflow_id
+    AND workflow_assets.asset_id = intrinsics.asset_id
+WHERE workflow_steps.workflow_id = ?
+ORDER BY intrinsics.step_id, intrinsics.asset_id;
\ No newline at end of file
@@ -0,0 +1,7 @@
+SELECT reprojection_errors.step_id, reprojection_errors.asset_id, reprojection_errors.timestamp_ns, data
+FROM reprojection_errors
+         JOIN workflow_steps ON workflow_steps.step_id = reprojection_errors.step_id
+         JOIN workflow_assets ON workflow_assets.workflow_id = workflow_steps.workflow_id
+    AND workflow_assets.asset_id = reprojection_errors.asset_id
+WHERE workflow_steps.workflow_id = ?
+ORDER BY reprojection_errors.step_id, reprojection_errors.asset_id, reprojection_errors.timestamp_ns;
\ No newline at end of file
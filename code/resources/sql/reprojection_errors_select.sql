@@ -0,0 +1,4 @@
+SELECT timestamp_ns, data
+FROM reprojection_errors
+WHERE step_id = ?
+  AND asset_id = ?;
\ No newline at end of file
@@ -0,0 +1,3 @@
+SELECT DISTINCT step_id, asset_id
+FROM reprojection_errors
+ORDER BY step_id, asset_id;
\ No newline at end of file
@@ -0,0 +1,3 @@
+INSERT INTO solver_iterations (step_id, iteration, cost, gradient_norm, step_norm, iteration_time_s,
+                               cumulative_time_s, step_is_successful)
+VALUES (?, ?, ?, ?, ?, ?, ?, ?);
\ No newline at end of file
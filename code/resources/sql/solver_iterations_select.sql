@@ -0,0 +1,4 @@
+SELECT iteration, cost, gradient_norm, step_norm, iteration_time_s, cumulative_time_s, step_is_successful
+FROM solver_iterations
+WHERE step_id = ?
+ORDER BY iteration;
\ No newline at end of file
@@ -0,0 +1,2 @@
+SELECT step_id, iteration, cost, gradient_norm, step_norm, iteration_time_s, cumulative_time_s, step_is_successful
+FROM solver_iterations;
\ No newline at end of file
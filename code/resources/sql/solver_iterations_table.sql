@@ -0,0 +1,14 @@
+CREATE TABLE IF NOT EXISTS solver_iterations
+(
+    step_id            INTEGER NOT NULL,
+    iteration          INTEGER NOT NULL,
+    cost               REAL    NOT NULL,
+    gradient_norm      REAL    NOT NULL,
+    step_norm          REAL    NOT NULL,
+    iteration_time_s   REAL    NOT NULL,
+    cumulative_time_s  REAL    NOT NULL,
+    step_is_successful INTEGER NOT NULL CHECK ( step_is_successful IN (0, 1)),
+
+    FOREIGN KEY (step_id) REFERENCES steps (id) ON DELETE CASCADE,
+    PRIMARY KEY (step_id, iteration)
+);
\ No newline at end of file
@@ -0,0 +1,13 @@
+SELECT step_id,
+       initial_cost,
+       final_cost,
+       num_successful_steps,
+       num_unsuccessful_steps,
+       preprocessor_time_s,
+       minimizer_time_s,
+       linear_solver_time_s,
+       jacobian_evaluation_time_s,
+       residual_evaluation_time_s,
+       postprocessor_time_s,
+       total_time_s
+FROM solver_metrics;
\ No newline at end of file
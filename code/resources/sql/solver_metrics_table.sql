@@ -0,0 +1,17 @@
+CREATE TABLE IF NOT EXISTS solver_metrics
+(
+    step_id                    INTEGER PRIMARY KEY,
+    initial_cost               REAL    NOT NULL,
+    final_cost                 REAL    NOT NULL,
+    num_successful_steps       INTEGER NOT NULL,
+    num_unsuccessful_steps     INTEGER NOT NULL,
+    preprocessor_time_s        REAL    NOT NULL,
+    minimizer_time_s           REAL    NOT NULL,
+    linear_solver_time_s       REAL    NOT NULL,
+    jacobian_evaluation_time_s REAL    NOT NULL,
+    residual_evaluation_time_s REAL    NOT NULL,
+    postprocessor_time_s       REAL    NOT NULL,
+    total_time_s               REAL    NOT NULL,
+
+    FOREIGN KEY (step_id) REFERENCES steps (id) ON DELETE CASCADE
+);
\ No newline at end of file
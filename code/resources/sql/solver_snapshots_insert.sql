@@ -0,0 +1,2 @@
+INSERT INTO solver_snapshots (step_id, iteration, camera_model, intrinsics, rx, ry, rz, x, y, z)
+VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);
\ No newline at end of file
@@ -0,0 +1,4 @@
+SELECT iteration, camera_model, intrinsics, rx, ry, rz, x, y, z
+FROM solver_snapshots
+WHERE step_id = ?
+ORDER BY iteration;
\ No newline at end of file
@@ -0,0 +1,2 @@
+SELECT step_id, iteration, camera_model, intrinsics, rx, ry, rz, x, y, z
+FROM solver_snapshots;
\ No newline at end of file
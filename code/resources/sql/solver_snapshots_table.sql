@@ -0,0 +1,18 @@
+CREATE TABLE IF NOT EXISTS solver_snapshots
+(
+    step_id      INTEGER NOT NULL,
+    iteration    INTEGER NOT NULL,
+    camera_model TEXT CHECK ( camera_model IN
+                              ('double_sphere', 'pinhole', 'pinhole_radtan4', 'unified_camera_model')),
+    intrinsics   TEXT,
+    rx           REAL,
+    ry           REAL,
+    rz           REAL,
+    x            REAL,
+    y            REAL,
+    z            REAL,
+
+    FOREIGN KEY (step_id) REFERENCES steps (id) ON DELETE CASCADE,
+    PRIMARY KEY (step_id, iteration),
+    CHECK ( (camera_model IS NULL) = (intrinsics IS NULL) )
+);
\ No newline at end of file
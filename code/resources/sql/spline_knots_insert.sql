@@ -0,0 +1,2 @@
+INSERT INTO spline_knots (step_id, asset_id, idx, t_ns)
+VALUES (?, ?, ?, ?);
\ No newline at end of file
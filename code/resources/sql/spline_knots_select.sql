@@ -0,0 +1,5 @@
+SELECT t_ns
+FROM spline_knots
+WHERE step_id = ?
+  AND asset_id = ?
+ORDER BY idx ASC;
\ No newline at end of file
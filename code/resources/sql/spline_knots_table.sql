@@ -0,0 +1,11 @@
+CREATE TABLE IF NOT EXISTS spline_knots
+(
+    step_id  INTEGER NOT NULL,
+    asset_id INTEGER NOT NULL,
+    idx      INTEGER NOT NULL,
+    t_ns     INTEGER NOT NULL,
+
+    FOREIGN KEY (step_id) REFERENCES steps (id) ON DELETE CASCADE,
+    FOREIGN KEY (asset_id) REFERENCES assets (id) ON DELETE CASCADE,
+    PRIMARY KEY (step_id, asset_id, idx)
+);
\ No newline at end of file
@@ -0,0 +1,2 @@
+INSERT INTO step_metrics (step_id, cache_status, wall_time_s, cpu_time_s, peak_rss_delta_kb, peak_num_threads)
+VALUES (?, ?, ?, ?, ?, ?);
\ No newline at end of file
@@ -0,0 +1,4 @@
+SELECT cache_status, wall_time_s, cpu_time_s, peak_rss_delta_kb, peak_num_threads
+FROM step_metrics
+WHERE step_id = ?
+ORDER BY id;
\ No newline at end of file
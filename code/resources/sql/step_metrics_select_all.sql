@@ -0,0 +1,2 @@
+SELECT id, step_id, cache_status, wall_time_s, cpu_time_s, peak_rss_delta_kb, peak_num_threads, created_at
+FROM step_metrics;
\ No newline at end of file
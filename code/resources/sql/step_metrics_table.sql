@@ -0,0 +1,13 @@
+CREATE TABLE IF NOT EXISTS step_metrics
+(
+    id                INTEGER PRIMARY KEY,
+    step_id           INTEGER  NOT NULL,
+    cache_status      TEXT     NOT NULL CHECK ( cache_status IN ('cache_hit', 'cache_miss')),
+    wall_time_s       REAL     NOT NULL,
+    cpu_time_s        REAL     NOT NULL,
+    peak_rss_delta_kb INTEGER  NOT NULL,
+    peak_num_threads  INTEGER  NOT NULL,
+    created_at        DATETIME NOT NULL DEFAULT CURRENT_TIMESTAMP,
+
+    FOREIGN KEY (step_id) REFERENCES steps (id) ON DELETE CASCADE
+);
\ No newline at end of file
@@ -0,0 +1,9 @@
+SELECT steps.id, steps.cache_key
+FROM steps
+         JOIN intrinsics ON intrinsics.step_id = steps.id
+WHERE steps.type = ?
+  AND steps.cache_key IS NOT NULL
+  AND intrinsics.asset_id = ?
+  AND intrinsics.camera_model = ?
+ORDER BY steps.id DESC
+LIMIT 1;
\ No newline at end of file
@@ -0,0 +1,2 @@
+INSERT INTO warm_starts (step_id, asset_id, input_key, source_step_id, source_key, matched_frames)
+VALUES (?, ?, ?, ?, ?, ?);
\ No newline at end of file
@@ -0,0 +1,4 @@
+SELECT source_key
+FROM warm_starts
+WHERE step_id = ?
+  AND input_key = ?;
\ No newline at end of file
@@ -0,0 +1,7 @@
+SELECT step_id,
+       asset_id,
+       input_key,
+       source_step_id,
+       source_key,
+       matched_frames
+FROM warm_starts;
\ No newline at end of file
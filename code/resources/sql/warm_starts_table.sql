@@ -0,0 +1,12 @@
+CREATE TABLE IF NOT EXISTS warm_starts
+(
+    step_id        INTEGER PRIMARY KEY,
+    asset_id       INTEGER NOT NULL,
+    input_key      TEXT    NOT NULL,
+    source_step_id INTEGER NOT NULL,
+    source_key     TEXT    NOT NULL,
+    matched_frames INTEGER NOT NULL,
+
+    FOREIGN KEY (step_id) REFERENCES steps (id) ON DELETE CASCADE,
+    FOREIGN KEY (asset_id) REFERENCES assets (id) ON DELETE CASCADE
+);
\ No newline at end of file